@@ -0,0 +1,13 @@
+/* Generated by host/disp_imgconv.c from WQVGA1.bin, do not edit. */
+#ifndef __IMAGE1_H__
+#define __IMAGE1_H__
+
+#define IMAGE1_WIDTH       480   /*!< Width in pixels */
+#define IMAGE1_HEIGHT      272   /*!< Height in pixels */
+#define IMAGE1_STRIDE      960   /*!< Bytes per row, 0 for q565 */
+#define IMAGE1_FORMAT      evDispImageRGB565   /*!< E_DISP_IMAGE_FORMAT */
+#define IMAGE1_CLUT_NUM    0   /*!< Palette entries ahead of the rows */
+#define IMAGE1_ROTATION    0   /*!< Clockwise rotation applied */
+#define IMAGE1_SIZE        261120   /*!< Bytes of the binary */
+
+#endif /* __IMAGE1_H__ */
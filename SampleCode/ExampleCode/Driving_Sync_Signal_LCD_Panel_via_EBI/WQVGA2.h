@@ -0,0 +1,13 @@
+/* Generated by host/disp_imgconv.c from WQVGA2.bin, do not edit. */
+#ifndef __IMAGE2_H__
+#define __IMAGE2_H__
+
+#define IMAGE2_WIDTH       480   /*!< Width in pixels */
+#define IMAGE2_HEIGHT      272   /*!< Height in pixels */
+#define IMAGE2_STRIDE      960   /*!< Bytes per row, 0 for q565 */
+#define IMAGE2_FORMAT      evDispImageRGB565   /*!< E_DISP_IMAGE_FORMAT */
+#define IMAGE2_CLUT_NUM    0   /*!< Palette entries ahead of the rows */
+#define IMAGE2_ROTATION    0   /*!< Clockwise rotation applied */
+#define IMAGE2_SIZE        261120   /*!< Bytes of the binary */
+
+#endif /* __IMAGE2_H__ */
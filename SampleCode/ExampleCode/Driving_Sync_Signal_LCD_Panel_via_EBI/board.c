@@ -49,6 +49,9 @@ static void ebi_init(void)
     SET_EBI_ADR0_PH7();
     SET_EBI_ADR1_PH6();
     SET_EBI_ADR7_PH0();
+#if defined(CONFIG_DISP_PANEL2)
+    SET_EBI_nCS1_PD11();
+#endif
 
     // Set slew rate to high for EBI pins
     GPIO_SetSlewCtl(PH, (BIT0 | BIT6 | BIT7 | BIT8 | BIT9 | BIT10 | BIT11), GPIO_SLEWCTL_HIGH);
@@ -59,12 +62,21 @@ static void ebi_init(void)
     GPIO_SetSlewCtl(PE, (BIT0 | BIT1), GPIO_SLEWCTL_HIGH);
     GPIO_SetSlewCtl(PJ, (BIT8 | BIT9), GPIO_SLEWCTL_HIGH);
     GPIO_SetSlewCtl(PD, BIT14, GPIO_SLEWCTL_HIGH);
+#if defined(CONFIG_DISP_PANEL2)
+    GPIO_SetSlewCtl(PD, BIT11, GPIO_SLEWCTL_HIGH);
+#endif
 
     // Open EBI with specified configuration
     EBI_Open(CONFIG_DISP_EBI, EBI_BUSWIDTH_16BIT, EBI_TIMING_FASTEST, EBI_OPMODE_CACCESS | EBI_OPMODE_ADSEPARATE, EBI_CS_ACTIVE_LOW);
 
     // Set bus timing for EBI
     EBI_SetBusTiming(CONFIG_DISP_EBI, 0, EBI_MCLKDIV_4);
+
+#if defined(CONFIG_DISP_PANEL2)
+    // Open the bank of the second panel with the same timing, its nCS gates nWR into the PCLK of that panel
+    EBI_Open(CONFIG_DISP_PANEL2_EBI, EBI_BUSWIDTH_16BIT, EBI_TIMING_FASTEST, EBI_OPMODE_CACCESS | EBI_OPMODE_ADSEPARATE, EBI_CS_ACTIVE_LOW);
+    EBI_SetBusTiming(CONFIG_DISP_PANEL2_EBI, 0, EBI_MCLKDIV_4);
+#endif
 }
 
 // Deinitialize EBI and GPIO modules
@@ -72,6 +84,9 @@ static void ebi_fini(void)
 {
     // Close EBI
     EBI_Close(CONFIG_DISP_EBI);
+#if defined(CONFIG_DISP_PANEL2)
+    EBI_Close(CONFIG_DISP_PANEL2_EBI);
+#endif
 
     // Reset pin configurations for EBI address and data lines
     SET_GPIO_PA5();
@@ -96,6 +111,9 @@ static void ebi_fini(void)
     SET_GPIO_PH7();
     SET_GPIO_PH6();
     SET_GPIO_PH0();
+#if defined(CONFIG_DISP_PANEL2)
+    SET_GPIO_PD11();
+#endif
 
     // Set slew rate to normal for EBI pins
     GPIO_SetSlewCtl(PH, (BIT0 | BIT6 | BIT7 | BIT8 | BIT9 | BIT10 | BIT11), GPIO_SLEWCTL_NORMAL);
@@ -106,6 +124,9 @@ static void ebi_fini(void)
     GPIO_SetSlewCtl(PE, (BIT0 | BIT1), GPIO_SLEWCTL_NORMAL);
     GPIO_SetSlewCtl(PJ, (BIT8 | BIT9), GPIO_SLEWCTL_NORMAL);
     GPIO_SetSlewCtl(PD, BIT14, GPIO_SLEWCTL_NORMAL);
+#if defined(CONFIG_DISP_PANEL2)
+    GPIO_SetSlewCtl(PD, BIT11, GPIO_SLEWCTL_NORMAL);
+#endif
 
     // Disable EBI and GPIO modules clock
     CLK_DisableModuleClock(EBI0_MODULE);
@@ -117,6 +138,125 @@ static void ebi_fini(void)
     CLK_DisableModuleClock(GPIOJ_MODULE);
 }
 
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+// Train the SPIM DLL delay with a HyperRAM write/read pattern, pick the middle of the widest passing window
+static int32_t hyperram_train_dll(SPIM_T *spim)
+{
+    int32_t i32Delay;
+    int32_t i32Start = -1;
+    int32_t i32BestStart = 0;
+    int32_t i32BestLen = 0;
+    const uint32_t u32Pattern = 0x5AA5C33C;
+
+    for (i32Delay = 0; i32Delay < SPIM_HYPER_MAX_LATENCY; i32Delay++)
+    {
+        if ((SPIM_HYPER_SetDLLDelayNum(spim, i32Delay) == SPIM_HYPER_OK) &&
+                (SPIM_HYPER_Write4Byte(spim, 0, u32Pattern) == SPIM_HYPER_OK) &&
+                ((uint32_t)SPIM_HYPER_Read2Word(spim, 0) == u32Pattern))
+        {
+            if (i32Start < 0)
+                i32Start = i32Delay;
+
+            if ((i32Delay - i32Start + 1) > i32BestLen)
+            {
+                i32BestStart = i32Start;
+                i32BestLen = i32Delay - i32Start + 1;
+            }
+        }
+        else
+        {
+            i32Start = -1;
+        }
+    }
+
+    if (!i32BestLen)
+        return SPIM_HYPER_ERR_FAIL;
+
+    return SPIM_HYPER_SetDLLDelayNum(spim, i32BestStart + (i32BestLen / 2));
+}
+
+// Initialize SPIM0 HyperRAM and map it at SPIM_HYPER_DMM0_SADDR
+static int hyperram_init(void)
+{
+    /* Enable SPIM0 and GPIO modules clock and set pin multi-function. */
+    CLK_EnableModuleClock(SPIM0_MODULE);
+    CLK_EnableModuleClock(GPIOG_MODULE);
+    CLK_EnableModuleClock(GPIOH_MODULE);
+    CLK_EnableModuleClock(GPIOJ_MODULE);
+
+    // Reset SPIM0 module
+    SYS_ResetModule(SYS_SPIM0RST);
+
+    // Set pin configurations for the HyperBus
+    SET_SPIM0_CLKN_PH12();
+    SET_SPIM0_CLK_PH13();
+    SET_SPIM0_D2_PJ5();
+    SET_SPIM0_D3_PJ6();
+    SET_SPIM0_D4_PH14();
+    SET_SPIM0_D5_PH15();
+    SET_SPIM0_D6_PG13();
+    SET_SPIM0_D7_PG14();
+    SET_SPIM0_MISO_PJ4();
+    SET_SPIM0_MOSI_PJ3();
+    SET_SPIM0_RESETN_PJ2();
+    SET_SPIM0_RWDS_PG15();
+    SET_SPIM0_SS_PJ7();
+
+    // Set slew rate to high for HyperBus pins
+    GPIO_SetSlewCtl(PG, (BIT13 | BIT14 | BIT15), GPIO_SLEWCTL_HIGH);
+    GPIO_SetSlewCtl(PH, (BIT12 | BIT13 | BIT14 | BIT15), GPIO_SLEWCTL_HIGH);
+    GPIO_SetSlewCtl(PJ, (BIT2 | BIT3 | BIT4 | BIT5 | BIT6 | BIT7), GPIO_SLEWCTL_HIGH);
+
+    // Enable HyperRAM mode with the fastest HyperBus clock
+    SPIM_HYPER_Init(SPIM0, SPIM_HYPERRAM_MODE, 1);
+
+    if ((SPIM_HYPER_Reset(SPIM0) != SPIM_HYPER_OK) ||
+            (SPIM_HYPER_ExitHSAndDPD(SPIM0) != SPIM_HYPER_OK) ||
+            (hyperram_train_dll(SPIM0) != SPIM_HYPER_OK))
+        return -1;
+
+    // Map HyperRAM for the CPU and DMA, the HYPERRAM region of M55M1.scatter lives here
+    SPIM_HYPER_EnterDirectMapMode(SPIM0);
+
+    return 0;
+}
+
+// Deinitialize SPIM0 HyperRAM
+static void hyperram_fini(void)
+{
+    SPIM_HYPER_ExitDirectMapMode(SPIM0);
+
+    // Reset SPIM0 module
+    SYS_ResetModule(SYS_SPIM0RST);
+
+    // Reset pin configurations for the HyperBus
+    SET_GPIO_PH12();
+    SET_GPIO_PH13();
+    SET_GPIO_PJ5();
+    SET_GPIO_PJ6();
+    SET_GPIO_PH14();
+    SET_GPIO_PH15();
+    SET_GPIO_PG13();
+    SET_GPIO_PG14();
+    SET_GPIO_PJ4();
+    SET_GPIO_PJ3();
+    SET_GPIO_PJ2();
+    SET_GPIO_PG15();
+    SET_GPIO_PJ7();
+
+    // Set slew rate to normal for HyperBus pins
+    GPIO_SetSlewCtl(PG, (BIT13 | BIT14 | BIT15), GPIO_SLEWCTL_NORMAL);
+    GPIO_SetSlewCtl(PH, (BIT12 | BIT13 | BIT14 | BIT15), GPIO_SLEWCTL_NORMAL);
+    GPIO_SetSlewCtl(PJ, (BIT2 | BIT3 | BIT4 | BIT5 | BIT6 | BIT7), GPIO_SLEWCTL_NORMAL);
+
+    // Disable SPIM0 module clock, ebi_fini() disables GPIOH and GPIOJ
+    CLK_DisableModuleClock(SPIM0_MODULE);
+    CLK_DisableModuleClock(GPIOG_MODULE);
+}
+
+#endif
+
 // Initialize board
 void board_init(void)
 {
@@ -129,6 +269,14 @@ void board_init(void)
     // Enable EBI module clock and set EBI function pins
     ebi_init();
 
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+    // VRAM lives in HyperRAM, map it before any component touches it
+    if (hyperram_init() < 0)
+        printf("HyperRAM initialization failure.\n");
+
+#endif
+
     /* Lock protected registers */
     if (u32RegLocked)
         SYS_LockReg();
@@ -143,6 +291,11 @@ void board_fini(void)
     if (u32RegLocked)
         SYS_UnlockReg();
 
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    // Unmap HyperRAM and reset HyperBus function pins
+    hyperram_fini();
+#endif
+
     // Disable EBI module clock and reset EBI function pins
     ebi_fini();
 
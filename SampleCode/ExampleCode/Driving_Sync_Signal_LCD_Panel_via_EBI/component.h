@@ -18,18 +18,27 @@
  *
  * @member name        system component name.
  * @member initialize  Necessary component or module initialization before executing.
+ *                     Returns 0 when done, COMPONENT_PENDING when work goes on in
+ *                     the background, or a negative value on failure.
  * @member finalize    Finalize component resources.
+ * @member poll        Completion check of a pending initialize, same return values.
+ * @member flags       COMPONENT_FLAG_xxx.
 */
 struct component_export
 {
     const char  *name;
     int (*initialize)(void);
     int (*finalize)(void);
+    int (*poll)(void);
+    uint32_t     flags;
 };
 typedef struct component_export *component_export_t;
 
+#define COMPONENT_PENDING          1            /*!< Initialize goes on in the background, call poll until it is not pending */
+#define COMPONENT_FLAG_DEFERRED    (1UL << 0)   /*!< Initialize once every other component is ready */
+
 /**
- * COMPONENT_EXPORT
+ * COMPONENT_EXPORT_EX
  *
  * @brief Export component data structure to 'CompInitTab' section in flash.
  *        Used in application layer.
@@ -37,18 +46,57 @@ typedef struct component_export *component_export_t;
  * @member name        system component name.
  * @member initialize  Necessary component or module initialization before executing.
  * @member finalize    Finalize component resources.
+ * @member poll        Completion check of a pending initialize, NULL if initialize never pends.
+ * @member flags       COMPONENT_FLAG_xxx.
  *
  * @return None
  *
 */
-#define COMPONENT_EXPORT(name, initialize, finalize)                           \
+#define COMPONENT_EXPORT_EX(name, initialize, finalize, poll, flags)           \
     __attribute__((used)) static const struct component_export _component      \
     __attribute__((section("CompInitTab"))) =                                  \
-                                                                               {                                                                          \
-                                                                                                                                                          name,                                                                  \
-                                                                                                                                                          initialize,                                                            \
-                                                                                                                                                          finalize                                                               \
-                                                                               }
+    {                                                                          \
+        name,                                                                  \
+        initialize,                                                            \
+        finalize,                                                              \
+        poll,                                                                  \
+        flags                                                                  \
+    }
+
+/**
+ * COMPONENT_EXPORT
+ *
+ * @brief Export a component whose initialize completes before it returns.
+ *
+ * @return None
+ *
+*/
+#define COMPONENT_EXPORT(name, initialize, finalize)                           \
+    COMPONENT_EXPORT_EX(name, initialize, finalize, NULL, 0)
+
+/**
+ * COMPONENT_EXPORT_ASYNC
+ *
+ * @brief Export a component whose initialize may return COMPONENT_PENDING,
+ *        main() calls poll until the background work is done.
+ *
+ * @return None
+ *
+*/
+#define COMPONENT_EXPORT_ASYNC(name, initialize, finalize, poll)               \
+    COMPONENT_EXPORT_EX(name, initialize, finalize, poll, 0)
+
+/**
+ * COMPONENT_EXPORT_DEFERRED
+ *
+ * @brief Export a component that initializes after every other component,
+ *        asynchronous ones included, is ready.
+ *
+ * @return None
+ *
+*/
+#define COMPONENT_EXPORT_DEFERRED(name, initialize, finalize)                  \
+    COMPONENT_EXPORT_EX(name, initialize, finalize, NULL, COMPONENT_FLAG_DEFERRED)
 
 #define NVT_ALIGN(size, align)        (((size) + (align) - 1) & ~((align) - 1))
 #define NVT_ALIGN_DOWN(size, align)   ((size) & ~((align) - 1))
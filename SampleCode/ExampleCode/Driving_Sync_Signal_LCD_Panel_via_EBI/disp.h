@@ -13,8 +13,18 @@
 
 
 #define CONFIG_DISP_EBI               EBI_BANK0   /*!< SET EBI Bank */
+//#define CONFIG_DISP_PANEL2                      /*!< Drive a second panel of the same timing on its own EBI bank, PDMA backend only */
+#define CONFIG_DISP_PANEL2_EBI        EBI_BANK1   /*!< EBI bank of the second panel, nCS1 on PD11 gates nWR into its PCLK */
+#define CONFIG_DISP_PANEL2_MIRROR             0   /*!< 1: the second panel shows the buffer of the first, 0: it flips its own VRAM buffers */
+//#define CONFIG_DISP_I80                         /*!< The panel on CONFIG_DISP_EBI is an i80 (8080) command-mode panel with its own GRAM, see disp_i80_pdma.c */
+#define CONFIG_DISP_I80_DC_BITIDX             1   /*!< EBI address bit driving D/C, low for commands. 1 implies SET_EBI_ADR0_PH7 */
+#define CONFIG_DISP_I80_MADCTL             0x00   /*!< MADCTL parameter of the i80 panel, its scan direction and RGB/BGR order */
+#define CONFIG_DISP_I80_FPS                  60   /*!< Blank rate of the i80 panel, TIMER0 stands in for the unwired TE output */
 
+/* Define CONFIG_DISP_PANEL_OVERRIDE to supply the panel mode and timing from the build command line. */
+#if !defined(CONFIG_DISP_PANEL_OVERRIDE)
 #define CONFIG_LCD_PANEL_USE_DE_ONLY              /*!< LCD supports DE-only mode, without HSync and VSync. */
+#endif
 #define CONFIG_DISP_DE_ACTIVE_LOW             0   /*!< Disable DE active low */
 #define CONFIG_DISP_VPW_ACTIVE_LOW            1   /*!< Enable VPW active low */
 #define CONFIG_DISP_HPW_ACTIVE_LOW            1   /*!< Enable HPW active low */
@@ -22,6 +32,7 @@
 #define CONFIG_DISP_VSYNC_BITIDX              1   /*!< Implies SET_EBI_ADR0_PH7 */
 #define CONFIG_DISP_HSYNC_BITIDX              2   /*!< Implies SET_EBI_ADR1_PH6 */
 
+#if !defined(CONFIG_DISP_PANEL_OVERRIDE)
 #define CONFIG_TIMING_HACT                  480   /*!< Specify XRES */
 #define CONFIG_TIMING_VACT                  272   /*!< Specify YRES */
 #define CONFIG_TIMING_HBP                    30   /*!< Specify HBP (Horizontal Back Porch) */
@@ -30,9 +41,34 @@
 #define CONFIG_TIMING_VBP                     2   /*!< Specify VBP (Vertical Back Porch) */
 #define CONFIG_TIMING_VFP                    27   /*!< Specify VFP (Vertical Front Porch) */
 #define CONFIG_TIMING_VPW                    10   /*!< Specify VPW (VSYNC width) */
+#endif
+
+#define CONFIG_DISP_BACKEND                   evDispBackendGDMA   /*!< Backend started at boot when the target links it, see E_DISP_BACKEND in disp_backend.h */
+//#define CONFIG_DISP_BACKENDBENCH                /*!< Report frame rate, interrupt load and CPU memory throughput of each linked backend */
+#define CONFIG_DISP_BACKENDBENCH_FRAMES     120   /*!< Frames each backend runs in the backend benchmark */
+//#define CONFIG_DISP_RINGBENCH                   /*!< Report the scanout ring footprint and timing on the UART console */
+//#define CONFIG_DISP_RING_IMAGE                  /*!< Start the GDMA scanout from disp_ring_image.h, host/disp_ringgen.sh generates it for this panel */
+//#define CONFIG_DISP_VRAM_IN_HYPERRAM            /*!< Place VRAM in HyperRAM (SPIM0 direct map), the EBI scans out of SRAM line buffers */
+#define CONFIG_DISP_PREFETCH_LINES            4   /*!< SRAM line buffers filled ahead of the EBI scanout */
+//#define CONFIG_DISP_VRAM_BANKED                 /*!< Place each VRAM buffer in its own SRAM bank, needs SRAM_BANK_PLACEMENT in M55M1.scatter */
+//#define CONFIG_DISP_BANKBENCH                   /*!< Report the render speed into the scanout bank against the other bank */
+#define CONFIG_DISP_VRAM_CACHE_POLICY         evDispCacheWriteBack   /*!< MPU cache policy of the VRAM buffers, see E_DISP_CACHE_POLICY in disp_mpu.h */
+//#define CONFIG_DISP_MPUBENCH                    /*!< Report render and flip cost of each VRAM cache policy */
+//#define CONFIG_DISP_SPLASH_IN_FLASH             /*!< Scan the example images out of flash directly, VRAM is left for dynamic content */
+//#define CONFIG_DISP_IMAGE_COMPRESSED            /*!< Embed the example images compressed, see disp_image.h. host/disp_image.sh rebuilds them */
+#define CONFIG_DISP_IMAGE_POLL_ROWS          16   /*!< Rows decoded into VRAM per component or disp_anim_poll() poll */
+#define CONFIG_VRAM_BUF_NUM                   2   /*!< VRAM buffer number, 2 to 4. 3 or more let the swapchain render ahead of the scanout */
+//#define CONFIG_DISP_SWAPBENCH                   /*!< Report frame pacing of the disp_swapchain.h present modes, the VRAM content is overwritten */
+//#define CONFIG_DISP_TILEBENCH                   /*!< Report the render cost of each disp_tile.h mode, the VRAM content is overwritten */
+//#define CONFIG_DISP_MEMCPYBENCH                 /*!< Report CPU, PDMA and DMA-350 copy throughput, GDMA target only, the VRAM content is overwritten */
+//#define CONFIG_DISP_PROBE                       /*!< Time the hot paths with disp_probe.h, press 'p' on the debug UART for the report */
 
 #define PATH_IMAGE1_BIN        "..//WQVGA1.bin"   /*!< Specify image1 path */
 #define PATH_IMAGE2_BIN        "..//WQVGA2.bin"   /*!< Specify image2 path */
+#define PATH_IMAGE1_H          "WQVGA1.h"         /*!< Specify image1 layout header, host/disp_imgconv.sh makes it */
+#define PATH_IMAGE2_H          "WQVGA2.h"         /*!< Specify image2 layout header, host/disp_imgconv.sh makes it */
+#define PATH_IMAGE1_Q565       "..//WQVGA1.q565"  /*!< Specify compressed image1 path */
+#define PATH_IMAGE2_Q565       "..//WQVGA2.q565"  /*!< Specify compressed image2 path */
 
 /* Don't touch. */
 #define CONFIG_DISP_DE_BITMASK               (1<<CONFIG_DISP_DE_BITIDX)      /*!< Bit mask for DE */
@@ -47,9 +83,62 @@
                                               (CONFIG_DISP_DE_ACTIVE_LOW<<CONFIG_DISP_DE_BITIDX))   /*!< EBI address configuration */
 
 #define CONFIG_VRAM_BUF_SIZE                 (CONFIG_TIMING_HACT * CONFIG_TIMING_VACT * sizeof(uint16_t))   /*!< Size of VRAM buffer */
-#define CONFIG_VRAM_BUF_NUM                  2   /*!< VRAM buffer number */
 #define CONFIG_VRAM_TOTAL_ALLOCATED_SIZE     NVT_ALIGN((CONFIG_VRAM_BUF_NUM * CONFIG_VRAM_BUF_SIZE), DCACHE_LINE_SIZE) /*!< Total of VRAM buffer size */
 
+#if (CONFIG_VRAM_BUF_NUM < 2) || (CONFIG_VRAM_BUF_NUM > 4)
+    #error "CONFIG_VRAM_BUF_NUM must be 2 to 4."
+#endif
+
+#if defined(CONFIG_DISP_VRAM_BANKED)
+    #if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+        #error "CONFIG_DISP_VRAM_BANKED and CONFIG_DISP_VRAM_IN_HYPERRAM are exclusive."
+    #endif
+    #if (CONFIG_VRAM_BUF_NUM != 2)
+        #error "CONFIG_DISP_VRAM_BANKED places one VRAM buffer in SRAM0 and one in SRAM1."
+    #endif
+#endif
+
+#if defined(CONFIG_DISP_PANEL2)
+    #if (CONFIG_DISP_PANEL2_EBI == CONFIG_DISP_EBI)
+        #error "Both panels on one bank mirror in hardware, CONFIG_DISP_PANEL2 needs another bank."
+    #endif
+    #if (CONFIG_DISP_PANEL2_EBI != EBI_BANK1)
+        #error "board.c routes EBI_nCS1 to PD11 for the second panel only."
+    #endif
+    #if defined(CONFIG_DISP_VRAM_IN_HYPERRAM) || defined(CONFIG_DISP_VRAM_BANKED)
+        #error "CONFIG_DISP_PANEL2 scans both panels out of the SRAM VRAM, it cannot be used with CONFIG_DISP_VRAM_IN_HYPERRAM or CONFIG_DISP_VRAM_BANKED."
+    #endif
+    #define DEF_PANEL_NUM      (2)
+#else
+    #define DEF_PANEL_NUM      (1)
+#endif
+
+#if defined(CONFIG_DISP_I80)
+    #if defined(CONFIG_DISP_PANEL2)
+        #error "CONFIG_DISP_I80 drives one panel, it cannot be used with CONFIG_DISP_PANEL2."
+    #endif
+    #if (CONFIG_DISP_I80_DC_BITIDX < 1) || (CONFIG_DISP_I80_DC_BITIDX > 19)
+        #error "CONFIG_DISP_I80_DC_BITIDX must select EBI address bit 1 to 19."
+    #endif
+    #if (CONFIG_DISP_I80_FPS < 1) || (CONFIG_DISP_I80_FPS > 240)
+        #error "CONFIG_DISP_I80_FPS must be 1 to 240."
+    #endif
+#endif
+
+#if defined(CONFIG_DISP_RING_IMAGE) && defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    #error "CONFIG_DISP_RING_IMAGE scans the VRAM directly, it cannot be used with CONFIG_DISP_VRAM_IN_HYPERRAM."
+#endif
+
+#if defined(CONFIG_DISP_IMAGE_COMPRESSED) && defined(CONFIG_DISP_SPLASH_IN_FLASH)
+    #error "CONFIG_DISP_SPLASH_IN_FLASH scans out raw images, it cannot be used with CONFIG_DISP_IMAGE_COMPRESSED."
+#endif
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    #define DISP_VRAM_SECTION                __attribute__((section(".bss.HyperRAM")))   /*!< Placed VRAM in the HYPERRAM region of M55M1.scatter */
+#else
+    #define DISP_VRAM_SECTION
+#endif
+
 
 #if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
     #define DEF_TOTAL_VLINES   (CONFIG_TIMING_VACT)
@@ -95,10 +184,106 @@ void disp_set_vrambufaddr(void *pvBufAddr);
 // Function to get the VRAM buffer address
 void *disp_get_vrambufaddr(void);
 
+// Function to get the address of a VRAM buffer, NULL if i32Idx is not below CONFIG_VRAM_BUF_NUM
+void *disp_get_vrambuf(int i32Idx);
+
+#if defined(CONFIG_DISP_PANEL2)
+// Function to set the VRAM buffer address of the second panel, ignored while it mirrors the first
+void disp_panel2_set_vrambufaddr(void *pvBufAddr);
+
+// Function to get the VRAM buffer address of the second panel
+void *disp_panel2_get_vrambufaddr(void);
+
+// Function to get the address of a VRAM buffer of the second panel, NULL if i32Idx is not below CONFIG_VRAM_BUF_NUM or it mirrors the first
+void *disp_panel2_get_vrambuf(int i32Idx);
+#endif
+
+// Function to get the image the scanout starts with, the weak backend default returns NULL for VRAM buffer 0
+const void *disp_get_splash(void);
+
+// Function to start a background copy on a spare DMA channel of the backend, negative if none is free
+int disp_dma_copy(void *pvDst, const void *pvSrc, uint32_t u32Size);
+
+// Function to start a background copy of a rectangle of RGB565 pixels, pitches in pixels. Negative if no channel is free or the rectangle is too tall
+int disp_dma_copy_rect(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32Width, uint32_t u32Height);
+
+// Function to check the background copy, 1 while busy, 0 when done, negative on failure
+int disp_dma_copy_poll(void);
+
+// Function to be called from the interrupt when a background swap ends, i32Result 0 on success, negative on failure
+typedef void(*DispDmaDoneCb)(void *pvUser, int i32Result);
+
+// Function to start a background byte swap of RGB565 pixels between big- and little-endian order, negative if no channel is free or the backend cannot swap.
+// Shares the channel of disp_dma_copy(), pfnDone may be NULL and disp_dma_copy_poll() tells the end as for a copy
+int disp_dma_swap565(void *pvDst, const void *pvSrc, uint32_t u32Pixels, DispDmaDoneCb pfnDone, void *pvUser);
+
+// Function to send a window of the VRAM buffer being shown to a panel with its own GRAM, it shows at a later blank.
+// Sync panels rescan the VRAM every frame and return 0 at once. Negative if the window is outside the panel or no backend runs
+int disp_update_rect(uint32_t u32X, uint32_t u32Y, uint32_t u32Width, uint32_t u32Height);
+
 // Function to set the blank callback function
 typedef void(*DispBlankCb)(void *p);
 void disp_set_blankcb(DispBlankCb f);
 
+// Function to get the blank callback function
+DispBlankCb disp_get_blankcb(void);
+
+// Scanout ring statistics
+typedef struct
+{
+    const char *m_szBackend;        /*!< Backend name */
+    uint32_t    m_u32DscNum;        /*!< Number of descriptors in the ring */
+    uint32_t    m_u32DscSize;       /*!< Bytes of one descriptor */
+    uint32_t    m_u32RingSize;      /*!< Bytes of the whole ring */
+    uint32_t    m_u32FetchSize;     /*!< Bytes the DMA fetches to walk the ring once */
+    uint32_t    m_u32BuildCycles;   /*!< Cycles spent building the ring */
+    uint32_t    m_u32FlipCycles;    /*!< Cycles of the last blank-time buffer switch */
+    uint32_t    m_u32FlipMaxCycles; /*!< Worst cycles of the blank-time buffer switch */
+    uint32_t    m_u32BlankCount;    /*!< Number of blank interrupts */
+    uint32_t    m_u32BlankStamp;    /*!< Cycle count of the last blank interrupt, see nu_cyccnt.h */
+    uint32_t    m_u32IsrCycles;     /*!< Cycles spent in the scanout interrupts, line-interrupts included */
+    uint32_t    m_u32IsrMaxCycles;  /*!< Worst cycles of one scanout interrupt */
+} S_DISP_RINGINFO;
+
+// Function to get the scanout ring statistics
+void disp_get_ringinfo(S_DISP_RINGINFO *psInfo);
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+// Function to copy one line into an SRAM line buffer, the backend calls disp_prefetch_copy_done() on completion
+typedef int(*DispPrefetchCopy)(void *pvDst, const void *pvSrc, uint32_t u32Size);
+
+// Line prefetcher statistics
+typedef struct
+{
+    uint32_t m_u32Frames;           /*!< Frames started */
+    uint32_t m_u32Lines;            /*!< Lines copied into the line buffers */
+    uint32_t m_u32Underruns;        /*!< Lines not ready when the scanout reached them */
+    uint32_t m_u32CopyErrors;       /*!< Line copies the DMA refused */
+} S_DISP_PREFETCH_STATS;
+
+// Function to initialize the line prefetcher with the backend copy function
+void disp_prefetch_init(DispPrefetchCopy pfnCopy);
+
+// Function to get the SRAM line buffer the ring scans out for an active line
+uint16_t *disp_prefetch_get_linebuf(int i32Line);
+
+// Function to restart the prefetch on a VRAM buffer at the vertical blank
+void disp_prefetch_frame(const uint16_t *pu16Frame);
+
+// Function to advance the prefetch from the ring descriptor the scanout is on, returns the line or CONFIG_TIMING_VACT at the end of the frame
+int disp_prefetch_scanline(uint32_t u32DscIdx);
+
+// Function to complete the line copy in flight
+void disp_prefetch_copy_done(void);
+
+// Function to get the line prefetcher statistics
+void disp_prefetch_get_stats(S_DISP_PREFETCH_STATS *psStats);
+
+#endif
+
+#if !defined(CONFIG_DISP_VRAM_BANKED)
 extern uint8_t g_au8FrameBuf[CONFIG_VRAM_TOTAL_ALLOCATED_SIZE];
+#endif
 
 #endif /* __DISP_H__ */
@@ -0,0 +1,536 @@
+/**************************************************************************//**
+ * @file     disp_anim.c
+ * @brief    Sequence player. Frame n of the sequence is due n frame periods
+ *           after the first frame was ready. disp_anim_poll() prepares the
+ *           frames in order into free VRAM buffers and queues them, skipping
+ *           those due before the preparation could finish. The blank
+ *           callback sets the queued frame due nearest the next blank, which
+ *           the backend latches there, and drops queued frames overtaken by
+ *           a later one. Frames scanned out in place need no preparation and
+ *           are queued from the blank callback as well, so such sequences
+ *           play without polling.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp.h"
+#include "disp_anim.h"
+#include "disp_image.h"
+#include "disp_surface.h"
+#include "nu_cyccnt.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+typedef enum
+{
+    evAnimBufFree,          /*!< Free to prepare a frame in */
+    evAnimBufPrep,          /*!< Frame being copied or decoded */
+    evAnimBufReady,         /*!< Queued */
+    evAnimBufPending,       /*!< The ring switches to it at the next blank */
+    evAnimBufScanout,       /*!< Scanned out */
+    evAnimBufDirect         /*!< Holds a frame of the sequence scanned out in place, never prepared into */
+} E_ANIM_BUF_STATE;
+
+// Frame ready to be shown
+typedef struct
+{
+    uint32_t m_u32Seq;      /*!< Index in the sequence, loops included */
+    int      m_i32Buf;      /*!< VRAM buffer holding it, -1 if scanned out in place */
+    void    *m_pvAddr;      /*!< Address to scan out, NULL for none */
+} S_ANIM_ENTRY;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static const S_DISP_ANIM_FRAME *s_psFrames = NULL;
+static uint32_t s_u32FrameNum = 0;
+static uint32_t s_u32SeqTotal = 0;                  // Frames to play, 0 for forever.
+static uint32_t s_u32Period = 0;                    // Cycles between due times.
+static volatile uint32_t s_u32T0 = 0;               // Due time of frame 0.
+static volatile int s_bTimeBase = 0;
+
+static volatile E_ANIM_BUF_STATE s_aevBufState[CONFIG_VRAM_BUF_NUM];
+static volatile S_ANIM_ENTRY s_asQueue[CONFIG_VRAM_BUF_NUM];
+static volatile uint32_t s_u32QueueHead = 0;
+static volatile uint32_t s_u32QueueNum = 0;
+static volatile S_ANIM_ENTRY s_sPending;
+static volatile uint32_t s_u32NextSeq = 0;          // Next frame to prepare or queue.
+static volatile int s_i32ScanoutBuf = -1;
+static volatile uint32_t s_u32ShownSeq = 0;
+static volatile int s_bShown = 0;
+static volatile int s_bDone = 0;
+static volatile uint32_t s_u32LastBlank = 0;
+static volatile uint32_t s_u32BlankPeriod = 0;      // Cycles between the last two blanks, 0 until measured.
+
+static volatile int s_i32PrepBuf = -1;              // VRAM buffer being prepared, -1 for none.
+static uint32_t s_u32PrepSeq = 0;
+static uint32_t s_u32PrepStart = 0;
+static uint32_t s_u32PrepEst = 0;                   // Running estimate of the cycles to prepare a frame.
+static int s_bPrepDma = 0;
+static S_DISP_IMAGE_DEC s_sDec;
+static S_DISP_SURFACE s_asSurface[CONFIG_VRAM_BUF_NUM];
+
+static DispBlankCb s_pfnPrevBlankCb = NULL;
+static volatile int s_bInit = 0;
+static volatile S_DISP_ANIM_STATS s_sStats;
+static volatile uint32_t s_u32FirstShown = 0;
+static volatile uint32_t s_u32LastShown = 0;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to get the due time of a frame of the sequence
+static uint32_t anim_due(uint32_t u32Seq)
+{
+    return s_u32T0 + u32Seq * s_u32Period;
+}
+
+// Function to check a frame is part of the sequence
+static int anim_has(uint32_t u32Seq)
+{
+    return (s_u32SeqTotal == 0) || (u32Seq < s_u32SeqTotal);
+}
+
+// Function to get the frame of the sequence
+static const S_DISP_ANIM_FRAME *anim_frame(uint32_t u32Seq)
+{
+    return &s_psFrames[u32Seq % s_u32FrameNum];
+}
+
+// Function to get the VRAM buffer index of an address, -1 if it is not a VRAM buffer
+static int anim_index_of(const void *pvAddr)
+{
+    int i;
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+    {
+        if (disp_get_vrambuf(i) == pvAddr)
+            return i;
+    }
+
+    return -1;
+}
+
+// Function to queue a ready frame, interrupts masked
+static void anim_queue_push(uint32_t u32Seq, int i32Buf, void *pvAddr)
+{
+    volatile S_ANIM_ENTRY *psEntry = &s_asQueue[(s_u32QueueHead + s_u32QueueNum) % CONFIG_VRAM_BUF_NUM];
+
+    /* The timeline starts with the first frame ready. */
+    if (!s_bTimeBase)
+    {
+        s_u32T0 = nu_cyccnt_get();
+        s_bTimeBase = 1;
+    }
+
+    psEntry->m_u32Seq = u32Seq;
+    psEntry->m_i32Buf = i32Buf;
+    psEntry->m_pvAddr = pvAddr;
+    s_u32QueueNum++;
+
+    if (i32Buf >= 0)
+        s_aevBufState[i32Buf] = evAnimBufReady;
+}
+
+// Function to drop the queue head, interrupts masked
+static void anim_queue_drop(void)
+{
+    int i32Buf = s_asQueue[s_u32QueueHead].m_i32Buf;
+
+    if (i32Buf >= 0)
+        s_aevBufState[i32Buf] = evAnimBufFree;
+
+    s_u32QueueHead = (s_u32QueueHead + 1) % CONFIG_VRAM_BUF_NUM;
+    s_u32QueueNum--;
+}
+
+// Function to skip the frames a later one overtakes before preparation could finish, interrupts masked
+static void anim_skip_late(uint32_t u32Now, uint32_t u32PrepCycles)
+{
+    if (!s_bTimeBase)
+        return;
+
+    while (anim_has(s_u32NextSeq + 1) && ((int32_t)(anim_due(s_u32NextSeq + 1) - (u32Now + u32PrepCycles)) <= 0))
+    {
+        s_u32NextSeq++;
+        s_sStats.m_u32Dropped++;
+    }
+}
+
+// Function to queue the frames scanned out in place that come next, interrupts masked
+static void anim_fill_direct(uint32_t u32Now)
+{
+    /* A frame being prepared comes first. */
+    if (s_i32PrepBuf >= 0)
+        return;
+
+    anim_skip_late(u32Now, 0);
+
+    while (anim_has(s_u32NextSeq) && (anim_frame(s_u32NextSeq)->m_evSource == evDispAnimDirect) && (s_u32QueueNum < CONFIG_VRAM_BUF_NUM))
+    {
+        anim_queue_push(s_u32NextSeq, -1, (void *)anim_frame(s_u32NextSeq)->m_pvData);
+        s_u32NextSeq++;
+    }
+}
+
+// Function to make the queued frame due nearest to the next blank the pending one, runs in the blank callback
+static void anim_set_next(uint32_t u32Now)
+{
+    /* A frame set now is shown from the next blank, pick the one due nearest to it. */
+    uint32_t u32Horizon = u32Now + s_u32BlankPeriod + (s_u32BlankPeriod / 2);
+
+    while ((s_u32QueueNum >= 2) &&
+            ((int32_t)(anim_due(s_asQueue[(s_u32QueueHead + 1) % CONFIG_VRAM_BUF_NUM].m_u32Seq) - u32Horizon) <= 0))
+    {
+        anim_queue_drop();
+        s_sStats.m_u32Dropped++;
+    }
+
+    if ((int32_t)(anim_due(s_asQueue[s_u32QueueHead].m_u32Seq) - u32Horizon) <= 0)
+    {
+        s_sPending.m_u32Seq = s_asQueue[s_u32QueueHead].m_u32Seq;
+        s_sPending.m_i32Buf = s_asQueue[s_u32QueueHead].m_i32Buf;
+        s_sPending.m_pvAddr = s_asQueue[s_u32QueueHead].m_pvAddr;
+        s_u32QueueHead = (s_u32QueueHead + 1) % CONFIG_VRAM_BUF_NUM;
+        s_u32QueueNum--;
+
+        if (s_sPending.m_i32Buf >= 0)
+            s_aevBufState[s_sPending.m_i32Buf] = evAnimBufPending;
+
+        disp_set_vrambufaddr(s_sPending.m_pvAddr);
+    }
+}
+
+// Blank callback, runs in the scanout DMA interrupt
+static void anim_blankcb(void *p)
+{
+    S_DISP_RINGINFO sInfo;
+    uint32_t u32Now;
+    int bLatched = 0;
+
+    disp_get_ringinfo(&sInfo);
+    u32Now = sInfo.m_u32BlankStamp;
+
+    if (s_u32LastBlank)
+        s_u32BlankPeriod = u32Now - s_u32LastBlank;
+
+    s_u32LastBlank = u32Now;
+
+    if (s_sPending.m_pvAddr && (p == s_sPending.m_pvAddr))
+    {
+        /* The ring no longer refers to the old buffer from this blank on. */
+        if (s_i32ScanoutBuf >= 0)
+            s_aevBufState[s_i32ScanoutBuf] = evAnimBufFree;
+
+        s_i32ScanoutBuf = s_sPending.m_i32Buf;
+
+        if (s_i32ScanoutBuf >= 0)
+            s_aevBufState[s_i32ScanoutBuf] = evAnimBufScanout;
+
+        s_u32ShownSeq = s_sPending.m_u32Seq;
+        s_sPending.m_pvAddr = NULL;
+        bLatched = 1;
+
+        if (!s_bShown)
+            s_u32FirstShown = u32Now;
+
+        s_bShown = 1;
+        s_u32LastShown = u32Now;
+        s_sStats.m_u32Shown++;
+
+        if (!anim_has(s_u32ShownSeq + 1))
+            s_bDone = 1;
+    }
+
+    if (!bLatched && s_bShown && !s_bDone && ((int32_t)(anim_due(s_u32ShownSeq + 1) - u32Now) <= 0))
+        s_sStats.m_u32Repeated++;
+
+    anim_fill_direct(u32Now);
+
+    if (!s_sPending.m_pvAddr && s_u32QueueNum)
+        anim_set_next(u32Now);
+
+    if (s_pfnPrevBlankCb)
+        s_pfnPrevBlankCb(p);
+}
+
+// Function to copy a raw frame into a VRAM buffer with the CPU
+static void anim_copy_cpu(int i32Buf, const S_DISP_ANIM_FRAME *psFrame)
+{
+    if (psFrame->m_evSource == evDispAnimRGB565BE)
+    {
+        const uint16_t *pu16Src = (const uint16_t *)psFrame->m_pvData;
+        uint16_t *pu16Dst = s_asSurface[i32Buf].m_pu16Buf;
+        uint32_t i;
+
+        for (i = 0; i < (CONFIG_TIMING_HACT * CONFIG_TIMING_VACT); i++)
+            pu16Dst[i] = (uint16_t)((pu16Src[i] >> 8) | (pu16Src[i] << 8));
+    }
+    else
+    {
+        memcpy(s_asSurface[i32Buf].m_pu16Buf, psFrame->m_pvData, CONFIG_VRAM_BUF_SIZE);
+    }
+
+    disp_surface_mark_dirty(&s_asSurface[i32Buf], 0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+    disp_surface_flush(&s_asSurface[i32Buf]);
+}
+
+// Function to start preparing a frame in a VRAM buffer, returns negative if the frame does not fit the panel
+static int anim_prep_start(int i32Buf, const S_DISP_ANIM_FRAME *psFrame)
+{
+    s_bPrepDma = 0;
+
+    if (psFrame->m_evSource == evDispAnimQ565)
+    {
+        if (disp_image_open(&s_sDec, psFrame->m_pvData, psFrame->m_u32Size) < 0)
+            return -1;
+
+        if ((s_sDec.m_psHdr->m_u16Width != CONFIG_TIMING_HACT) || (s_sDec.m_psHdr->m_u16Height != CONFIG_TIMING_VACT))
+            return -1;
+
+        return 0;
+    }
+
+    if (psFrame->m_u32Size != CONFIG_VRAM_BUF_SIZE)
+        return -1;
+
+    /* No dirty line may be evicted over the data the DMA writes. */
+    SCB_CleanInvalidateDCache_by_Addr(s_asSurface[i32Buf].m_pu16Buf, CONFIG_VRAM_BUF_SIZE);
+
+    if (psFrame->m_evSource == evDispAnimRGB565BE)
+    {
+        if (disp_dma_swap565(s_asSurface[i32Buf].m_pu16Buf, psFrame->m_pvData, CONFIG_TIMING_HACT * CONFIG_TIMING_VACT, NULL, NULL) == 0)
+            s_bPrepDma = 1;
+        else
+            anim_copy_cpu(i32Buf, psFrame);
+    }
+    else if (disp_dma_copy(s_asSurface[i32Buf].m_pu16Buf, psFrame->m_pvData, CONFIG_VRAM_BUF_SIZE) == 0)
+        s_bPrepDma = 1;
+    else
+        anim_copy_cpu(i32Buf, psFrame);
+
+    return 0;
+}
+
+// Function to continue preparing a frame, returns 1 while busy, 0 when ready, negative on failure
+static int anim_prep_step(int i32Buf, const S_DISP_ANIM_FRAME *psFrame)
+{
+    S_DISP_SURFACE *psSurf = &s_asSurface[i32Buf];
+
+    if (psFrame->m_evSource == evDispAnimQ565)
+    {
+        int i32Row = s_sDec.m_i32Row;
+        int i32Rows = disp_image_decode_rows(&s_sDec, &psSurf->m_pu16Buf[i32Row * CONFIG_TIMING_HACT],
+                                             CONFIG_TIMING_HACT, CONFIG_DISP_IMAGE_POLL_ROWS);
+
+        if (i32Rows < 0)
+            return -1;
+
+        disp_surface_mark_dirty(psSurf, 0, i32Row, CONFIG_TIMING_HACT, i32Rows);
+        disp_surface_flush(psSurf);
+
+        return (s_sDec.m_i32Row < CONFIG_TIMING_VACT) ? 1 : 0;
+    }
+
+    if (s_bPrepDma)
+    {
+        int i32Ret = disp_dma_copy_poll();
+
+        if (i32Ret > 0)
+            return 1;
+
+        s_bPrepDma = 0;
+
+        /* The DMA gave up, finish the frame with the CPU. */
+        if (i32Ret < 0)
+            anim_copy_cpu(i32Buf, psFrame);
+    }
+
+    return 0;
+}
+
+// Function to start playing a sequence, u32Loops 0 repeats it forever. The frame list must stay valid while playing
+int disp_anim_play(const S_DISP_ANIM_FRAME *psFrames, uint32_t u32Num, uint32_t u32Fps, uint32_t u32Loops)
+{
+    uint32_t u32PriMask, i;
+
+    if (s_bInit || !psFrames || !u32Num || !u32Fps)
+        return -1;
+
+    for (i = 0; i < u32Num; i++)
+    {
+        if ((psFrames[i].m_evSource >= evDispAnimCNT) || !psFrames[i].m_pvData)
+            return -1;
+    }
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+        disp_surface_init(&s_asSurface[i], disp_get_vrambuf(i), CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    s_psFrames = psFrames;
+    s_u32FrameNum = u32Num;
+    s_u32SeqTotal = u32Num * u32Loops;
+    s_u32Period = nu_cyccnt_freq() / u32Fps;
+    s_bTimeBase = 0;
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+        s_aevBufState[i] = evAnimBufFree;
+
+    for (i = 0; i < u32Num; i++)
+    {
+        int i32Buf = anim_index_of(psFrames[i].m_pvData);
+
+        if ((psFrames[i].m_evSource == evDispAnimDirect) && (i32Buf >= 0))
+            s_aevBufState[i32Buf] = evAnimBufDirect;
+    }
+
+    s_u32QueueHead = 0;
+    s_u32QueueNum = 0;
+    s_sPending.m_pvAddr = NULL;
+    s_u32NextSeq = 0;
+    s_bShown = 0;
+    s_bDone = 0;
+    s_u32LastBlank = 0;
+    s_u32BlankPeriod = 0;
+    s_i32PrepBuf = -1;
+    s_u32PrepEst = 0;
+    s_bPrepDma = 0;
+    memset((void *)&s_sStats, 0, sizeof(s_sStats));
+
+    /* A splash outside the VRAM buffers needs no release. */
+    s_i32ScanoutBuf = anim_index_of(disp_get_vrambufaddr());
+
+    if ((s_i32ScanoutBuf >= 0) && (s_aevBufState[s_i32ScanoutBuf] == evAnimBufDirect))
+        s_i32ScanoutBuf = -1;
+
+    if (s_i32ScanoutBuf >= 0)
+        s_aevBufState[s_i32ScanoutBuf] = evAnimBufScanout;
+
+    anim_fill_direct(nu_cyccnt_get());
+
+    s_pfnPrevBlankCb = disp_get_blankcb();
+    disp_set_blankcb(anim_blankcb);
+    s_bInit = 1;
+
+    __set_PRIMASK(u32PriMask);
+
+    return 0;
+}
+
+// Function to prepare the next frames, returns COMPONENT_PENDING while playing, 0 once the last frame is shown, negative on failure
+int disp_anim_poll(void)
+{
+    uint32_t u32PriMask, u32Cycles;
+    int i32Ret;
+
+    if (!s_bInit)
+        return -1;
+
+    if (s_bDone)
+    {
+        disp_anim_stop();
+        return 0;
+    }
+
+    if (s_i32PrepBuf < 0)
+    {
+        int i, i32Buf = -1;
+
+        u32PriMask = __get_PRIMASK();
+        __disable_irq();
+
+        anim_skip_late(nu_cyccnt_get(), s_u32PrepEst);
+        anim_fill_direct(nu_cyccnt_get());
+
+        if (anim_has(s_u32NextSeq) && (anim_frame(s_u32NextSeq)->m_evSource != evDispAnimDirect) && (s_u32QueueNum < CONFIG_VRAM_BUF_NUM))
+        {
+            for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+            {
+                if (s_aevBufState[i] == evAnimBufFree)
+                {
+                    i32Buf = i;
+                    s_aevBufState[i] = evAnimBufPrep;
+                    s_i32PrepBuf = i;
+                    s_u32PrepSeq = s_u32NextSeq++;
+                    break;
+                }
+            }
+        }
+
+        __set_PRIMASK(u32PriMask);
+
+        /* Nothing to prepare, or every VRAM buffer is queued or on screen. */
+        if (i32Buf < 0)
+            return COMPONENT_PENDING;
+
+        s_u32PrepStart = nu_cyccnt_get();
+
+        if (anim_prep_start(i32Buf, anim_frame(s_u32PrepSeq)) < 0)
+        {
+            disp_anim_stop();
+            return -1;
+        }
+    }
+
+    i32Ret = anim_prep_step(s_i32PrepBuf, anim_frame(s_u32PrepSeq));
+
+    if (i32Ret < 0)
+    {
+        disp_anim_stop();
+        return -1;
+    }
+
+    if (i32Ret > 0)
+        return COMPONENT_PENDING;
+
+    u32Cycles = nu_cyccnt_get() - s_u32PrepStart;
+    s_u32PrepEst = s_u32PrepEst ? ((s_u32PrepEst * 3 + u32Cycles) / 4) : u32Cycles;
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    if (u32Cycles > s_sStats.m_u32PrepMaxCycles)
+        s_sStats.m_u32PrepMaxCycles = u32Cycles;
+
+    anim_queue_push(s_u32PrepSeq, s_i32PrepBuf, disp_get_vrambuf(s_i32PrepBuf));
+    s_i32PrepBuf = -1;
+
+    __set_PRIMASK(u32PriMask);
+
+    return COMPONENT_PENDING;
+}
+
+// Function to stop playing and hand the blank callback back, the frame on screen stays there
+void disp_anim_stop(void)
+{
+    if (!s_bInit)
+        return;
+
+    /* The buffer a copy is in flight to must not be reused early. */
+    while (s_bPrepDma && (disp_dma_copy_poll() > 0));
+
+    disp_set_blankcb(s_pfnPrevBlankCb);
+    s_pfnPrevBlankCb = NULL;
+    s_i32PrepBuf = -1;
+    s_bPrepDma = 0;
+    s_bInit = 0;
+}
+
+// Function to get the player statistics
+void disp_anim_get_stats(S_DISP_ANIM_STATS *psStats)
+{
+    uint32_t u32PriMask = __get_PRIMASK();
+    uint32_t u32Elapsed;
+
+    __disable_irq();
+    *psStats = s_sStats;
+    u32Elapsed = s_u32LastShown - s_u32FirstShown;
+    __set_PRIMASK(u32PriMask);
+
+    psStats->m_u32FpsX100 = ((psStats->m_u32Shown >= 2) && u32Elapsed) ?
+                            (uint32_t)(((uint64_t)(psStats->m_u32Shown - 1) * nu_cyccnt_freq() * 100) / u32Elapsed) : 0;
+}
@@ -0,0 +1,66 @@
+/**************************************************************************//**
+ * @file     disp_anim.h
+ * @brief    Sequence player for boot animations and status screens. Frames
+ *           are scanned out in place or copied or decoded into the free VRAM
+ *           buffers by disp_anim_poll(), the blank interrupt shows each one
+ *           at the blank nearest its due time. When preparing falls behind,
+ *           frames already overtaken are dropped and the last one stays on
+ *           screen. Not to be used with disp_swapchain.h, both own the blank
+ *           callback.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_ANIM_H__
+#define __DISP_ANIM_H__
+
+#include "NuMicro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    evDispAnimDirect,      /*!< Full-screen RGB565 the scanout reads in place, in RAM or flash */
+    evDispAnimRGB565,      /*!< Full-screen RGB565 copied into a VRAM buffer */
+    evDispAnimQ565,        /*!< Compressed full-screen image decoded into a VRAM buffer, see disp_image.h */
+    evDispAnimRGB565BE,    /*!< Full-screen RGB565 with the high byte first, swapped into a VRAM buffer */
+    evDispAnimCNT          /*!< Number of frame sources */
+} E_DISP_ANIM_SOURCE;
+
+// One frame of a sequence
+typedef struct
+{
+    E_DISP_ANIM_SOURCE m_evSource;
+    const void        *m_pvData;
+    uint32_t           m_u32Size;      /*!< Bytes at m_pvData */
+} S_DISP_ANIM_FRAME;
+
+// Player statistics
+typedef struct
+{
+    uint32_t m_u32Shown;           /*!< Frames the scanout switched to */
+    uint32_t m_u32Dropped;         /*!< Frames skipped because a later one was already due */
+    uint32_t m_u32Repeated;        /*!< Blanks a frame stayed on screen after the next one was due */
+    uint32_t m_u32PrepMaxCycles;   /*!< Worst cycles spent preparing a frame, polls included */
+    uint32_t m_u32FpsX100;         /*!< Effective frames per second x100 over the frames shown */
+} S_DISP_ANIM_STATS;
+
+// Function to start playing a sequence, u32Loops 0 repeats it forever. The frame list must stay valid while playing
+int disp_anim_play(const S_DISP_ANIM_FRAME *psFrames, uint32_t u32Num, uint32_t u32Fps, uint32_t u32Loops);
+
+// Function to prepare the next frames, returns COMPONENT_PENDING while playing, 0 once the last frame is shown, negative on failure
+int disp_anim_poll(void);
+
+// Function to stop playing and hand the blank callback back, the frame on screen stays there
+void disp_anim_stop(void);
+
+// Function to get the player statistics
+void disp_anim_get_stats(S_DISP_ANIM_STATS *psStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_ANIM_H__ */
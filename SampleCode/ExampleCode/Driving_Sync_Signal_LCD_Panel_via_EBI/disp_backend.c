@@ -0,0 +1,314 @@
+/**************************************************************************//**
+ * @file     disp_backend.c
+ * @brief    Route the display API of disp.h to the running scanout backend.
+ *           The VRAM buffers, the buffer being scanned out and the blank
+ *           callback live here, so they outlast a backend switch. Backends
+ *           the target does not link resolve to NULL.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp.h"
+#include "disp_backend.h"
+#include "sram_bank.h"
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+#if defined(CONFIG_DISP_VRAM_BANKED)
+    /* Scanout reads one bank while the CPU renders into the other, see SRAM_BANK_PLACEMENT in M55M1.scatter. */
+    NVT_SRAM_BANK0 static uint8_t s_au8FrameBuf0[CONFIG_VRAM_BUF_SIZE] __attribute__((aligned(DCACHE_LINE_SIZE)));
+    NVT_SRAM_BANK1 static uint8_t s_au8FrameBuf1[CONFIG_VRAM_BUF_SIZE] __attribute__((aligned(DCACHE_LINE_SIZE)));
+    static uint8_t *const s_apu8FrameBuf[CONFIG_VRAM_BUF_NUM] = { s_au8FrameBuf0, s_au8FrameBuf1 };
+#else
+    DISP_VRAM_SECTION uint8_t g_au8FrameBuf[CONFIG_VRAM_TOTAL_ALLOCATED_SIZE] __attribute__((aligned(DCACHE_LINE_SIZE))); // Declare VRAM instance.
+    static uint8_t *const s_apu8FrameBuf[CONFIG_VRAM_BUF_NUM] =
+    {
+        &g_au8FrameBuf[0],
+        &g_au8FrameBuf[CONFIG_VRAM_BUF_SIZE],
+#if (CONFIG_VRAM_BUF_NUM > 2)
+        &g_au8FrameBuf[2 * CONFIG_VRAM_BUF_SIZE],
+#endif
+#if (CONFIG_VRAM_BUF_NUM > 3)
+        &g_au8FrameBuf[3 * CONFIG_VRAM_BUF_SIZE],
+#endif
+    };
+#endif
+
+#if defined(CONFIG_DISP_PANEL2) && !CONFIG_DISP_PANEL2_MIRROR
+    DISP_VRAM_SECTION static uint8_t s_au8FrameBuf2[CONFIG_VRAM_TOTAL_ALLOCATED_SIZE] __attribute__((aligned(DCACHE_LINE_SIZE)));
+    static uint8_t *const s_apu8FrameBuf2[CONFIG_VRAM_BUF_NUM] =
+    {
+        &s_au8FrameBuf2[0],
+        &s_au8FrameBuf2[CONFIG_VRAM_BUF_SIZE],
+#if (CONFIG_VRAM_BUF_NUM > 2)
+        &s_au8FrameBuf2[2 * CONFIG_VRAM_BUF_SIZE],
+#endif
+#if (CONFIG_VRAM_BUF_NUM > 3)
+        &s_au8FrameBuf2[3 * CONFIG_VRAM_BUF_SIZE],
+#endif
+    };
+#endif
+
+/* Only the backend files of the target are linked, the others stay NULL. */
+extern __WEAK const S_DISP_BACKEND g_sDispBackendPDMA;
+extern __WEAK const S_DISP_BACKEND g_sDispBackendGDMA;
+extern __WEAK const S_DISP_BACKEND g_sDispBackendI80;
+
+#if defined(CONFIG_DISP_I80)
+/* An i80 panel has no sync inputs, the sync backends would only write garbage into its GRAM. */
+static const S_DISP_BACKEND *const s_apsDispBackend[evDispBackendCNT] =
+{
+    NULL,
+    NULL,
+    &g_sDispBackendI80
+};
+#else
+static const S_DISP_BACKEND *const s_apsDispBackend[evDispBackendCNT] =
+{
+    &g_sDispBackendPDMA,
+    &g_sDispBackendGDMA,
+    &g_sDispBackendI80
+};
+#endif
+
+static const S_DISP_BACKEND *s_psDispBackend = NULL;
+static E_DISP_BACKEND s_evDispBackend = evDispBackendCNT;
+static void *volatile s_pvBufAddr = NULL;
+#if defined(CONFIG_DISP_PANEL2) && !CONFIG_DISP_PANEL2_MIRROR
+    static void *volatile s_pvBufAddr2 = NULL;
+#endif
+static DispBlankCb s_DispBlankCb = NULL;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to get the operations of a backend, NULL if the target does not link it
+const S_DISP_BACKEND *disp_backend_get(E_DISP_BACKEND evBackend)
+{
+    if ((evBackend < 0) || (evBackend >= evDispBackendCNT))
+        return NULL;
+
+    return s_apsDispBackend[evBackend];
+}
+
+// Function to get the running backend, evDispBackendCNT if none
+E_DISP_BACKEND disp_backend_current(void)
+{
+    return s_evDispBackend;
+}
+
+// Function to stop the running backend and start another on the buffer being scanned out, evDispBackendCNT only stops. Negative on failure, the running backend is then kept or restarted
+int disp_backend_select(E_DISP_BACKEND evBackend)
+{
+    const S_DISP_BACKEND *psBackend = disp_backend_get(evBackend);
+    const S_DISP_BACKEND *psPrev = s_psDispBackend;
+    E_DISP_BACKEND evPrev = s_evDispBackend;
+
+    if (!psBackend && (evBackend != evDispBackendCNT))
+        return -1;
+
+#if defined(CONFIG_DISP_PANEL2)
+
+    /* A backend without a second ring would leave the second panel dark, refuse it before the running one stops. */
+    if (psBackend && !psBackend->m_pfnFlip2)
+        return -1;
+
+#endif
+
+    if (psPrev)
+    {
+        /* The blank interrupts of the old ring end here, flips wait for the new one. */
+        psPrev->m_pfnFini();
+        s_psDispBackend = NULL;
+        s_evDispBackend = evDispBackendCNT;
+    }
+
+    if (!psBackend)
+        return 0;
+
+    if (psBackend->m_pfnInit(s_pvBufAddr) < 0)
+    {
+        psBackend->m_pfnFini();
+
+        /* Keep the panel lit on the backend that ran before. */
+        if (psPrev && (psPrev->m_pfnInit(s_pvBufAddr) == 0))
+        {
+            s_psDispBackend = psPrev;
+            s_evDispBackend = evPrev;
+        }
+        else if (psPrev)
+        {
+            psPrev->m_pfnFini();
+        }
+
+        return -1;
+    }
+
+    s_psDispBackend = psBackend;
+    s_evDispBackend = evBackend;
+
+    return 0;
+}
+
+// Function to start the boot backend, the first linked one that starts if CONFIG_DISP_BACKEND does not
+static int disp_backend_init(void)
+{
+    int i;
+
+    /* Start on the splash image if there is one, the VRAM buffer otherwise. */
+    s_pvBufAddr = disp_get_splash() ? (void *)disp_get_splash() : (void *)s_apu8FrameBuf[0];
+#if defined(CONFIG_DISP_PANEL2) && !CONFIG_DISP_PANEL2_MIRROR
+    s_pvBufAddr2 = (void *)s_apu8FrameBuf2[0];
+#endif
+
+    if (disp_backend_get(CONFIG_DISP_BACKEND) && (disp_backend_select(CONFIG_DISP_BACKEND) == 0))
+        return 0;
+
+    for (i = 0; i < evDispBackendCNT; i++)
+    {
+        if ((i != CONFIG_DISP_BACKEND) && disp_backend_get((E_DISP_BACKEND)i) && (disp_backend_select((E_DISP_BACKEND)i) == 0))
+            return 0;
+    }
+
+    return -1;
+}
+
+// Function to stop the running backend
+static int disp_backend_fini(void)
+{
+    return disp_backend_select(evDispBackendCNT);
+}
+
+// Function to set the VRAM buffer address
+void disp_set_vrambufaddr(void *pvBufAddr)
+{
+    s_pvBufAddr = pvBufAddr;
+
+    if (s_psDispBackend)
+        s_psDispBackend->m_pfnFlip(pvBufAddr);
+}
+
+// Function to get the VRAM buffer address
+void *disp_get_vrambufaddr(void)
+{
+    return s_pvBufAddr;
+}
+
+#if defined(CONFIG_DISP_PANEL2)
+
+// Function to set the VRAM buffer address of the second panel, ignored while it mirrors the first
+void disp_panel2_set_vrambufaddr(void *pvBufAddr)
+{
+#if CONFIG_DISP_PANEL2_MIRROR
+    (void)pvBufAddr;
+#else
+    s_pvBufAddr2 = pvBufAddr;
+
+    if (s_psDispBackend)
+        s_psDispBackend->m_pfnFlip2(pvBufAddr);
+#endif
+}
+
+// Function to get the VRAM buffer address of the second panel
+void *disp_panel2_get_vrambufaddr(void)
+{
+#if CONFIG_DISP_PANEL2_MIRROR
+    return s_pvBufAddr;
+#else
+    return s_pvBufAddr2;
+#endif
+}
+
+// Function to get the address of a VRAM buffer of the second panel, NULL if i32Idx is not below CONFIG_VRAM_BUF_NUM or it mirrors the first
+void *disp_panel2_get_vrambuf(int i32Idx)
+{
+#if CONFIG_DISP_PANEL2_MIRROR
+    (void)i32Idx;
+    return NULL;
+#else
+    if ((i32Idx < 0) || (i32Idx >= CONFIG_VRAM_BUF_NUM))
+        return NULL;
+
+    return (void *)s_apu8FrameBuf2[i32Idx];
+#endif
+}
+
+#endif
+
+// Function to get the image the scanout starts with, NULL for VRAM buffer 0
+__WEAK const void *disp_get_splash(void)
+{
+    return NULL;
+}
+
+// Function to get the address of a VRAM buffer
+void *disp_get_vrambuf(int i32Idx)
+{
+    if ((i32Idx < 0) || (i32Idx >= CONFIG_VRAM_BUF_NUM))
+        return NULL;
+
+    return (void *)s_apu8FrameBuf[i32Idx];
+}
+
+// Function to start a background copy on a spare DMA channel of the backend, negative if none is free
+int disp_dma_copy(void *pvDst, const void *pvSrc, uint32_t u32Size)
+{
+    return s_psDispBackend ? s_psDispBackend->m_pfnDmaCopy(pvDst, pvSrc, u32Size) : -1;
+}
+
+// Function to start a background copy of a rectangle of RGB565 pixels, pitches in pixels. Negative if no channel is free or the rectangle is too tall
+int disp_dma_copy_rect(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32Width, uint32_t u32Height)
+{
+    return s_psDispBackend ? s_psDispBackend->m_pfnDmaCopyRect(pvDst, u32DstPitch, pvSrc, u32SrcPitch, u32Width, u32Height) : -1;
+}
+
+// Function to check the background copy, 1 while busy, 0 when done, negative on failure
+int disp_dma_copy_poll(void)
+{
+    return s_psDispBackend ? s_psDispBackend->m_pfnDmaCopyPoll() : -1;
+}
+
+// Function to start a background byte swap of RGB565 pixels between big- and little-endian order, negative if no channel is free or the backend cannot swap
+int disp_dma_swap565(void *pvDst, const void *pvSrc, uint32_t u32Pixels, DispDmaDoneCb pfnDone, void *pvUser)
+{
+    return s_psDispBackend ? s_psDispBackend->m_pfnDmaSwap565(pvDst, pvSrc, u32Pixels, pfnDone, pvUser) : -1;
+}
+
+// Function to send a window of the VRAM buffer being shown to a panel with its own GRAM, 0 at once on sync panels
+int disp_update_rect(uint32_t u32X, uint32_t u32Y, uint32_t u32Width, uint32_t u32Height)
+{
+    if (!u32Width || !u32Height || (u32X >= CONFIG_TIMING_HACT) || (u32Y >= CONFIG_TIMING_VACT) ||
+            (u32Width > (CONFIG_TIMING_HACT - u32X)) || (u32Height > (CONFIG_TIMING_VACT - u32Y)) || !s_psDispBackend)
+        return -1;
+
+    /* The sync rings fetch every pixel each frame, the change is on its way already. */
+    if (!s_psDispBackend->m_pfnUpdateRect)
+        return 0;
+
+    return s_psDispBackend->m_pfnUpdateRect(u32X, u32Y, u32Width, u32Height);
+}
+
+// Function to set the blank callback function
+void disp_set_blankcb(DispBlankCb f)
+{
+    s_DispBlankCb = f;
+}
+
+// Function to get the blank callback function
+DispBlankCb disp_get_blankcb(void)
+{
+    return s_DispBlankCb;
+}
+
+// Function to get the scanout ring statistics, all zero while no backend runs
+void disp_get_ringinfo(S_DISP_RINGINFO *psInfo)
+{
+    if (s_psDispBackend)
+        s_psDispBackend->m_pfnGetRingInfo(psInfo);
+    else
+        memset(psInfo, 0, sizeof(S_DISP_RINGINFO));
+}
+
+COMPONENT_EXPORT("DISP_SYNC", disp_backend_init, disp_backend_fini);
@@ -0,0 +1,80 @@
+/**************************************************************************//**
+ * @file     disp_backend.h
+ * @brief    Scanout backend interface. disp_sync_pdma.c, disp_sync_gdma.c
+ *           and disp_i80_pdma.c each export an operation table, disp_backend.c
+ *           owns the VRAM and the blank callback and routes the disp.h API to
+ *           the running one. A target linking several backends starts
+ *           CONFIG_DISP_BACKEND and switches with disp_backend_select().
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_BACKEND_H__
+#define __DISP_BACKEND_H__
+
+#include "disp.h"
+#include "nu_cyccnt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+typedef enum
+{
+    evDispBackendPDMA,       /*!< disp_sync_pdma.c, DSCT_T scatter-gather ring */
+    evDispBackendGDMA,       /*!< disp_sync_gdma.c, DMA-350 command-link ring */
+    evDispBackendI80,        /*!< disp_i80_pdma.c, PDMA window writes into the GRAM of an i80 panel */
+    evDispBackendCNT         /*!< Number of backends, also no backend running */
+} E_DISP_BACKEND;
+
+// Scanout backend operations
+typedef struct
+{
+    const char *m_szName;
+    int (*m_pfnInit)(void *pvBufAddr);                /*!< Build the ring on a buffer and start the scanout */
+    int (*m_pfnFini)(void);                           /*!< Stop the scanout and release the DMA */
+    void (*m_pfnFlip)(void *pvBufAddr);               /*!< Scan out another buffer from the next blank */
+    int (*m_pfnDmaCopy)(void *pvDst, const void *pvSrc, uint32_t u32Size);
+    int (*m_pfnDmaCopyRect)(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32Width, uint32_t u32Height);
+    int (*m_pfnDmaCopyPoll)(void);
+    int (*m_pfnDmaSwap565)(void *pvDst, const void *pvSrc, uint32_t u32Pixels, DispDmaDoneCb pfnDone, void *pvUser);
+    void (*m_pfnGetRingInfo)(S_DISP_RINGINFO *psInfo);
+    void (*m_pfnFlip2)(void *pvBufAddr);              /*!< Scan out another buffer on the second panel, NULL if the backend drives one panel */
+    int (*m_pfnUpdateRect)(uint32_t u32X, uint32_t u32Y, uint32_t u32Width, uint32_t u32Height);   /*!< Send a window to the panel GRAM, NULL if the scanout rescans the VRAM */
+} S_DISP_BACKEND;
+
+extern const S_DISP_BACKEND g_sDispBackendPDMA;
+extern const S_DISP_BACKEND g_sDispBackendGDMA;
+extern const S_DISP_BACKEND g_sDispBackendI80;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to get the operations of a backend, NULL if the target does not link it
+const S_DISP_BACKEND *disp_backend_get(E_DISP_BACKEND evBackend);
+
+// Function to get the running backend, evDispBackendCNT if none
+E_DISP_BACKEND disp_backend_current(void);
+
+// Function to stop the running backend and start another on the buffer being scanned out, evDispBackendCNT only stops. Negative on failure, the running backend is then kept or restarted
+int disp_backend_select(E_DISP_BACKEND evBackend);
+
+// Function to account one scanout interrupt of a backend in its ring statistics
+__STATIC_INLINE void disp_backend_isr_done(S_DISP_RINGINFO *psInfo, uint32_t u32Start)
+{
+    uint32_t u32Cycles = nu_cyccnt_get() - u32Start;
+
+    psInfo->m_u32IsrCycles += u32Cycles;
+
+    if (u32Cycles > psInfo->m_u32IsrMaxCycles)
+        psInfo->m_u32IsrMaxCycles = u32Cycles;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_BACKEND_H__ */
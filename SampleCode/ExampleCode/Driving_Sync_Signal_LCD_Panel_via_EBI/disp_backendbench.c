@@ -0,0 +1,210 @@
+/**************************************************************************//**
+ * @file     disp_backendbench.c
+ * @brief    Compare the scanout backends linked in the target over the UART
+ *           console. Enable CONFIG_DISP_BACKENDBENCH in disp.h and link both
+ *           disp_sync_pdma.c and disp_sync_gdma.c. Each backend scans out
+ *           for CONFIG_DISP_BACKENDBENCH_FRAMES blanks while the CPU fills a
+ *           spare VRAM buffer, a run with the scanout stopped gives the
+ *           unloaded fill rate. The boot backend is restarted at the end, the
+ *           spare VRAM buffer is overwritten.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "disp_backend.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_BACKENDBENCH)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_BACKENDBENCH_IDLE_PASSES    16    /*!< Fill passes of the run without scanout */
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to convert counter ticks to nanoseconds
+static uint32_t backendbench_ticks_to_ns(uint32_t u32Ticks)
+{
+    return (uint32_t)(((uint64_t)u32Ticks * 1000000000ULL) / nu_cyccnt_freq());
+}
+
+// Function to fill a VRAM buffer and clean it out of the D-cache
+static void backendbench_fill(uint32_t *pu32Dst, uint32_t u32Seed)
+{
+    uint32_t u32Pixel = u32Seed * 0x00010001UL;
+    int i;
+
+    for (i = 0; i < (CONFIG_VRAM_BUF_SIZE / sizeof(uint32_t)); i++)
+    {
+        pu32Dst[i] = u32Pixel;
+        u32Pixel += 0x00010001UL;
+    }
+
+    /* The fill is not done until the pixels reach the SRAM. */
+    SCB_CleanDCache_by_Addr(pu32Dst, CONFIG_VRAM_BUF_SIZE);
+}
+
+// Function to get a VRAM buffer the scanout does not read
+static uint32_t *backendbench_spare_buf(void)
+{
+    int i;
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+    {
+        if (disp_get_vrambuf(i) != disp_get_vrambufaddr())
+            return (uint32_t *)disp_get_vrambuf(i);
+    }
+
+    return NULL;
+}
+
+// Function to convert filled bytes over cycles into KB/s
+static uint32_t backendbench_kbps(uint64_t u64Bytes, uint32_t u32Cycles)
+{
+    return u32Cycles ? (uint32_t)((u64Bytes * nu_cyccnt_freq()) / ((uint64_t)u32Cycles * 1024ULL)) : 0;
+}
+
+// Function to print the report header
+static void backendbench_print_header(void)
+{
+    printf("%-7s %6s %6s %8s %11s %7s %10s %8s %8s\n",
+           "Backend", "Frames", "FPS", "ISR(us)", "ISRMax(us)", "ISR(%)", "Fill(MB/s)", "Ring(B)", "Fetch(B)");
+}
+
+// Function to measure the fill rate with the scanout stopped
+static void backendbench_idle(uint32_t *pu32Target)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32KBps;
+    int i;
+
+    for (i = 0; i < DEF_BACKENDBENCH_IDLE_PASSES; i++)
+        backendbench_fill(pu32Target, (uint32_t)i);
+
+    u32KBps = backendbench_kbps((uint64_t)DEF_BACKENDBENCH_IDLE_PASSES * CONFIG_VRAM_BUF_SIZE, nu_cyccnt_get() - u32Start);
+
+    printf("%-7s %6s %6s %8s %11s %7s %7u.%02u %8s %8s\n",
+           "None", "-", "-", "-", "-", "-", u32KBps / 1024, ((u32KBps % 1024) * 100) / 1024, "-", "-");
+}
+
+// Function to run the backend scanning out for the configured frames, returns negative if the blank interrupt stopped
+static int backendbench_run(uint32_t *pu32Target)
+{
+    S_DISP_RINGINFO sStart, sInfo;
+    uint32_t u32Timeout = nu_cyccnt_freq() * 2;
+    uint32_t u32LastBlank, u32LastBlankTime, u32Start, u32Elapsed;
+    uint32_t u32Frames, u32Fps10, u32IsrCycles, u32IsrLoad100, u32IsrNs, u32IsrMaxNs, u32KBps;
+    uint32_t u32Pass = 0;
+    uint64_t u64Bytes = 0;
+
+    /* Count from a blank, the ring build and its first frame stay out of the figures. */
+    disp_get_ringinfo(&sStart);
+    u32Start = nu_cyccnt_get();
+
+    do
+    {
+        disp_get_ringinfo(&sInfo);
+
+        if ((nu_cyccnt_get() - u32Start) > u32Timeout)
+            return -1;
+    } while (sInfo.m_u32BlankCount == sStart.m_u32BlankCount);
+
+    sStart = sInfo;
+    u32LastBlank = sInfo.m_u32BlankCount;
+    u32Start = u32LastBlankTime = nu_cyccnt_get();
+
+    do
+    {
+        backendbench_fill(pu32Target, u32Pass++);
+        u64Bytes += CONFIG_VRAM_BUF_SIZE;
+
+        disp_get_ringinfo(&sInfo);
+
+        if (sInfo.m_u32BlankCount != u32LastBlank)
+        {
+            u32LastBlank = sInfo.m_u32BlankCount;
+            u32LastBlankTime = nu_cyccnt_get();
+        }
+        else if ((nu_cyccnt_get() - u32LastBlankTime) > u32Timeout)
+        {
+            return -1;
+        }
+    } while ((sInfo.m_u32BlankCount - sStart.m_u32BlankCount) < CONFIG_DISP_BACKENDBENCH_FRAMES);
+
+    u32Elapsed = nu_cyccnt_get() - u32Start;
+
+    /* The blank stamps time the frames, the fill loop only ends after the last one. */
+    u32Frames = sInfo.m_u32BlankCount - sStart.m_u32BlankCount;
+    u32Fps10 = (uint32_t)(((uint64_t)u32Frames * nu_cyccnt_freq() * 10ULL) / (sInfo.m_u32BlankStamp - sStart.m_u32BlankStamp));
+    u32IsrCycles = sInfo.m_u32IsrCycles - sStart.m_u32IsrCycles;
+    u32IsrLoad100 = (uint32_t)(((uint64_t)u32IsrCycles * 10000ULL) / u32Elapsed);
+    u32IsrNs = backendbench_ticks_to_ns(u32IsrCycles / u32Frames);
+    u32IsrMaxNs = backendbench_ticks_to_ns(sInfo.m_u32IsrMaxCycles);
+    u32KBps = backendbench_kbps(u64Bytes, u32Elapsed);
+
+    printf("%-7s %6u %4u.%u %5u.%02u %8u.%02u %4u.%02u %7u.%02u %8u %8u\n",
+           sInfo.m_szBackend, u32Frames, u32Fps10 / 10, u32Fps10 % 10,
+           u32IsrNs / 1000, (u32IsrNs % 1000) / 10,
+           u32IsrMaxNs / 1000, (u32IsrMaxNs % 1000) / 10,
+           u32IsrLoad100 / 100, u32IsrLoad100 % 100,
+           u32KBps / 1024, ((u32KBps % 1024) * 100) / 1024,
+           sInfo.m_u32RingSize, sInfo.m_u32FetchSize);
+
+    return 0;
+}
+
+// Function to report the backend benchmark
+static int disp_backendbench_init(void)
+{
+    E_DISP_BACKEND evBoot = disp_backend_current();
+    uint32_t *pu32Target = backendbench_spare_buf();
+    int i, i32Ret = 0;
+
+    if (!pu32Target)
+    {
+        printf("Backend benchmark: no spare VRAM buffer.\n");
+        return -1;
+    }
+
+    printf("Backend benchmark: %u frames per backend, %u bytes per fill pass.\n",
+           CONFIG_DISP_BACKENDBENCH_FRAMES, (uint32_t)CONFIG_VRAM_BUF_SIZE);
+    backendbench_print_header();
+
+    disp_backend_select(evDispBackendCNT);
+    backendbench_idle(pu32Target);
+
+    for (i = 0; i < evDispBackendCNT; i++)
+    {
+        const S_DISP_BACKEND *psBackend = disp_backend_get((E_DISP_BACKEND)i);
+
+        if (!psBackend)
+            continue;
+
+        if (disp_backend_select((E_DISP_BACKEND)i) < 0)
+        {
+            printf("%-7s failed to start.\n", psBackend->m_szName);
+            i32Ret = -1;
+        }
+        else if (backendbench_run(pu32Target) < 0)
+        {
+            printf("%-7s no blank interrupt.\n", psBackend->m_szName);
+            i32Ret = -1;
+        }
+    }
+
+    if (disp_backend_select(evBoot) < 0)
+    {
+        printf("Backend benchmark: %s did not restart.\n", disp_backend_get(evBoot)->m_szName);
+        return -1;
+    }
+
+    return i32Ret;
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_BACKENDBENCH", disp_backendbench_init, NULL);
+
+#endif /* defined(CONFIG_DISP_BACKENDBENCH) */
@@ -0,0 +1,137 @@
+/**************************************************************************//**
+ * @file     disp_bankbench.c
+ * @brief    Report the render speed into the SRAM bank being scanned out
+ *           against the other bank over the UART console. Enable
+ *           CONFIG_DISP_BANKBENCH and CONFIG_DISP_VRAM_BANKED in disp.h.
+ *           A render target is allocated in each bank, every pass fills
+ *           and cleans both while the scanout ring keeps running. Each
+ *           sample is sorted by the scanout bank around it, samples that
+ *           a buffer flip lands in are dropped.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "sram_bank.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_BANKBENCH)
+
+#if !defined(CONFIG_DISP_VRAM_BANKED)
+    #error "CONFIG_DISP_BANKBENCH needs CONFIG_DISP_VRAM_BANKED."
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_BANKBENCH_PASSES    16    /*!< Render passes into each bank */
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to render a gradient into a target and clean it out of the D-cache, returns the elapsed cycles
+static uint32_t bankbench_render(uint32_t *pu32Dst, uint32_t u32Seed)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32Pixel = u32Seed * 0x00010001UL;
+    int i;
+
+    for (i = 0; i < (CONFIG_VRAM_BUF_SIZE / sizeof(uint32_t)); i++)
+    {
+        pu32Dst[i] = u32Pixel;
+        u32Pixel += 0x00010001UL;
+    }
+
+    /* The render is not done until the pixels reach the SRAM bank. */
+    SCB_CleanDCache_by_Addr(pu32Dst, CONFIG_VRAM_BUF_SIZE);
+
+    return nu_cyccnt_get() - u32Start;
+}
+
+// Function to get the SRAM bank of the buffer being scanned out, negative if it is in neither SRAM0 nor SRAM1
+static int bankbench_scan_bank(void)
+{
+    int i32Bank = sram_bank_of(disp_get_vrambufaddr());
+
+    return ((i32Bank == evSRAMBank0) || (i32Bank == evSRAMBank1)) ? i32Bank : -1;
+}
+
+// Function to print one report row
+static void bankbench_print_row(const char *szName, uint32_t u32Samples, uint64_t u64Cycles)
+{
+    uint32_t u32Avg = u32Samples ? (uint32_t)(u64Cycles / u32Samples) : 0;
+    uint32_t u32KBps = u32Avg ? (uint32_t)(((uint64_t)CONFIG_VRAM_BUF_SIZE * nu_cyccnt_freq()) / ((uint64_t)u32Avg * 1024ULL)) : 0;
+
+    printf("%-10s %7u %12u %8u.%02u\n", szName, u32Samples, u32Avg, u32KBps / 1024, ((u32KBps % 1024) * 100) / 1024);
+}
+
+// Function to report the bank benchmark
+static int disp_bankbench_init(void)
+{
+    uint32_t *apu32Target[evSRAMBank2];
+    /* Indexed by 0 for the bank being scanned out, 1 for the other one. */
+    uint64_t au64Cycles[2] = { 0, 0 };
+    uint32_t au32Samples[2] = { 0, 0 };
+    uint32_t u32Dropped = 0;
+    int i, j;
+
+    if (bankbench_scan_bank() < 0)
+    {
+        printf("Bank benchmark: scanout buffer is not in SRAM0/SRAM1.\n");
+        return -1;
+    }
+
+    for (i = evSRAMBank0; i < evSRAMBank2; i++)
+    {
+        apu32Target[i] = (uint32_t *)sram_bank_alloc((E_SRAM_BANK)i, CONFIG_VRAM_BUF_SIZE, DCACHE_LINE_SIZE);
+
+        if (!apu32Target[i])
+        {
+            printf("Bank benchmark: no room for a render target in SRAM%d, %u bytes free.\n",
+                   i, sram_bank_get_free((E_SRAM_BANK)i));
+            return -1;
+        }
+    }
+
+    /* Interleave the banks so both see the same scanout phases. */
+    for (i = 0; i < DEF_BANKBENCH_PASSES; i++)
+    {
+        for (j = evSRAMBank0; j < evSRAMBank2; j++)
+        {
+            /* The example keeps flipping buffers, a sample counts only if the scanout bank held still through it. */
+            int i32ScanBank = bankbench_scan_bank();
+            uint32_t u32Cycles = bankbench_render(apu32Target[j], i);
+
+            if ((i32ScanBank < 0) || (i32ScanBank != bankbench_scan_bank()))
+            {
+                u32Dropped++;
+                continue;
+            }
+
+            au64Cycles[(j == i32ScanBank) ? 0 : 1] += u32Cycles;
+            au32Samples[(j == i32ScanBank) ? 0 : 1]++;
+        }
+    }
+
+    printf("Bank benchmark: %u bytes per pass, %d passes, %u samples dropped on a flip.\n",
+           (uint32_t)CONFIG_VRAM_BUF_SIZE, DEF_BANKBENCH_PASSES, u32Dropped);
+    printf("%-10s %7s %12s %11s\n", "Target", "Samples", "Cycles", "MB/s");
+    bankbench_print_row("SameBank", au32Samples[0], au64Cycles[0]);
+    bankbench_print_row("OtherBank", au32Samples[1], au64Cycles[1]);
+
+    if (au32Samples[0] && au32Samples[1] && au64Cycles[1])
+    {
+        uint64_t u64Same = au64Cycles[0] / au32Samples[0];
+        uint64_t u64Other = au64Cycles[1] / au32Samples[1];
+        uint32_t u32Ratio100 = u64Other ? (uint32_t)((u64Same * 100ULL) / u64Other) : 0;
+
+        printf("Same bank takes %u.%02u times the cycles of the other bank.\n", u32Ratio100 / 100, u32Ratio100 % 100);
+    }
+
+    return 0;
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_BANKBENCH", disp_bankbench_init, NULL);
+
+#endif /* defined(CONFIG_DISP_BANKBENCH) */
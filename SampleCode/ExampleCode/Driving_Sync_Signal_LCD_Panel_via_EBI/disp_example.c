@@ -9,6 +9,9 @@
 
 #include "NuMicro.h"
 #include "disp.h"
+#include "disp_surface.h"
+#include "disp_image.h"
+#include "disp_anim.h"
 #include "string.h"
 
 /*---------------------------------------------------------------------------*/
@@ -32,61 +35,226 @@
     extern const __attribute__((aligned(32))) void* incbin_ ## name ## _start; \
     extern const void* incbin_ ## name ## _end; \
 
+/* Toggle the images about every 16 frames of a 60 Hz panel against visual persistence ghosting. */
+#define DEF_EXAMPLE_FPS    4
+
 /*---------------------------------------------------------------------------*/
 /* Global variables                                                          */
 /*---------------------------------------------------------------------------*/
-INCBIN(image1, PATH_IMAGE1_BIN);  // Include binary data for image1 from the specified path.
-INCBIN(image2, PATH_IMAGE2_BIN);  // Include binary data for image2 from the specified path.
+#if defined(CONFIG_DISP_IMAGE_COMPRESSED)
+    INCBIN(image1, PATH_IMAGE1_Q565);  // Include compressed image1 from the specified path.
+    INCBIN(image2, PATH_IMAGE2_Q565);  // Include compressed image2 from the specified path.
+#else
+    #include PATH_IMAGE1_H
+    #include PATH_IMAGE2_H
+
+    /* Raw images are copied or scanned out as whole frames. */
+    #if (IMAGE1_WIDTH != CONFIG_TIMING_HACT) || (IMAGE1_HEIGHT != CONFIG_TIMING_VACT) || (IMAGE1_STRIDE != (CONFIG_TIMING_HACT * 2)) || \
+        (IMAGE2_WIDTH != CONFIG_TIMING_HACT) || (IMAGE2_HEIGHT != CONFIG_TIMING_VACT) || (IMAGE2_STRIDE != (CONFIG_TIMING_HACT * 2))
+        #error "The example images do not match the panel, regenerate them and their headers with host/disp_imgconv.c."
+    #endif
+
+    INCBIN(image1, PATH_IMAGE1_BIN);  // Include binary data for image1 from the specified path.
+    INCBIN(image2, PATH_IMAGE2_BIN);  // Include binary data for image2 from the specified path.
+#endif
+
+static S_DISP_ANIM_FRAME s_asAnimFrame[2];                   // image1 and image2, scanned out in place.
+
+#if !defined(CONFIG_DISP_SPLASH_IN_FLASH)
+    static S_DISP_SURFACE s_asSurface[CONFIG_VRAM_BUF_NUM];  // Drawing surface of each VRAM buffer.
+    static int s_i32LoadIdx = 0;                             // Next image to stream into VRAM.
+#endif
+
+#if defined(CONFIG_DISP_IMAGE_COMPRESSED)
+    static S_DISP_IMAGE_DEC s_sImageDec;                     // Decoder of the image being loaded.
+#elif !defined(CONFIG_DISP_SPLASH_IN_FLASH)
+    static int s_bLoadBusy = 0;                              // A DMA copy of image (s_i32LoadIdx - 1) is in flight.
+#endif
 
 /*---------------------------------------------------------------------------*/
 /* Functions                                                                 */
 /*---------------------------------------------------------------------------*/
 
-// Blank event callback function
-void disp_example_blankcb(void *p)
+// Function to get the flash-resident image1 (index 0) or image2 (index 1)
+static const void *disp_example_source(int i32Idx)
+{
+    return i32Idx ? (const void *)&incbin_image2_start : (const void *)&incbin_image1_start;
+}
+
+// Function to get the buffer holding image1 (index 0) or image2 (index 1)
+static void *disp_example_image(int i32Idx)
 {
-    static uint32_t u32Counter = 0;
+#if defined(CONFIG_DISP_SPLASH_IN_FLASH)
+    /* Static screens are scanned out of flash, no copy and no VRAM. */
+    return (void *)disp_example_source(i32Idx);
+#else
+    return disp_get_vrambuf(i32Idx);
+#endif
+}
 
-    /* Toggle different image showing after getting 16 event for avoid visual persistence ghosting. */
-#define DEF_TOGGLE_COND    (u32Counter & 0x10u)
+#if !defined(CONFIG_DISP_IMAGE_COMPRESSED)
+// Function to get the image the scanout starts with, overrides the weak default of the backend
+const void *disp_get_splash(void)
+{
+    /* The panel shows image1 from flash while VRAM is still loading. */
+    return disp_example_source(0);
+}
+#endif
+
+// Function to start toggling image1 and image2, the player presents them against the blank
+static int disp_example_start(void)
+{
+    int i;
 
-    /* Toggle between image1 and image2 display based on u32Counter's value. */
-    if (DEF_TOGGLE_COND)
+    for (i = 0; i < 2; i++)
     {
-        /* If the condition is true, set VRAM buffer to image2 buffer address. */
-        disp_set_vrambufaddr((void *)&g_au8FrameBuf[CONFIG_VRAM_BUF_SIZE]);
+        s_asAnimFrame[i].m_evSource = evDispAnimDirect;
+        s_asAnimFrame[i].m_pvData = disp_example_image(i);
+        s_asAnimFrame[i].m_u32Size = CONFIG_VRAM_BUF_SIZE;
     }
-    else
+
+    return disp_anim_play(s_asAnimFrame, 2, DEF_EXAMPLE_FPS, 0);
+}
+
+
+#if !defined(CONFIG_DISP_SPLASH_IN_FLASH)
+// Function to get the size of the flash-resident image1 (index 0) or image2 (index 1)
+static uint32_t disp_example_source_size(int i32Idx)
+{
+#if defined(CONFIG_DISP_IMAGE_COMPRESSED)
+    return i32Idx ? (uint32_t)((const uint8_t *)&incbin_image2_end - (const uint8_t *)&incbin_image2_start) :
+           (uint32_t)((const uint8_t *)&incbin_image1_end - (const uint8_t *)&incbin_image1_start);
+#else
+    return i32Idx ? IMAGE2_SIZE : IMAGE1_SIZE;
+#endif
+}
+#endif
+
+#if defined(CONFIG_DISP_IMAGE_COMPRESSED)
+// Function to start decoding an image, returns negative if it does not fit the panel
+static int disp_example_open(int i32Idx)
+{
+    if (disp_image_open(&s_sImageDec, disp_example_source(i32Idx), disp_example_source_size(i32Idx)) < 0)
+        return -1;
+
+    if ((s_sImageDec.m_psHdr->m_u16Width != CONFIG_TIMING_HACT) || (s_sImageDec.m_psHdr->m_u16Height != CONFIG_TIMING_VACT))
+        return -1;
+
+    return 0;
+}
+
+// Function to decode the images into VRAM a few rows per poll, returns COMPONENT_PENDING until all are loaded
+static int disp_example_poll(void)
+{
+    S_DISP_SURFACE *psSurf = &s_asSurface[s_i32LoadIdx];
+    int i32Row = s_sImageDec.m_i32Row;
+    int i32Rows;
+
+    i32Rows = disp_image_decode_rows(&s_sImageDec, &psSurf->m_pu16Buf[i32Row * CONFIG_TIMING_HACT],
+                                     CONFIG_TIMING_HACT, CONFIG_DISP_IMAGE_POLL_ROWS);
+
+    if (i32Rows < 0)
+        return -1;
+
+    /* Clean the decoded rows only, the rest of the buffer is untouched. */
+    disp_surface_mark_dirty(psSurf, 0, i32Row, CONFIG_TIMING_HACT, i32Rows);
+    disp_surface_flush(psSurf);
+
+    /* A panel with its own GRAM only shows the rows sent to it, sync panels return at once. */
+    if ((i32Rows > 0) && (psSurf->m_pu16Buf == disp_get_vrambufaddr()))
+        disp_update_rect(0, (uint32_t)i32Row, CONFIG_TIMING_HACT, (uint32_t)i32Rows);
+
+    if (s_sImageDec.m_i32Row < CONFIG_TIMING_VACT)
+        return COMPONENT_PENDING;
+
+    if (++s_i32LoadIdx < CONFIG_VRAM_BUF_NUM)
+        return (disp_example_open(s_i32LoadIdx) < 0) ? -1 : COMPONENT_PENDING;
+
+    /* Both images are in VRAM, start toggling them. */
+    return disp_example_start();
+}
+#elif !defined(CONFIG_DISP_SPLASH_IN_FLASH)
+// Function to copy an image into VRAM with the CPU
+static void disp_example_load_cpu(int i32Idx)
+{
+    memcpy(s_asSurface[i32Idx].m_pu16Buf, disp_example_source(i32Idx), disp_example_source_size(i32Idx));
+
+    /* Flush the dirty pixel data in DCache to memory. Later drawing marks only what it touches. */
+    disp_surface_mark_dirty(&s_asSurface[i32Idx], 0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+    disp_surface_flush(&s_asSurface[i32Idx]);
+}
+
+// Function to stream the images into VRAM by DMA, returns COMPONENT_PENDING until all are loaded
+static int disp_example_poll(void)
+{
+    if (s_bLoadBusy)
     {
-        /* If the condition is false, set VRAM buffer to image1 buffer address. */
-        disp_set_vrambufaddr((void *)g_au8FrameBuf);
+        int i32Ret = disp_dma_copy_poll();
+
+        if (i32Ret > 0)
+            return COMPONENT_PENDING;
+
+        s_bLoadBusy = 0;
+
+        /* The DMA gave up, finish the image with the CPU. */
+        if (i32Ret < 0)
+            disp_example_load_cpu(s_i32LoadIdx - 1);
     }
 
-    // Increment the counter to alternate the display in the next callback
-    u32Counter++;
-}
+    while (s_i32LoadIdx < CONFIG_VRAM_BUF_NUM)
+    {
+        int i32Idx = s_i32LoadIdx++;
 
+        if (disp_dma_copy(disp_get_vrambuf(i32Idx), disp_example_source(i32Idx), disp_example_source_size(i32Idx)) == 0)
+        {
+            s_bLoadBusy = 1;
+            return COMPONENT_PENDING;
+        }
+
+        /* No spare DMA channel in this configuration. */
+        disp_example_load_cpu(i32Idx);
+    }
+
+    /* Both images are in VRAM, start toggling them. */
+    return disp_example_start();
+}
+#endif
 
 // Initialize the display example
 static int disp_example_init(void)
 {
-    /* Set blank event callback function. */
-    disp_set_blankcb(disp_example_blankcb);
+#if defined(CONFIG_DISP_SPLASH_IN_FLASH)
+    /* Start toggling the images in flash. */
+    return disp_example_start();
+#else
+    int i;
 
-    /* Copy image1 and image2 pixel data to VRAM buffer. */
-    memcpy(g_au8FrameBuf, (const uint8_t *)&incbin_image1_start, CONFIG_VRAM_BUF_SIZE);
-    memcpy(&g_au8FrameBuf[CONFIG_VRAM_BUF_SIZE], (const uint8_t *)&incbin_image2_start, CONFIG_VRAM_BUF_SIZE);
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+        disp_surface_init(&s_asSurface[i], disp_get_vrambuf(i), CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
 
-    /* Flush all pixel data in DCache to memory. */
-    SCB_CleanDCache_by_Addr(g_au8FrameBuf, 2 * CONFIG_VRAM_BUF_SIZE);
+#if defined(CONFIG_DISP_IMAGE_COMPRESSED)
+    /* Decode image1 and image2 into VRAM in the background, image1 appears as it is decoded. */
+    s_i32LoadIdx = 0;
 
-    return 0;
+    if (disp_example_open(0) < 0)
+        return -1;
+
+    return disp_example_poll();
+#else
+    /* Stream image1 and image2 into VRAM in the background, the splash is on screen meanwhile. */
+    s_i32LoadIdx = 0;
+    s_bLoadBusy = 0;
+
+    return disp_example_poll();
+#endif
+#endif
 }
 
 // Finalize the display example
 static int disp_example_fini(void)
 {
-    /* Reset blank event callback function. */
+    /* Stop the player and reset blank event callback function. */
+    disp_anim_stop();
     disp_set_blankcb((void *)NULL);
 
     /* Reset VRAM buffer address. */
@@ -95,4 +263,8 @@ static int disp_example_fini(void)
     return 0;
 }
 
-COMPONENT_EXPORT("DISP_EXAMPLE", disp_example_init, disp_example_fini);
+#if defined(CONFIG_DISP_SPLASH_IN_FLASH)
+    COMPONENT_EXPORT("DISP_EXAMPLE", disp_example_init, disp_example_fini);
+#else
+    COMPONENT_EXPORT_ASYNC("DISP_EXAMPLE", disp_example_init, disp_example_fini, disp_example_poll);
+#endif
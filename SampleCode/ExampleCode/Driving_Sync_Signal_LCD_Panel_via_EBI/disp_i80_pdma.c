@@ -0,0 +1,498 @@
+/**************************************************************************//**
+ * @file     disp_i80_pdma.c
+ * @brief    Use EBI-16 with PDMA-M2M to write an i80 (8080) command-mode panel.
+ *           The panel refreshes itself from its own GRAM, so only windows that
+ *           changed cross the bus: CASET/PASET frame the window, RAMWR takes
+ *           one scatter-gather descriptor per row. Enable CONFIG_DISP_I80 in
+ *           disp.h and wire nCS0 to CS, nWR to WR, nRD to RD and the EBI
+ *           address bit CONFIG_DISP_I80_DC_BITIDX to D/C. The panel size is
+ *           CONFIG_TIMING_HACT x CONFIG_TIMING_VACT, the porches are unused.
+ *           The TE output of the panel is not wired, so TIMER0 raises a
+ *           blank CONFIG_DISP_I80_FPS times a second. The blank callback gets
+ *           the last buffer written whole to the GRAM, and the players and
+ *           frame pacing of the sync backends keep working.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+
+#include "pdma_lib.h"
+#include "disp.h"
+#include "disp_backend.h"
+#include "disp_probe.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_I80)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_I80_CMD_SWRESET       0x01
+#define DEF_I80_CMD_SLPOUT        0x11
+#define DEF_I80_CMD_DISPON        0x29
+#define DEF_I80_CMD_CASET         0x2A
+#define DEF_I80_CMD_PASET         0x2B
+#define DEF_I80_CMD_RAMWR         0x2C
+#define DEF_I80_CMD_MADCTL        0x36
+#define DEF_I80_CMD_COLMOD        0x3A
+#define DEF_I80_COLMOD_RGB565     0x55
+#define DEF_I80_WAKE_MS           120   /*!< Wait after SWRESET and SLPOUT before the next command */
+
+#define DEF_I80_CMD_ADDR          (EBI_BANK0_BASE_ADDR + (CONFIG_DISP_EBI * EBI_MAX_SIZE))          /*!< D/C low */
+#define DEF_I80_DATA_ADDR         (DEF_I80_CMD_ADDR + (1UL << CONFIG_DISP_I80_DC_BITIDX))           /*!< D/C high */
+
+#define DEF_I80_TIMER             TIMER0
+#define DEF_I80_TIMER_IRQn        TIMER0_IRQn
+#define DEF_I80_TIMER_MODULE      TMR0_MODULE
+#define DEF_I80_TIMER_RST         SYS_TMR0RST
+
+// Structure representing a window of the panel, the end coordinates are exclusive
+typedef struct
+{
+    uint16_t m_u16X0;
+    uint16_t m_u16Y0;
+    uint16_t m_u16X1;
+    uint16_t m_u16Y1;
+} S_I80_RECT;
+
+_Static_assert(CONFIG_TIMING_HACT <= NU_PDMA_MAX_TXCNT, "A row of this panel is longer than the transfer count of a PDMA descriptor.");
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+#if defined(NVT_NONCACHEABLE)
+    NVT_NONCACHEABLE static DSCT_T s_asI80Dsc[CONFIG_TIMING_VACT];
+#else
+    static DSCT_T s_asI80Dsc[CONFIG_TIMING_VACT];
+#endif
+
+static volatile uint16_t *s_pu16BufAddr = NULL;
+static volatile uint16_t *s_pu16WriteBuf = NULL;   /*!< Buffer of the window on the bus */
+static void *volatile s_pvShown = NULL;             /*!< Buffer last written whole to the GRAM, given to the blank callback */
+static volatile int s_i32Busy = 0;                  /*!< 1 while a window is written */
+static volatile int s_bWriteWhole = 0;              /*!< 1 if the window on the bus is the whole panel */
+static S_I80_RECT s_sPending;                       /*!< Windows queued while busy, merged. Empty when m_u16X0 == m_u16X1 */
+static int s_i32Channel = -1;
+static S_DISP_RINGINFO s_sRingInfo =
+{
+    .m_szBackend    = "I80",
+    .m_u32DscNum    = CONFIG_TIMING_VACT,
+    .m_u32DscSize   = sizeof(DSCT_T),
+    .m_u32RingSize  = sizeof(s_asI80Dsc),
+    .m_u32FetchSize = 0,
+};
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to write a command and its parameters with the CPU
+static void disp_i80_cmd(uint8_t u8Cmd, const uint8_t *pu8Param, uint32_t u32Len)
+{
+    *(volatile uint16_t *)DEF_I80_CMD_ADDR = u8Cmd;
+
+    while (u32Len--)
+        *(volatile uint16_t *)DEF_I80_DATA_ADDR = *pu8Param++;
+}
+
+// Function to wait on the cycle counter, the panel ignores commands while it resets or wakes
+static void disp_i80_delay_ms(uint32_t u32Ms)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32Cycles = (nu_cyccnt_freq() / 1000) * u32Ms;
+
+    while ((nu_cyccnt_get() - u32Start) < u32Cycles);
+}
+
+// Function to frame a window with CASET/PASET and open the GRAM write
+static void disp_i80_window(const S_I80_RECT *psRect)
+{
+    uint8_t au8Param[4];
+
+    au8Param[0] = (uint8_t)(psRect->m_u16X0 >> 8);
+    au8Param[1] = (uint8_t)(psRect->m_u16X0);
+    au8Param[2] = (uint8_t)((psRect->m_u16X1 - 1) >> 8);
+    au8Param[3] = (uint8_t)(psRect->m_u16X1 - 1);
+    disp_i80_cmd(DEF_I80_CMD_CASET, au8Param, sizeof(au8Param));
+
+    au8Param[0] = (uint8_t)(psRect->m_u16Y0 >> 8);
+    au8Param[1] = (uint8_t)(psRect->m_u16Y0);
+    au8Param[2] = (uint8_t)((psRect->m_u16Y1 - 1) >> 8);
+    au8Param[3] = (uint8_t)(psRect->m_u16Y1 - 1);
+    disp_i80_cmd(DEF_I80_CMD_PASET, au8Param, sizeof(au8Param));
+
+    disp_i80_cmd(DEF_I80_CMD_RAMWR, NULL, 0);
+}
+
+// Function to start writing a window of the current buffer, the bus must be idle
+static int disp_i80_start(const S_I80_RECT *psRect)
+{
+    uint32_t u32Width = psRect->m_u16X1 - psRect->m_u16X0;
+    uint32_t u32Total = u32Width * (psRect->m_u16Y1 - psRect->m_u16Y0);
+    /* Full-width rows lie back to back in VRAM and GRAM, so one descriptor moves as many pixels as it can count. */
+    int bContiguous = (u32Width == CONFIG_TIMING_HACT);
+    const uint16_t *pu16Src = (const uint16_t *)s_pu16BufAddr + (psRect->m_u16Y0 * CONFIG_TIMING_HACT) + psRect->m_u16X0;
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32Done = 0;
+    int i = 0;
+
+    while (u32Done < u32Total)
+    {
+        uint32_t u32Count = bContiguous ? (((u32Total - u32Done) > NU_PDMA_MAX_TXCNT) ? NU_PDMA_MAX_TXCNT : (u32Total - u32Done)) : u32Width;
+        int bLast = ((u32Done + u32Count) >= u32Total);
+
+        nu_pdma_m2m_desc_setup(&s_asI80Dsc[i],
+                               16,
+                               (uint32_t)pu16Src,
+                               DEF_I80_DATA_ADDR,
+                               u32Count,
+                               eMemCtl_SrcInc_DstFix,
+                               bLast ? NULL : &s_asI80Dsc[i + 1],
+                               bLast ? 0 : 1);
+
+        pu16Src += bContiguous ? u32Count : CONFIG_TIMING_HACT;
+        u32Done += u32Count;
+        i++;
+    }
+
+    s_sRingInfo.m_u32BuildCycles = nu_cyccnt_get() - u32Start;
+    s_sRingInfo.m_u32FetchSize = i * sizeof(DSCT_T);
+
+    disp_i80_window(psRect);
+
+    /* The commands must reach the panel before the pixels. */
+    __DSB();
+
+    s_pu16WriteBuf = s_pu16BufAddr;
+    s_bWriteWhole = (u32Total == (CONFIG_TIMING_HACT * CONFIG_TIMING_VACT));
+    s_i32Busy = 1;
+
+    if (nu_pdma_sg_transfer(s_i32Channel, &s_asI80Dsc[0], 0) < 0)
+    {
+        s_i32Busy = 0;
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to merge a window into the pending one
+static void disp_i80_rect_union(S_I80_RECT *psDst, const S_I80_RECT *psSrc)
+{
+    if (psDst->m_u16X0 == psDst->m_u16X1)
+    {
+        *psDst = *psSrc;
+        return;
+    }
+
+    psDst->m_u16X0 = (psSrc->m_u16X0 < psDst->m_u16X0) ? psSrc->m_u16X0 : psDst->m_u16X0;
+    psDst->m_u16Y0 = (psSrc->m_u16Y0 < psDst->m_u16Y0) ? psSrc->m_u16Y0 : psDst->m_u16Y0;
+    psDst->m_u16X1 = (psSrc->m_u16X1 > psDst->m_u16X1) ? psSrc->m_u16X1 : psDst->m_u16X1;
+    psDst->m_u16Y1 = (psSrc->m_u16Y1 > psDst->m_u16Y1) ? psSrc->m_u16Y1 : psDst->m_u16Y1;
+}
+
+// Callback function for the end of a window write
+static void nu_pdma_i80_cb(void *pvUserData, uint32_t u32Events)
+{
+    if ((u32Events == NU_PDMA_EVENT_TRANSFER_DONE))
+    {
+        uint32_t u32IsrStart = nu_cyccnt_get();
+
+        s_i32Busy = 0;
+
+        /* From the next blank on the panel shows this buffer. */
+        if (s_bWriteWhole)
+            s_pvShown = (void *)s_pu16WriteBuf;
+
+        /* Windows queued during the write go out as one. */
+        if (s_sPending.m_u16X0 != s_sPending.m_u16X1)
+        {
+            S_I80_RECT sRect = s_sPending;
+
+            s_sPending.m_u16X1 = s_sPending.m_u16X0;
+            disp_i80_start(&sRect);
+        }
+
+        disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
+    }
+}
+
+// Blank timer interrupt handler, stands in for the TE output of the panel
+NVT_ITCM void TIMER0_IRQHandler(void)
+{
+    if (TIMER_GetIntFlag(DEF_I80_TIMER))
+    {
+        uint32_t u32IsrStart = nu_cyccnt_get();
+        DispBlankCb pfnBlankCb;
+
+        TIMER_ClearIntFlag(DEF_I80_TIMER);
+
+        s_sRingInfo.m_u32BlankStamp = u32IsrStart;
+        s_sRingInfo.m_u32BlankCount++;
+
+        pfnBlankCb = disp_get_blankcb();
+
+        if (pfnBlankCb)
+        {
+            disp_probe_begin(evDispProbeBlankCb);
+            pfnBlankCb(s_pvShown);
+            disp_probe_end(evDispProbeBlankCb);
+        }
+
+        disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
+
+        /* Let the interrupt flag clear before the handler returns. */
+        __DSB();
+    }
+}
+
+// Function to send a window of the current buffer to the panel GRAM, queued while another one is written
+static int disp_i80_update_rect(uint32_t u32X, uint32_t u32Y, uint32_t u32Width, uint32_t u32Height)
+{
+    S_I80_RECT sRect;
+    uint32_t u32PriMask;
+    int i32Ret = 0;
+
+    sRect.m_u16X0 = (uint16_t)u32X;
+    sRect.m_u16Y0 = (uint16_t)u32Y;
+    sRect.m_u16X1 = (uint16_t)(u32X + u32Width);
+    sRect.m_u16Y1 = (uint16_t)(u32Y + u32Height);
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    if (s_i32Busy)
+        disp_i80_rect_union(&s_sPending, &sRect);
+    else
+        i32Ret = disp_i80_start(&sRect);
+
+    __set_PRIMASK(u32PriMask);
+
+    return i32Ret;
+}
+
+// Function to initialize the PDMA module
+static void pdma_init(void)
+{
+    uint32_t u32RegLocked = SYS_IsRegLocked();
+
+    /* Unlock protected registers */
+    if (u32RegLocked)
+        SYS_UnlockReg();
+
+    /* Enable PDMA0/PDMA1 clock source. */
+    CLK_EnableModuleClock(PDMA0_MODULE);
+    CLK_EnableModuleClock(PDMA1_MODULE);
+
+    /* Reset PDMA0/PDMA1 modules. */
+    SYS_ResetModule(SYS_PDMA0RST);
+    SYS_ResetModule(SYS_PDMA1RST);
+
+    /* Lock protected registers */
+    if (u32RegLocked)
+        SYS_LockReg();
+}
+
+// Function to deinitialize the PDMA module
+static void pdma_fini(void)
+{
+    uint32_t u32RegLocked = SYS_IsRegLocked();
+
+    /* Unlock protected registers */
+    if (u32RegLocked)
+        SYS_UnlockReg();
+
+    /* Reset PDMA0/PDMA1 modules. */
+    SYS_ResetModule(SYS_PDMA0RST);
+    SYS_ResetModule(SYS_PDMA1RST);
+
+    /* Disable PDMA0/PDMA1 clock source. */
+    CLK_DisableModuleClock(PDMA0_MODULE);
+    CLK_DisableModuleClock(PDMA1_MODULE);
+
+    /* Lock protected registers */
+    if (u32RegLocked)
+        SYS_LockReg();
+}
+
+// Function to start the blank timer
+static void timer_init(void)
+{
+    uint32_t u32RegLocked = SYS_IsRegLocked();
+
+    /* Unlock protected registers */
+    if (u32RegLocked)
+        SYS_UnlockReg();
+
+    /* Enable the timer clock from HIRC and reset the timer. */
+    CLK_SetModuleClock(DEF_I80_TIMER_MODULE, CLK_TMRSEL_TMR0SEL_HIRC, 0);
+    CLK_EnableModuleClock(DEF_I80_TIMER_MODULE);
+    SYS_ResetModule(DEF_I80_TIMER_RST);
+
+    /* Lock protected registers */
+    if (u32RegLocked)
+        SYS_LockReg();
+
+    TIMER_Open(DEF_I80_TIMER, TIMER_PERIODIC_MODE, CONFIG_DISP_I80_FPS);
+    TIMER_EnableInt(DEF_I80_TIMER);
+    NVIC_EnableIRQ(DEF_I80_TIMER_IRQn);
+    TIMER_Start(DEF_I80_TIMER);
+}
+
+// Function to stop the blank timer
+static void timer_fini(void)
+{
+    uint32_t u32RegLocked = SYS_IsRegLocked();
+
+    TIMER_Close(DEF_I80_TIMER);
+    NVIC_DisableIRQ(DEF_I80_TIMER_IRQn);
+
+    /* Unlock protected registers */
+    if (u32RegLocked)
+        SYS_UnlockReg();
+
+    CLK_DisableModuleClock(DEF_I80_TIMER_MODULE);
+
+    /* Lock protected registers */
+    if (u32RegLocked)
+        SYS_LockReg();
+}
+
+// Function to wake the i80 panel and write a buffer into its whole GRAM
+static int disp_i80_init(void *pvBufAddr)
+{
+    static const uint8_t s_u8Colmod = DEF_I80_COLMOD_RGB565;
+    static const uint8_t s_u8Madctl = CONFIG_DISP_I80_MADCTL;
+    struct nu_pdma_chn_cb sChnCB;
+
+    s_pu16BufAddr = (volatile uint16_t *)pvBufAddr;
+    s_pvShown = NULL;
+    s_i32Busy = 0;
+    s_sPending.m_u16X1 = s_sPending.m_u16X0;
+
+    pdma_init();
+
+    if (s_i32Channel < 0)
+    {
+        /* Allocate a PDMA channel resource. */
+        s_i32Channel = nu_pdma_channel_allocate(PDMA_MEM);
+
+        if (s_i32Channel < 0)
+            return -1;
+    }
+
+    /* Register ISR callback function */
+    sChnCB.m_eCBType = eCBType_Event;
+    sChnCB.m_pfnCBHandler = nu_pdma_i80_cb;
+    sChnCB.m_pvUserData = (void *)NULL;
+
+    nu_pdma_filtering_set(s_i32Channel, NU_PDMA_EVENT_TRANSFER_DONE);
+    nu_pdma_callback_register(s_i32Channel, &sChnCB);
+
+    /* The 16-bit bus carries one RGB565 pixel per write. */
+    nu_cyccnt_init();
+    disp_i80_cmd(DEF_I80_CMD_SWRESET, NULL, 0);
+    disp_i80_delay_ms(DEF_I80_WAKE_MS);
+    disp_i80_cmd(DEF_I80_CMD_SLPOUT, NULL, 0);
+    disp_i80_delay_ms(DEF_I80_WAKE_MS);
+    disp_i80_cmd(DEF_I80_CMD_COLMOD, &s_u8Colmod, 1);
+    disp_i80_cmd(DEF_I80_CMD_MADCTL, &s_u8Madctl, 1);
+    disp_i80_cmd(DEF_I80_CMD_DISPON, NULL, 0);
+
+    /* Blanks pass NULL until the first whole buffer is in the GRAM. */
+    timer_init();
+
+    return disp_i80_update_rect(0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+}
+
+// Function to release the PDMA of the i80 panel, it keeps showing its GRAM
+static int disp_i80_fini(void)
+{
+    timer_fini();
+
+    if (s_i32Channel >= 0)
+    {
+        /* Free allocated PDMA channel resource. */
+        nu_pdma_channel_free(s_i32Channel);
+
+        s_i32Channel = -1;
+    }
+
+    s_i32Busy = 0;
+    s_sPending.m_u16X1 = s_sPending.m_u16X0;
+
+    pdma_fini();
+
+    return 0;
+}
+
+// Function to show another VRAM buffer, the whole of it goes to the GRAM
+static void disp_i80_flip(void *pvBufAddr)
+{
+    s_pu16BufAddr = (volatile uint16_t *)pvBufAddr;
+
+    disp_i80_update_rect(0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+}
+
+// Function to start a background copy, no spare channel is set aside so callers copy with the CPU
+static int disp_i80_copy(void *pvDst, const void *pvSrc, uint32_t u32Size)
+{
+    (void)pvDst;
+    (void)pvSrc;
+    (void)u32Size;
+
+    return -1;
+}
+
+// Function to start a background copy of a rectangle, no spare channel is set aside
+static int disp_i80_copy_rect(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32Width, uint32_t u32Height)
+{
+    (void)pvDst;
+    (void)u32DstPitch;
+    (void)pvSrc;
+    (void)u32SrcPitch;
+    (void)u32Width;
+    (void)u32Height;
+
+    return -1;
+}
+
+// Function to check the background copy, none is ever started
+static int disp_i80_copy_poll(void)
+{
+    return 0;
+}
+
+// Function to start a background byte swap of RGB565 pixels, the PDMA cannot swap
+static int disp_i80_swap565(void *pvDst, const void *pvSrc, uint32_t u32Pixels, DispDmaDoneCb pfnDone, void *pvUser)
+{
+    (void)pvDst;
+    (void)pvSrc;
+    (void)u32Pixels;
+    (void)pfnDone;
+    (void)pvUser;
+
+    return -1;
+}
+
+// Function to get the window write statistics
+static void disp_i80_get_ringinfo(S_DISP_RINGINFO *psInfo)
+{
+    *psInfo = s_sRingInfo;
+}
+
+const S_DISP_BACKEND g_sDispBackendI80 =
+{
+    "I80",
+    disp_i80_init,
+    disp_i80_fini,
+    disp_i80_flip,
+    disp_i80_copy,
+    disp_i80_copy_rect,
+    disp_i80_copy_poll,
+    disp_i80_swap565,
+    disp_i80_get_ringinfo,
+    NULL,
+    disp_i80_update_rect
+};
+
+#endif /* defined(CONFIG_DISP_I80) */
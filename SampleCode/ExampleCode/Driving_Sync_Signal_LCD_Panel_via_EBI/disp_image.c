@@ -0,0 +1,229 @@
+/**************************************************************************//**
+ * @file     disp_image.c
+ * @brief    Streaming decoder of the compressed RGB565 image container.
+ *           RUN and COPY spans are filled and copied in bulk and LITERAL
+ *           spans are plain memcpy, so flat UI areas decode at close to
+ *           memory copy speed. The decoder only reads the container, it
+ *           builds on the host as well.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp_image.h"
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to add signed channel deltas to an RGB565 pixel, each channel wraps
+static uint16_t image_add_rgb(uint16_t u16Px, int i32DR, int i32DG, int i32DB)
+{
+    uint32_t u32R = ((u16Px >> 11) + i32DR) & 0x1F;
+    uint32_t u32G = (((u16Px >> 5) & 0x3F) + i32DG) & 0x3F;
+    uint32_t u32B = ((u16Px & 0x1F) + i32DB) & 0x1F;
+
+    return (uint16_t)((u32R << 11) | (u32G << 5) | u32B);
+}
+
+// Function to reset the coder state and point at the coded data of a group
+static void image_start_group(S_DISP_IMAGE_DEC *psDec, int i32Group)
+{
+    psDec->m_pu8Cur = psDec->m_pu8Data + psDec->m_pu32GroupOffset[i32Group];
+    psDec->m_pu16Above = NULL;
+    psDec->m_i32Row = i32Group * psDec->m_psHdr->m_u16GroupRows;
+    psDec->m_u16Prev = 0;
+    memset(psDec->m_au16Index, 0, sizeof(psDec->m_au16Index));
+}
+
+// Function to check an image and start decoding at row 0, returns negative if the image is malformed
+int disp_image_open(S_DISP_IMAGE_DEC *psDec, const void *pvImage, uint32_t u32Size)
+{
+    const S_DISP_IMAGE_HDR *psHdr = (const S_DISP_IMAGE_HDR *)pvImage;
+    uint32_t u32TableSize;
+    int i;
+
+    if (!psDec || !psHdr || (u32Size < sizeof(S_DISP_IMAGE_HDR)))
+        return -1;
+
+    if ((psHdr->m_u32Magic != DISP_IMAGE_MAGIC) || !psHdr->m_u16Width || !psHdr->m_u16Height || !psHdr->m_u16GroupRows)
+        return -1;
+
+    if (psHdr->m_u16Groups != ((psHdr->m_u16Height + psHdr->m_u16GroupRows - 1) / psHdr->m_u16GroupRows))
+        return -1;
+
+    u32TableSize = psHdr->m_u16Groups * sizeof(uint32_t);
+
+    if ((u32Size - sizeof(S_DISP_IMAGE_HDR)) < u32TableSize ||
+            (u32Size - sizeof(S_DISP_IMAGE_HDR) - u32TableSize) < psHdr->m_u32DataSize)
+        return -1;
+
+    psDec->m_psHdr = psHdr;
+    psDec->m_pu32GroupOffset = (const uint32_t *)(psHdr + 1);
+    psDec->m_pu8Data = (const uint8_t *)psDec->m_pu32GroupOffset + u32TableSize;
+    psDec->m_pu8End = psDec->m_pu8Data + psHdr->m_u32DataSize;
+
+    for (i = 0; i < psHdr->m_u16Groups; i++)
+    {
+        if (psDec->m_pu32GroupOffset[i] >= psHdr->m_u32DataSize)
+            return -1;
+    }
+
+    image_start_group(psDec, 0);
+
+    return 0;
+}
+
+// Function to restart decoding at the group holding a row, returns the first row of that group
+int disp_image_seek(S_DISP_IMAGE_DEC *psDec, int i32Row)
+{
+    if ((i32Row < 0) || (i32Row >= psDec->m_psHdr->m_u16Height))
+        return -1;
+
+    image_start_group(psDec, i32Row / psDec->m_psHdr->m_u16GroupRows);
+
+    return psDec->m_i32Row;
+}
+
+// Function to decode one row, returns negative if the data is corrupt
+static int image_decode_row(S_DISP_IMAGE_DEC *psDec, uint16_t *pu16Dst)
+{
+    const uint8_t *pu8Cur = psDec->m_pu8Cur;
+    const uint8_t *pu8End = psDec->m_pu8End;
+    const uint16_t *pu16Above = psDec->m_pu16Above;
+    uint16_t *pu16Index = psDec->m_au16Index;
+    uint16_t u16Px = psDec->m_u16Prev;
+    int x = 0, i32Width = psDec->m_psHdr->m_u16Width;
+
+    while (x < i32Width)
+    {
+        uint32_t u32Op, u32Num;
+
+        if (pu8Cur >= pu8End)
+            return -1;
+
+        u32Op = *pu8Cur++;
+
+        if (u32Op >= DISP_IMAGE_OP_COPY)
+        {
+            if (u32Op == DISP_IMAGE_OP_RAW)
+            {
+                u32Num = 1;
+            }
+            else
+            {
+                if (pu8Cur >= pu8End)
+                    return -1;
+
+                u32Num = (uint32_t) * pu8Cur++ + 1;
+            }
+
+            if (u32Num > (uint32_t)(i32Width - x))
+                return -1;
+
+            if (u32Op == DISP_IMAGE_OP_COPY)
+            {
+                if (!pu16Above)
+                    return -1;
+
+                memcpy(&pu16Dst[x], &pu16Above[x], u32Num * sizeof(uint16_t));
+                x += u32Num;
+                u16Px = pu16Dst[x - 1];
+                continue;
+            }
+
+            if ((uint32_t)(pu8End - pu8Cur) < (u32Num * sizeof(uint16_t)))
+                return -1;
+
+            /* LITERAL and RAW, the coded pixels are not aligned. */
+            memcpy(&pu16Dst[x], pu8Cur, u32Num * sizeof(uint16_t));
+            pu8Cur += u32Num * sizeof(uint16_t);
+
+            while (u32Num--)
+            {
+                u16Px = pu16Dst[x++];
+                pu16Index[DISP_IMAGE_HASH(u16Px)] = u16Px;
+            }
+
+            continue;
+        }
+
+        switch (u32Op & DISP_IMAGE_OP_MASK)
+        {
+        case DISP_IMAGE_OP_INDEX:
+            u16Px = pu16Index[u32Op];
+            pu16Dst[x++] = u16Px;
+            continue;
+
+        case DISP_IMAGE_OP_DIFF:
+            u16Px = image_add_rgb(u16Px, (int)((u32Op >> 4) & 3) - 2, (int)((u32Op >> 2) & 3) - 2, (int)(u32Op & 3) - 2);
+            break;
+
+        case DISP_IMAGE_OP_LUMA:
+        {
+            int i32DG = (int)(u32Op & 0x3F) - 32;
+
+            if (pu8Cur >= pu8End)
+                return -1;
+
+            u32Op = *pu8Cur++;
+            u16Px = image_add_rgb(u16Px, (i32DG >> 1) + (int)(u32Op >> 4) - 8, i32DG, (i32DG >> 1) + (int)(u32Op & 0xF) - 8);
+        }
+        break;
+
+        default:
+            /* RUN */
+            u32Num = (u32Op & ~DISP_IMAGE_OP_MASK) + 1;
+
+            if (u32Num > (uint32_t)(i32Width - x))
+                return -1;
+
+            while (u32Num--)
+                pu16Dst[x++] = u16Px;
+
+            continue;
+        }
+
+        pu16Index[DISP_IMAGE_HASH(u16Px)] = u16Px;
+        pu16Dst[x++] = u16Px;
+    }
+
+    psDec->m_pu8Cur = pu8Cur;
+    psDec->m_u16Prev = u16Px;
+
+    return 0;
+}
+
+// Function to decode the next rows, the last row stays referenced until the group ends. Returns the rows decoded, negative if the data is corrupt
+int disp_image_decode_rows(S_DISP_IMAGE_DEC *psDec, uint16_t *pu16Dst, int i32Stride, int i32Rows)
+{
+    int i32Done = 0;
+    uint32_t u32GroupRows = psDec->m_psHdr->m_u16GroupRows;
+
+    while ((i32Done < i32Rows) && (psDec->m_i32Row < psDec->m_psHdr->m_u16Height))
+    {
+        /* Each group starts from its own table entry, a corrupt group cannot run into the next. */
+        if (psDec->m_i32Row && !((uint32_t)psDec->m_i32Row % u32GroupRows))
+            image_start_group(psDec, psDec->m_i32Row / u32GroupRows);
+
+        if (image_decode_row(psDec, pu16Dst) < 0)
+            return -1;
+
+        psDec->m_pu16Above = pu16Dst;
+        psDec->m_i32Row++;
+        pu16Dst += i32Stride;
+        i32Done++;
+    }
+
+    return i32Done;
+}
+
+// Function to decode a whole image into a buffer of i32Stride pixels per row
+int disp_image_decode(const void *pvImage, uint32_t u32Size, uint16_t *pu16Dst, int i32Stride)
+{
+    S_DISP_IMAGE_DEC sDec;
+
+    if (disp_image_open(&sDec, pvImage, u32Size) < 0)
+        return -1;
+
+    return (disp_image_decode_rows(&sDec, pu16Dst, i32Stride, sDec.m_psHdr->m_u16Height) == sDec.m_psHdr->m_u16Height) ? 0 : -1;
+}
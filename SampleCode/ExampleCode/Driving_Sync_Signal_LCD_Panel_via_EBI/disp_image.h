@@ -0,0 +1,103 @@
+/**************************************************************************//**
+ * @file     disp_image.h
+ * @brief    Compressed RGB565 image container with a streaming decoder.
+ *           The image is cut into groups of rows, every group restarts the
+ *           coder state, so decoding can begin at any group and move on row
+ *           by row into VRAM or line buffers. host/disp_imgenc.c encodes
+ *           raw RGB565 dumps into this format.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_IMAGE_H__
+#define __DISP_IMAGE_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISP_IMAGE_MAGIC           0x35363551UL   /*!< "Q565" */
+#define DISP_IMAGE_INDEX_SIZE      64             /*!< Recently seen pixels addressed by DISP_IMAGE_OP_INDEX */
+
+/*
+ * Coded data, one byte opcode per pixel or pixel span. Opcodes never cross
+ * the end of a row. prev is the last pixel decoded, 0 at the start of a group.
+ *
+ *   00iiiiii                  INDEX    pixel = index[i]
+ *   01rrggbb                  DIFF     pixel = prev + (r-2, g-2, b-2) per 5/6/5 channel
+ *   10gggggg rrrrbbbb         LUMA     dg = g-32, dr = dg/2 + r-8, db = dg/2 + b-8
+ *   11nnnnnn (n < 60)         RUN      n+1 copies of prev
+ *   0xFC nnnnnnnn             COPY     n+1 pixels from the row above, same group only
+ *   0xFD nnnnnnnn p0 .. pn    LITERAL  n+1 raw little-endian pixels
+ *   0xFE p0                   RAW      one raw little-endian pixel
+ *
+ * Every pixel of INDEX, DIFF, LUMA, LITERAL and RAW is stored in
+ * index[DISP_IMAGE_HASH(pixel)], RUN and COPY leave the index alone.
+ */
+#define DISP_IMAGE_OP_INDEX        0x00
+#define DISP_IMAGE_OP_DIFF         0x40
+#define DISP_IMAGE_OP_LUMA         0x80
+#define DISP_IMAGE_OP_RUN          0xC0
+#define DISP_IMAGE_OP_COPY         0xFC
+#define DISP_IMAGE_OP_LITERAL      0xFD
+#define DISP_IMAGE_OP_RAW          0xFE
+#define DISP_IMAGE_OP_MASK         0xC0
+#define DISP_IMAGE_RUN_MAX         60
+#define DISP_IMAGE_SPAN_MAX        256
+
+// Pixel formats of the assets host/disp_imgconv.c produces
+typedef enum
+{
+    evDispImageRGB565,     /*!< Raw little-endian RGB565 rows */
+    evDispImageCLUT8,      /*!< RGB565 palette followed by rows of 8-bit palette indices */
+    evDispImageQ565,       /*!< Compressed container of this header */
+    evDispImageCNT         /*!< Number of formats */
+} E_DISP_IMAGE_FORMAT;
+
+#define DISP_IMAGE_HASH(px)        ((((px) >> 11) * 3 + (((px) >> 5) & 0x3F) * 5 + ((px) & 0x1F) * 7) & (DISP_IMAGE_INDEX_SIZE - 1))
+
+// Container header, followed by the group offset table and the coded data
+typedef struct
+{
+    uint32_t m_u32Magic;        /*!< DISP_IMAGE_MAGIC */
+    uint16_t m_u16Width;        /*!< Width in pixels */
+    uint16_t m_u16Height;       /*!< Height in pixels */
+    uint16_t m_u16GroupRows;    /*!< Rows per restart group */
+    uint16_t m_u16Groups;       /*!< Entries of the group offset table */
+    uint32_t m_u32DataSize;     /*!< Bytes of coded data */
+    /* uint32_t m_au32GroupOffset[m_u16Groups]; offset of each group in the coded data */
+} S_DISP_IMAGE_HDR;
+
+// Streaming decoder state
+typedef struct
+{
+    const S_DISP_IMAGE_HDR *m_psHdr;
+    const uint32_t *m_pu32GroupOffset;
+    const uint8_t  *m_pu8Data;          /*!< Start of the coded data */
+    const uint8_t  *m_pu8Cur;           /*!< Next opcode */
+    const uint8_t  *m_pu8End;           /*!< End of the coded data */
+    const uint16_t *m_pu16Above;        /*!< Last row decoded in this group, NULL at the start of a group */
+    int             m_i32Row;           /*!< Next row to decode */
+    uint16_t        m_u16Prev;
+    uint16_t        m_au16Index[DISP_IMAGE_INDEX_SIZE];
+} S_DISP_IMAGE_DEC;
+
+// Function to check an image and start decoding at row 0, returns negative if the image is malformed
+int disp_image_open(S_DISP_IMAGE_DEC *psDec, const void *pvImage, uint32_t u32Size);
+
+// Function to restart decoding at the group holding a row, returns the first row of that group
+int disp_image_seek(S_DISP_IMAGE_DEC *psDec, int i32Row);
+
+// Function to decode the next rows, the last row stays referenced until the group ends. Returns the rows decoded, negative if the data is corrupt
+int disp_image_decode_rows(S_DISP_IMAGE_DEC *psDec, uint16_t *pu16Dst, int i32Stride, int i32Rows);
+
+// Function to decode a whole image into a buffer of i32Stride pixels per row
+int disp_image_decode(const void *pvImage, uint32_t u32Size, uint16_t *pu16Dst, int i32Stride);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_IMAGE_H__ */
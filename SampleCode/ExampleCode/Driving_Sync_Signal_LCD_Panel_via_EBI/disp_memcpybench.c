@@ -0,0 +1,245 @@
+/**************************************************************************//**
+ * @file     disp_memcpybench.c
+ * @brief    Report the throughput of CPU memcpy, nu_pdma_memcpy and
+ *           dma350_memcpy on GDMA CH0 over the UART console. Enable
+ *           CONFIG_DISP_MEMCPYBENCH in disp.h, GDMA target only. The buffer
+ *           on screen is copied into the other VRAM buffer with both
+ *           addresses aligned, one pixel off and one byte off, for a frame
+ *           and for a line. DMA times include the cache maintenance the copy
+ *           needs. A set of tile blits then runs as one dma350_draw_from_canvas
+ *           call each and as one recorded dma350 command list. The VRAM
+ *           content is overwritten.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "dma350_lib.h"
+#include "disp.h"
+#include "pdma_lib.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_MEMCPYBENCH)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_MEMCPYBENCH_LOOPS    4     /*!< Copies timed per method, size and offset */
+#define DEF_MEMCPYBENCH_SLACK    8     /*!< Bytes left for the offsets at the end of the buffers */
+#define DEF_MEMCPYBENCH_TILE     32    /*!< Width and height of a blit in pixels */
+#define DEF_MEMCPYBENCH_BLITS    48    /*!< Blits per batch */
+
+typedef enum
+{
+    evMemcpyCPU,
+    evMemcpyPDMA,
+    evMemcpyGDMA,
+    evMemcpyCNT
+} E_MEMCPYBENCH_METHOD;
+
+extern struct dma350_ch_dev_t *const GDMA_CH_DEV_S[];
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+static uint32_t s_au32BlitCmd[DMA350_CMDLIST_WORDS(DEF_MEMCPYBENCH_BLITS)];
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to copy once with a method, returns negative on failure
+static int memcpybench_copy(E_MEMCPYBENCH_METHOD evMethod, uint8_t *pu8Dst, const uint8_t *pu8Src, uint32_t u32Size)
+{
+    if (evMethod == evMemcpyCPU)
+    {
+        memcpy(pu8Dst, pu8Src, u32Size);
+        return 0;
+    }
+
+    SCB_CleanDCache_by_Addr((void *)pu8Src, (int32_t)u32Size);
+    SCB_CleanInvalidateDCache_by_Addr(pu8Dst, (int32_t)u32Size);
+
+    if (evMethod == evMemcpyPDMA)
+        return (nu_pdma_memcpy(pu8Dst, (void *)pu8Src, u32Size) == pu8Dst) ? 0 : -1;
+
+    if (dma350_memcpy(GDMA_CH_DEV_S[0], pu8Src, pu8Dst, u32Size, DMA350_LIB_EXEC_BLOCKING) != DMA350_LIB_ERR_NONE)
+        return -1;
+
+    SCB_InvalidateDCache_by_Addr(pu8Dst, (int32_t)u32Size);
+
+    return 0;
+}
+
+// Function to time one method, returns the throughput in MB/s x10 or 0 on failure
+static uint32_t memcpybench_run(E_MEMCPYBENCH_METHOD evMethod, uint8_t *pu8Dst, const uint8_t *pu8Src, uint32_t u32Size)
+{
+    uint32_t u32Loop, u32Start, u32Cycles = 0;
+
+    for (u32Loop = 0; u32Loop < DEF_MEMCPYBENCH_LOOPS; u32Loop++)
+    {
+        u32Start = nu_cyccnt_get();
+
+        if (memcpybench_copy(evMethod, pu8Dst, pu8Src, u32Size) < 0)
+            return 0;
+
+        u32Cycles += nu_cyccnt_get() - u32Start;
+    }
+
+    if (memcmp(pu8Dst, pu8Src, u32Size) != 0)
+        return 0;
+
+    return (uint32_t)(((uint64_t)u32Size * DEF_MEMCPYBENCH_LOOPS * nu_cyccnt_freq() * 10) / ((uint64_t)u32Cycles * 1000000));
+}
+
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+// Function to get the pixel of blit n, tiles in rows across the panel
+static uint32_t memcpybench_blit_pos(uint32_t u32Blit)
+{
+    uint32_t u32Cols = CONFIG_TIMING_HACT / DEF_MEMCPYBENCH_TILE;
+
+    return ((u32Blit / u32Cols) * DEF_MEMCPYBENCH_TILE * CONFIG_TIMING_HACT) + ((u32Blit % u32Cols) * DEF_MEMCPYBENCH_TILE);
+}
+
+// Function to time the tile blits one call each and as one command list, returns negative on failure
+static int memcpybench_blits(uint16_t *pu16Dst, const uint16_t *pu16Src)
+{
+    struct dma350_cmdlist_t sList;
+    uint32_t u32Blit, u32Start, u32Single, u32Record, u32Submit;
+
+    SCB_CleanDCache_by_Addr((void *)pu16Src, CONFIG_VRAM_BUF_SIZE);
+    SCB_CleanInvalidateDCache_by_Addr(pu16Dst, CONFIG_VRAM_BUF_SIZE);
+
+    /* One start and one wait per blit */
+    u32Start = nu_cyccnt_get();
+
+    for (u32Blit = 0; u32Blit < DEF_MEMCPYBENCH_BLITS; u32Blit++)
+    {
+        uint32_t u32Pos = memcpybench_blit_pos(u32Blit);
+
+        if (dma350_draw_from_canvas(GDMA_CH_DEV_S[0], &pu16Src[u32Pos], &pu16Dst[u32Pos],
+                                    DEF_MEMCPYBENCH_TILE, DEF_MEMCPYBENCH_TILE, CONFIG_TIMING_HACT,
+                                    DEF_MEMCPYBENCH_TILE, DEF_MEMCPYBENCH_TILE, CONFIG_TIMING_HACT,
+                                    DMA350_CH_TRANSIZE_16BITS, DMA350_LIB_TRANSFORM_NONE,
+                                    DMA350_LIB_EXEC_BLOCKING) != DMA350_LIB_ERR_NONE)
+            return -1;
+    }
+
+    u32Single = nu_cyccnt_get() - u32Start;
+
+    /* The same blits recorded, then one start and one wait */
+    u32Start = nu_cyccnt_get();
+
+    if (dma350_cmdlist_init(&sList, s_au32BlitCmd, sizeof(s_au32BlitCmd) / sizeof(s_au32BlitCmd[0])) != DMA350_LIB_ERR_NONE)
+        return -1;
+
+    for (u32Blit = 0; u32Blit < DEF_MEMCPYBENCH_BLITS; u32Blit++)
+    {
+        uint32_t u32Pos = memcpybench_blit_pos(u32Blit);
+
+        if (dma350_cmdlist_draw_from_canvas(&sList, &pu16Src[u32Pos], &pu16Dst[u32Pos],
+                                            DEF_MEMCPYBENCH_TILE, DEF_MEMCPYBENCH_TILE, CONFIG_TIMING_HACT,
+                                            DEF_MEMCPYBENCH_TILE, DEF_MEMCPYBENCH_TILE, CONFIG_TIMING_HACT,
+                                            DMA350_CH_TRANSIZE_16BITS, DMA350_LIB_TRANSFORM_NONE) != DMA350_LIB_ERR_NONE)
+            return -1;
+    }
+
+    u32Record = nu_cyccnt_get() - u32Start;
+    u32Start = nu_cyccnt_get();
+
+    if (dma350_cmdlist_submit(GDMA_CH_DEV_S[0], &sList, DMA350_LIB_EXEC_BLOCKING) != DMA350_LIB_ERR_NONE)
+        return -1;
+
+    u32Submit = nu_cyccnt_get() - u32Start;
+
+    SCB_InvalidateDCache_by_Addr(pu16Dst, CONFIG_VRAM_BUF_SIZE);
+
+    u32Blit = DEF_MEMCPYBENCH_BLITS - 1;
+
+    if (memcmp(&pu16Dst[memcpybench_blit_pos(u32Blit)], &pu16Src[memcpybench_blit_pos(u32Blit)], DEF_MEMCPYBENCH_TILE * sizeof(uint16_t)) != 0)
+        return -1;
+
+    printf("%d blits of %dx%d: one call each %u us, command list of %u commands recorded in %u us, run in %u us.\n",
+           DEF_MEMCPYBENCH_BLITS, DEF_MEMCPYBENCH_TILE, DEF_MEMCPYBENCH_TILE,
+           u32Single / (nu_cyccnt_freq() / 1000000), sList.count,
+           u32Record / (nu_cyccnt_freq() / 1000000), u32Submit / (nu_cyccnt_freq() / 1000000));
+
+    return 0;
+}
+#endif
+
+// Function to report the copy benchmark
+static int disp_memcpybench_init(void)
+{
+    static const char *const s_aszMethod[evMemcpyCNT] = { "memcpy", "nu_pdma", "dma350" };
+    static const uint32_t s_au32Size[2] = { CONFIG_VRAM_BUF_SIZE - DEF_MEMCPYBENCH_SLACK, CONFIG_TIMING_HACT * sizeof(uint16_t) };
+    static const uint32_t s_au32Offset[3][2] = { { 0, 0 }, { 0, 2 }, { 1, 0 } };   /* Source and destination */
+    const uint8_t *pu8Front = (const uint8_t *)disp_get_vrambufaddr();
+    uint8_t *pu8Back = (pu8Front == disp_get_vrambuf(0)) ? disp_get_vrambuf(1) : disp_get_vrambuf(0);
+    uint32_t u32RegLocked = SYS_IsRegLocked();
+    int i32Method, i32Size, i32Offset;
+
+    nu_cyccnt_init();
+
+    /* The GDMA backend leaves the PDMA clock off. */
+    if (u32RegLocked)
+        SYS_UnlockReg();
+
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    if (u32RegLocked)
+        SYS_LockReg();
+
+    printf("Copy benchmark: %d copies per row, MB/s.\n", DEF_MEMCPYBENCH_LOOPS);
+    printf("%-8s %7s %8s %8s %8s\n", "Size", "Offset", s_aszMethod[evMemcpyCPU], s_aszMethod[evMemcpyPDMA], s_aszMethod[evMemcpyGDMA]);
+
+    for (i32Size = 0; i32Size < 2; i32Size++)
+    {
+        for (i32Offset = 0; i32Offset < 3; i32Offset++)
+        {
+            const uint8_t *pu8Src = pu8Front + s_au32Offset[i32Offset][0];
+            uint8_t *pu8Dst = pu8Back + s_au32Offset[i32Offset][1];
+
+            printf("%-8u %3u/%-3u", s_au32Size[i32Size], s_au32Offset[i32Offset][0], s_au32Offset[i32Offset][1]);
+
+            for (i32Method = 0; i32Method < evMemcpyCNT; i32Method++)
+            {
+                uint32_t u32Rate;
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+                /* CH0 prefetches lines for the scanout. */
+                if (i32Method == evMemcpyGDMA)
+                {
+                    printf(" %8s", "busy");
+                    continue;
+                }
+
+#endif
+                u32Rate = memcpybench_run((E_MEMCPYBENCH_METHOD)i32Method, pu8Dst, pu8Src, s_au32Size[i32Size]);
+
+                if (u32Rate)
+                    printf(" %6u.%u", u32Rate / 10, u32Rate % 10);
+                else
+                    printf(" %8s", "fail");
+            }
+
+            printf("\n");
+        }
+    }
+
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+    if (memcpybench_blits((uint16_t *)pu8Back, (const uint16_t *)pu8Front) < 0)
+        printf("Blits failed.\n");
+
+#endif
+
+    return 0;
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_MEMCPYBENCH", disp_memcpybench_init, NULL);
+
+#endif /* defined(CONFIG_DISP_MEMCPYBENCH) */
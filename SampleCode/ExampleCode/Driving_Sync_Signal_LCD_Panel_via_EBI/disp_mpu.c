@@ -0,0 +1,234 @@
+/**************************************************************************//**
+ * @file     disp_mpu.c
+ * @brief    Framebuffer cache policy through MPU regions. The DISP_MPU
+ *           component applies CONFIG_DISP_VRAM_CACHE_POLICY of disp.h to every
+ *           VRAM buffer at init. Armv8-M regions must not overlap, so a
+ *           buffer already covered by a BSP region (e.g. HyperRAM in MPU
+ *           region 1) keeps the attributes of that region.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "disp_mpu.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+/* mpu_config_M55M1.h packs its enabled regions from region 0, the BSP keeps the last one for non-cacheable SRAM. */
+#define DEF_MPU_BSP_REGIONS    (MPU_INIT_REGION0 + MPU_INIT_REGION1 + MPU_INIT_REGION2 + MPU_INIT_REGION3 + \
+                                MPU_INIT_REGION4 + MPU_INIT_REGION5 + MPU_INIT_REGION6)
+#define DEF_MPU_FIRST_REGION   DEF_MPU_BSP_REGIONS
+#define DEF_MPU_LAST_REGION    (MPU_REGIONS_MAX - 2)
+#define DEF_MPU_GRANULE        32
+
+#if ((MPU_INIT_MEM_ATTRS & (BIT4 | BIT5 | BIT6)) != (BIT4 | BIT5 | BIT6))
+    #error "Enable the Non-cacheable, Cacheable-WTRA and Cacheable-WBWARA attributes in mpu_config_M55M1.h."
+#endif
+
+#if (DEF_MPU_FIRST_REGION > DEF_MPU_LAST_REGION)
+    #error "No MPU region left for the display, disable one in mpu_config_M55M1.h."
+#endif
+
+// Display-owned MPU region
+typedef struct
+{
+    uint32_t            m_u32Base;
+    uint32_t            m_u32Limit;
+    E_DISP_CACHE_POLICY m_evPolicy;
+    int                 m_bUsed;
+} S_DISP_MPU_REGION;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static S_DISP_MPU_REGION s_asRegion[MPU_REGIONS_MAX];
+
+static const uint8_t s_au8PolicyAttr[evDispCacheCNT] =
+{
+    eMPU_ATTR_CACHEABLE_WBWARA,
+    eMPU_ATTR_CACHEABLE_WTRA,
+    eMPU_ATTR_NON_CACHEABLE
+};
+
+static const char *const s_aszPolicyName[evDispCacheCNT] =
+{
+    "WB+clean",
+    "WT",
+    "NC"
+};
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to drop the region attributes the DMA-350 library caches, the PDMA target does not link the library
+__WEAK void dma350_lib_memattr_flush(void)
+{
+}
+
+// Function to check whether an enabled region other than u32Skip covers part of a range
+static int disp_mpu_overlaps(uint32_t u32Base, uint32_t u32Limit, uint32_t u32Skip)
+{
+    uint32_t u32Region;
+
+    for (u32Region = 0; u32Region < MPU_REGIONS_MAX; u32Region++)
+    {
+        uint32_t u32RBAR, u32RLAR;
+
+        if (u32Region == u32Skip)
+            continue;
+
+        MPU->RNR = u32Region;
+        u32RBAR = MPU->RBAR;
+        u32RLAR = MPU->RLAR;
+
+        if (!(u32RLAR & MPU_RLAR_EN_Msk))
+            continue;
+
+        if ((u32Base <= (u32RLAR | (DEF_MPU_GRANULE - 1))) && (u32Limit >= (u32RBAR & MPU_RBAR_BASE_Msk)))
+            return 1;
+    }
+
+    return 0;
+}
+
+// Function to give a buffer its own MPU region with a cache policy, returns the region number
+int disp_mpu_set_policy(void *pvBuf, uint32_t u32Size, E_DISP_CACHE_POLICY evPolicy)
+{
+    uint32_t u32Base = (uint32_t)pvBuf;
+    uint32_t u32Limit = u32Base + u32Size - 1;
+    uint32_t u32PriMask;
+    int i32Region = -1;
+    int i;
+
+    if (!pvBuf || !u32Size || (evPolicy >= evDispCacheCNT))
+        return -1;
+
+    /* Regions are 32-byte granular, a partial granule would change the policy of a neighbour. */
+    if ((u32Base & (DEF_MPU_GRANULE - 1)) || (u32Size & (DEF_MPU_GRANULE - 1)))
+        return -1;
+
+    /* Reprogram the region of the buffer, or take a free one. */
+    for (i = DEF_MPU_FIRST_REGION; i <= DEF_MPU_LAST_REGION; i++)
+    {
+        if (s_asRegion[i].m_bUsed && (s_asRegion[i].m_u32Base == u32Base))
+        {
+            i32Region = i;
+            break;
+        }
+
+        if (!s_asRegion[i].m_bUsed && (i32Region < 0))
+            i32Region = i;
+    }
+
+    if (i32Region < 0)
+        return -2;
+
+    if (disp_mpu_overlaps(u32Base, u32Limit, (uint32_t)i32Region))
+        return -3;
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Write dirty lines back and drop them, the old attributes must not leave stale lines behind. */
+    SCB_CleanInvalidateDCache_by_Addr(pvBuf, (int32_t)u32Size);
+
+    ARM_MPU_ClrRegion((uint32_t)i32Region);
+    ARM_MPU_SetRegion((uint32_t)i32Region,
+                      ARM_MPU_RBAR(u32Base, ARM_MPU_SH_NON, 0, 0, 1),             /* Non-shareable, read/write, privileged, non-executable */
+                      ARM_MPU_RLAR(u32Limit, s_au8PolicyAttr[evPolicy]));
+    __DSB();
+    __ISB();
+    dma350_lib_memattr_flush();
+
+    __set_PRIMASK(u32PriMask);
+
+    s_asRegion[i32Region].m_u32Base = u32Base;
+    s_asRegion[i32Region].m_u32Limit = u32Limit;
+    s_asRegion[i32Region].m_evPolicy = evPolicy;
+    s_asRegion[i32Region].m_bUsed = 1;
+
+    return i32Region;
+}
+
+// Function to get the cache policy of an address, write-back if no display region covers it
+E_DISP_CACHE_POLICY disp_mpu_get_policy(const void *pvAddr)
+{
+    uint32_t u32Addr = (uint32_t)pvAddr;
+    int i;
+
+    for (i = DEF_MPU_FIRST_REGION; i <= DEF_MPU_LAST_REGION; i++)
+    {
+        if (s_asRegion[i].m_bUsed && (u32Addr >= s_asRegion[i].m_u32Base) && (u32Addr <= s_asRegion[i].m_u32Limit))
+            return s_asRegion[i].m_evPolicy;
+    }
+
+    return evDispCacheWriteBack;
+}
+
+// Function to release the MPU region of a buffer
+int disp_mpu_release(void *pvBuf)
+{
+    uint32_t u32PriMask;
+    int i;
+
+    for (i = DEF_MPU_FIRST_REGION; i <= DEF_MPU_LAST_REGION; i++)
+    {
+        if (s_asRegion[i].m_bUsed && (s_asRegion[i].m_u32Base == (uint32_t)pvBuf))
+            break;
+    }
+
+    if (i > DEF_MPU_LAST_REGION)
+        return -1;
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    SCB_CleanInvalidateDCache_by_Addr(pvBuf, (int32_t)(s_asRegion[i].m_u32Limit - s_asRegion[i].m_u32Base + 1));
+    ARM_MPU_ClrRegion((uint32_t)i);
+    __DSB();
+    __ISB();
+    dma350_lib_memattr_flush();
+
+    __set_PRIMASK(u32PriMask);
+
+    s_asRegion[i].m_bUsed = 0;
+
+    return 0;
+}
+
+// Function to get the name of a cache policy
+const char *disp_mpu_policy_name(E_DISP_CACHE_POLICY evPolicy)
+{
+    return (evPolicy < evDispCacheCNT) ? s_aszPolicyName[evPolicy] : "?";
+}
+
+// Function to apply the configured cache policy to the VRAM buffers
+static int disp_mpu_init(void)
+{
+    int i, i32Ret;
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+    {
+        i32Ret = disp_mpu_set_policy(disp_get_vrambuf(i), CONFIG_VRAM_BUF_SIZE, CONFIG_DISP_VRAM_CACHE_POLICY);
+
+        if (i32Ret < 0)
+            printf("VRAM buffer %d keeps its default cache policy (%d).\n", i, i32Ret);
+    }
+
+    return 0;
+}
+
+// Function to give the VRAM buffers back to the default memory map
+static int disp_mpu_fini(void)
+{
+    int i;
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+        disp_mpu_release(disp_get_vrambuf(i));
+
+    return 0;
+}
+
+COMPONENT_EXPORT("DISP_MPU", disp_mpu_init, disp_mpu_fini);
@@ -0,0 +1,45 @@
+/**************************************************************************//**
+ * @file     disp_mpu.h
+ * @brief    Framebuffer cache policy through MPU regions. A buffer gets its
+ *           own MPU region with write-back, write-through or non-cacheable
+ *           memory attributes. The regions come from the ones
+ *           mpu_config_M55M1.h leaves free below the BSP non-cacheable
+ *           region.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_MPU_H__
+#define __DISP_MPU_H__
+
+#include "NuMicro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    evDispCacheWriteBack,      /*!< Cacheable write-back, the buffer needs a D-cache clean before the DMA reads it */
+    evDispCacheWriteThrough,   /*!< Cacheable write-through, writes reach SRAM at once, reads still hit the cache */
+    evDispCacheNonCacheable,   /*!< Not cached, every CPU access goes to SRAM */
+    evDispCacheCNT             /*!< Number of cache policies */
+} E_DISP_CACHE_POLICY;
+
+// Function to give a buffer its own MPU region with a cache policy, returns the region number
+int disp_mpu_set_policy(void *pvBuf, uint32_t u32Size, E_DISP_CACHE_POLICY evPolicy);
+
+// Function to get the cache policy of an address, write-back if no display region covers it
+E_DISP_CACHE_POLICY disp_mpu_get_policy(const void *pvAddr);
+
+// Function to release the MPU region of a buffer
+int disp_mpu_release(void *pvBuf);
+
+// Function to get the name of a cache policy
+const char *disp_mpu_policy_name(E_DISP_CACHE_POLICY evPolicy);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_MPU_H__ */
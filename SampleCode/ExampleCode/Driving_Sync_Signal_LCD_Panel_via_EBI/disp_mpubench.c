@@ -0,0 +1,161 @@
+/**************************************************************************//**
+ * @file     disp_mpubench.c
+ * @brief    Report render and flip cost of each VRAM cache policy over the
+ *           UART console. Enable CONFIG_DISP_MPUBENCH in disp.h. The back
+ *           buffer is switched through every policy of disp_mpu.h, a
+ *           write-only fill and a read-modify-write blend are timed, then
+ *           the flip: a D-cache clean for write-back, a barrier otherwise.
+ *           The back buffer content is overwritten.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "disp_mpu.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_MPUBENCH)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_MPUBENCH_PASSES    4    /*!< Render passes per policy */
+#define DEF_MPUBENCH_WORDS     (CONFIG_VRAM_BUF_SIZE / sizeof(uint32_t))
+
+// Averaged cycles of one policy
+typedef struct
+{
+    uint32_t m_u32Fill;
+    uint32_t m_u32Blend;
+    uint32_t m_u32Flip;
+} S_MPUBENCH_RESULT;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to write a gradient over the whole buffer, returns the elapsed cycles
+static uint32_t mpubench_fill(volatile uint32_t *pu32Dst, uint32_t u32Seed)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32Pixel = u32Seed * 0x00010001UL;
+    uint32_t i;
+
+    for (i = 0; i < DEF_MPUBENCH_WORDS; i++)
+    {
+        pu32Dst[i] = u32Pixel;
+        u32Pixel += 0x00010001UL;
+    }
+
+    return nu_cyccnt_get() - u32Start;
+}
+
+// Function to blend a color 50% over the whole buffer, two RGB565 pixels per word, returns the elapsed cycles
+static uint32_t mpubench_blend(volatile uint32_t *pu32Dst, uint32_t u32Color)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32Half = (u32Color >> 1) & 0x7BEF7BEFUL;
+    uint32_t i;
+
+    for (i = 0; i < DEF_MPUBENCH_WORDS; i++)
+        pu32Dst[i] = ((pu32Dst[i] >> 1) & 0x7BEF7BEFUL) + u32Half;
+
+    return nu_cyccnt_get() - u32Start;
+}
+
+// Function to make the buffer visible to the scanout DMA, returns the elapsed cycles
+static uint32_t mpubench_flip(void *pvBuf, E_DISP_CACHE_POLICY evPolicy)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+
+    if (evPolicy == evDispCacheWriteBack)
+        SCB_CleanDCache_by_Addr(pvBuf, CONFIG_VRAM_BUF_SIZE);
+    else
+        __DSB();
+
+    return nu_cyccnt_get() - u32Start;
+}
+
+// Function to convert average cycles of one buffer pass to KB/s
+static uint32_t mpubench_kbps(uint32_t u32Cycles)
+{
+    return u32Cycles ? (uint32_t)(((uint64_t)CONFIG_VRAM_BUF_SIZE * nu_cyccnt_freq()) / ((uint64_t)u32Cycles * 1024ULL)) : 0;
+}
+
+// Function to print one report row
+static void mpubench_print_row(E_DISP_CACHE_POLICY evPolicy, const S_MPUBENCH_RESULT *psRes)
+{
+    uint32_t u32FillKBps = mpubench_kbps(psRes->m_u32Fill);
+    uint32_t u32BlendKBps = mpubench_kbps(psRes->m_u32Blend);
+
+    printf("%-9s %10u %10u %10u %10u %6u.%02u %7u.%02u\n",
+           disp_mpu_policy_name(evPolicy),
+           psRes->m_u32Fill, psRes->m_u32Blend, psRes->m_u32Flip,
+           psRes->m_u32Fill + psRes->m_u32Flip,
+           u32FillKBps / 1024, ((u32FillKBps % 1024) * 100) / 1024,
+           u32BlendKBps / 1024, ((u32BlendKBps % 1024) * 100) / 1024);
+}
+
+// Function to report the cache policy benchmark
+static int disp_mpubench_init(void)
+{
+    S_MPUBENCH_RESULT sRes;
+    uint32_t *pu32Back = NULL;
+    int i32Policy, i;
+
+    /* Render into the buffer the panel is not showing. */
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+    {
+        if (disp_get_vrambuf(i) != disp_get_vrambufaddr())
+        {
+            pu32Back = (uint32_t *)disp_get_vrambuf(i);
+            break;
+        }
+    }
+
+    if (!pu32Back)
+    {
+        printf("MPU benchmark: no back buffer.\n");
+        return -1;
+    }
+
+    nu_cyccnt_init();
+
+    printf("MPU benchmark: %u bytes per pass, %d passes.\n", (uint32_t)CONFIG_VRAM_BUF_SIZE, DEF_MPUBENCH_PASSES);
+    printf("%-9s %10s %10s %10s %10s %9s %10s\n", "Policy", "Fill", "Blend", "Flip", "Fill+Flip", "Fill MB/s", "Blend MB/s");
+
+    for (i32Policy = 0; i32Policy < evDispCacheCNT; i32Policy++)
+    {
+        uint64_t u64Fill = 0, u64Blend = 0, u64Flip = 0;
+        int i32Ret = disp_mpu_set_policy(pu32Back, CONFIG_VRAM_BUF_SIZE, (E_DISP_CACHE_POLICY)i32Policy);
+
+        if (i32Ret < 0)
+        {
+            printf("%-9s cannot program an MPU region (%d).\n", disp_mpu_policy_name((E_DISP_CACHE_POLICY)i32Policy), i32Ret);
+            continue;
+        }
+
+        for (i = 0; i < DEF_MPUBENCH_PASSES; i++)
+        {
+            u64Fill  += mpubench_fill(pu32Back, i);
+            u64Flip  += mpubench_flip(pu32Back, (E_DISP_CACHE_POLICY)i32Policy);
+            u64Blend += mpubench_blend(pu32Back, 0xF800F800UL);
+            u64Flip  += mpubench_flip(pu32Back, (E_DISP_CACHE_POLICY)i32Policy);
+        }
+
+        sRes.m_u32Fill = (uint32_t)(u64Fill / DEF_MPUBENCH_PASSES);
+        sRes.m_u32Blend = (uint32_t)(u64Blend / DEF_MPUBENCH_PASSES);
+        sRes.m_u32Flip = (uint32_t)(u64Flip / (2 * DEF_MPUBENCH_PASSES));
+
+        mpubench_print_row((E_DISP_CACHE_POLICY)i32Policy, &sRes);
+    }
+
+    /* Back to the configured policy. */
+    disp_mpu_set_policy(pu32Back, CONFIG_VRAM_BUF_SIZE, CONFIG_DISP_VRAM_CACHE_POLICY);
+
+    return 0;
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_MPUBENCH", disp_mpubench_init, NULL);
+
+#endif /* defined(CONFIG_DISP_MPUBENCH) */
@@ -0,0 +1,124 @@
+/**************************************************************************//**
+ * @file     disp_panel.h
+ * @brief    Compile-time layout of the scanout ring, shared by the PDMA and
+ *           GDMA backends. The panel timing and the DE/HSYNC/VSYNC bits of
+ *           disp.h fold into constants here: which stage a line is in, how
+ *           many pixel clocks a stage lasts and which EBI address drives its
+ *           signal levels. A backend only turns each stage into its own
+ *           descriptor format and checks its ring against DISP_PANEL_DSC_NUM
+ *           and its transfer limit with _Static_assert.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_PANEL_H__
+#define __DISP_PANEL_H__
+
+#include "disp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DISP_PANEL_MAX(a, b)          (((a) > (b)) ? (a) : (b))
+
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    /* One descriptor holds DE low through all blank lines, the active lines follow. */
+    #define DISP_PANEL_BLANK_DSC      1
+    #define DISP_PANEL_BLANK_XFER     ((CONFIG_TIMING_VFP + CONFIG_TIMING_VPW + CONFIG_TIMING_VBP) * DEF_HACT_ALL)   /*!< Pixel clocks of the blank descriptor */
+    #define DISP_PANEL_XFER_MAX       DISP_PANEL_MAX(DISP_PANEL_BLANK_XFER, DISP_PANEL_MAX(DEF_HACT_INDEX, CONFIG_TIMING_HACT))
+#else
+    #define DISP_PANEL_BLANK_DSC      0
+    #define DISP_PANEL_XFER_MAX       DISP_PANEL_MAX(DISP_PANEL_MAX(CONFIG_TIMING_HFP, CONFIG_TIMING_HPW), \
+                                                     DISP_PANEL_MAX(CONFIG_TIMING_HBP, CONFIG_TIMING_HACT))
+#endif
+
+#define DISP_PANEL_DSC_NUM            (DISP_PANEL_BLANK_DSC + DEF_TOTAL_VLINES * evHStageCNT)   /*!< Descriptors in the ring */
+
+#if defined(CONFIG_DISP_PANEL2)
+    /* The ring of the second panel is the first one moved to its bank, the sync bits stay. */
+    #define DISP_PANEL2_EBI_OFFSET    ((CONFIG_DISP_PANEL2_EBI - CONFIG_DISP_EBI) * EBI_MAX_SIZE)
+#endif
+
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    #if (CONFIG_TIMING_HACT <= 0) || (CONFIG_TIMING_VACT <= 0) || (DEF_HACT_INDEX <= 0) || ((DEF_VACT_ALL - CONFIG_TIMING_VACT) <= 0)
+        #error "DE-only mode needs horizontal and vertical blanking, a descriptor cannot move nothing."
+    #endif
+#elif (CONFIG_TIMING_HACT <= 0) || (CONFIG_TIMING_VACT <= 0) || (CONFIG_TIMING_HFP <= 0) || (CONFIG_TIMING_HPW <= 0) || \
+      (CONFIG_TIMING_HBP <= 0) || (CONFIG_TIMING_VFP <= 0) || (CONFIG_TIMING_VPW <= 0) || (CONFIG_TIMING_VBP <= 0)
+    #error "Every CONFIG_TIMING_* stage needs at least one clock or line, a descriptor cannot move nothing."
+#endif
+
+/* The 16-bit bus drops address bit 0, bit 1 drives EBI_ADR0 and one bank decodes 1 MB. */
+#if (CONFIG_DISP_DE_BITIDX < 1) || (CONFIG_DISP_DE_BITIDX > 19) || \
+    (CONFIG_DISP_HSYNC_BITIDX < 1) || (CONFIG_DISP_HSYNC_BITIDX > 19) || \
+    (CONFIG_DISP_VSYNC_BITIDX < 1) || (CONFIG_DISP_VSYNC_BITIDX > 19)
+    #error "CONFIG_DISP_*_BITIDX must select EBI address bit 1 to 19."
+#endif
+
+#if (CONFIG_DISP_DE_BITIDX == CONFIG_DISP_HSYNC_BITIDX) || (CONFIG_DISP_DE_BITIDX == CONFIG_DISP_VSYNC_BITIDX) || \
+    (CONFIG_DISP_HSYNC_BITIDX == CONFIG_DISP_VSYNC_BITIDX)
+    #error "DE, HSYNC and VSYNC need their own EBI address bits."
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to get the V stage of a ring line, line 0 is the first VFP line, or the first active line in DE-only mode
+__STATIC_INLINE E_VSTAGE disp_panel_vstage(int i32Line)
+{
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    (void)i32Line;
+    return evVStageVACT;
+#else
+    return (i32Line < CONFIG_TIMING_VFP) ? evVStageVFP :
+           (i32Line < (CONFIG_TIMING_VFP + CONFIG_TIMING_VPW)) ? evVStageVSYNC :
+           (i32Line < DEF_VACT_INDEX) ? evVStageVBP : evVStageVACT;
+#endif
+}
+
+// Function to get the pixel clocks of an H stage
+__STATIC_INLINE uint32_t disp_panel_hstage_xfer(E_HSTAGE evH)
+{
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    return (evH == evHStageHACT) ? CONFIG_TIMING_HACT : DEF_HACT_INDEX;
+#else
+    return (evH == evHStageHFP) ? CONFIG_TIMING_HFP :
+           (evH == evHStageHSYNC) ? CONFIG_TIMING_HPW :
+           (evH == evHStageHBP) ? CONFIG_TIMING_HBP : CONFIG_TIMING_HACT;
+#endif
+}
+
+// Function to tell whether a stage scans out the VRAM, the other stages repeat the blank word
+__STATIC_INLINE int disp_panel_is_active(E_VSTAGE evV, E_HSTAGE evH)
+{
+    return (evV == evVStageVACT) && (evH == evHStageHACT);
+}
+
+// Function to get the EBI address a stage writes to, its address bits are the DE, HSYNC and VSYNC levels
+__STATIC_INLINE uint32_t disp_panel_ebi_addr(E_VSTAGE evV, E_HSTAGE evH)
+{
+    uint32_t u32Addr = CONFIG_DISP_EBI_ADDR;
+
+#if !defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    if (evV == evVStageVSYNC)
+        u32Addr += CONFIG_DISP_VSYNC_ACTIVE;
+
+    if (evH == evHStageHSYNC)
+        u32Addr += CONFIG_DISP_HSYNC_ACTIVE;
+#endif
+
+    if (disp_panel_is_active(evV, evH))
+        u32Addr += CONFIG_DISP_DE_ACTIVE;
+
+    return u32Addr;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_PANEL_H__ */
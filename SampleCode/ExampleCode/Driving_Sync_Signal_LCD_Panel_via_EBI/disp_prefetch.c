@@ -0,0 +1,149 @@
+/**************************************************************************//**
+ * @file     disp_prefetch.c
+ * @brief    Prefetch VRAM lines from HyperRAM into SRAM line buffers ahead of
+ *           the EBI scanout. Enable CONFIG_DISP_VRAM_IN_HYPERRAM in disp.h.
+ *           The scanout ring reads CONFIG_DISP_PREFETCH_LINES line buffers in
+ *           turn, a second DMA channel of the backend refills each buffer
+ *           once the scanout has moved past it. The backend paces the
+ *           prefetch with a line-interrupt on every active line.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp.h"
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_PREFETCH_LINE_SIZE    (CONFIG_TIMING_HACT * sizeof(uint16_t))
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+#if defined(NVT_NONCACHEABLE)
+    NVT_NONCACHEABLE static uint16_t s_au16LineBuf[CONFIG_DISP_PREFETCH_LINES][CONFIG_TIMING_HACT] __attribute__((aligned(DCACHE_LINE_SIZE)));
+#else
+    static uint16_t s_au16LineBuf[CONFIG_DISP_PREFETCH_LINES][CONFIG_TIMING_HACT] __attribute__((aligned(DCACHE_LINE_SIZE)));
+#endif
+
+static DispPrefetchCopy s_pfnCopy = NULL;
+static const uint16_t *s_pu16Frame = NULL;
+static volatile int s_i32FillLine = 0;      /*!< Lines copied into the line buffers in this frame */
+static volatile int s_i32ScanLine = 0;      /*!< Line the scanout is on */
+static volatile int s_bBusy = 0;            /*!< A line copy is in flight */
+static volatile int s_bStale = 0;           /*!< The copy in flight belongs to the previous frame */
+static S_DISP_PREFETCH_STATS s_sStats;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to start the next line copy once its line buffer is no longer scanned out
+static void disp_prefetch_kick(void)
+{
+    int i32Line = s_i32FillLine;
+
+    if (s_bBusy || !s_pfnCopy || !s_pu16Frame)
+        return;
+
+    /* Line i32Line reuses the buffer of line (i32Line - CONFIG_DISP_PREFETCH_LINES). */
+    if ((i32Line >= CONFIG_TIMING_VACT) || (i32Line >= (s_i32ScanLine + CONFIG_DISP_PREFETCH_LINES)))
+        return;
+
+    s_bBusy = 1;
+
+    if (s_pfnCopy(s_au16LineBuf[i32Line % CONFIG_DISP_PREFETCH_LINES],
+                  &s_pu16Frame[i32Line * CONFIG_TIMING_HACT],
+                  DEF_PREFETCH_LINE_SIZE) < 0)
+    {
+        s_bBusy = 0;
+        s_sStats.m_u32CopyErrors++;
+    }
+}
+
+// Function to initialize the line prefetcher with the backend copy function
+void disp_prefetch_init(DispPrefetchCopy pfnCopy)
+{
+    s_pfnCopy = pfnCopy;
+    s_pu16Frame = NULL;
+    s_i32FillLine = 0;
+    s_i32ScanLine = 0;
+    s_bBusy = 0;
+    s_bStale = 0;
+    memset(&s_sStats, 0, sizeof(s_sStats));
+}
+
+// Function to get the SRAM line buffer the ring scans out for an active line
+uint16_t *disp_prefetch_get_linebuf(int i32Line)
+{
+    return s_au16LineBuf[i32Line % CONFIG_DISP_PREFETCH_LINES];
+}
+
+// Function to restart the prefetch on a VRAM buffer at the vertical blank
+void disp_prefetch_frame(const uint16_t *pu16Frame)
+{
+    /* A late copy of the last lines lands in a buffer the new frame refills later. */
+    s_bStale = s_bBusy;
+
+    s_pu16Frame = pu16Frame;
+    s_i32FillLine = 0;
+    s_i32ScanLine = 0;
+    s_sStats.m_u32Frames++;
+
+    /* The vertical blank leaves time to fill every line buffer before line 0. */
+    disp_prefetch_kick();
+}
+
+// Function to advance the prefetch from the ring descriptor the scanout is on, returns the line or CONFIG_TIMING_VACT at the end of the frame
+int disp_prefetch_scanline(uint32_t u32DscIdx)
+{
+    int i32Line;
+
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    /* One blanking descriptor, then a porch/active pair per line. */
+    i32Line = u32DscIdx ? (int)((u32DscIdx - 1) / evHStageCNT) : -1;
+#else
+    /* Four H stages per line, the active lines follow VFP, VSYNC and VBP. */
+    i32Line = (int)(u32DscIdx / evHStageCNT) - DEF_VACT_INDEX;
+#endif
+
+    /* The line-interrupt of the last line lands in the vertical blank. */
+    if (i32Line < 0)
+        return CONFIG_TIMING_VACT;
+
+    /* Checked as the porch of the line starts, the active pixels follow. */
+    if (s_i32FillLine <= i32Line)
+        s_sStats.m_u32Underruns++;
+
+    s_i32ScanLine = i32Line;
+    disp_prefetch_kick();
+
+    return i32Line;
+}
+
+// Function to complete the line copy in flight
+void disp_prefetch_copy_done(void)
+{
+    if (s_bStale)
+    {
+        s_bStale = 0;
+    }
+    else
+    {
+        s_i32FillLine++;
+        s_sStats.m_u32Lines++;
+    }
+
+    s_bBusy = 0;
+    disp_prefetch_kick();
+}
+
+// Function to get the line prefetcher statistics
+void disp_prefetch_get_stats(S_DISP_PREFETCH_STATS *psStats)
+{
+    *psStats = s_sStats;
+}
+
+#endif /* defined(CONFIG_DISP_VRAM_IN_HYPERRAM) */
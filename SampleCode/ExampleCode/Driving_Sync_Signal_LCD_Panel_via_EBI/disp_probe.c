@@ -0,0 +1,126 @@
+/**************************************************************************//**
+ * @file     disp_probe.c
+ * @brief    Statistics and report of the hot-path probes of disp_probe.h.
+ *           Enable CONFIG_DISP_PROBE in disp.h, main() starts the counters
+ *           and dumps the report when 'p' arrives on the debug UART.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "disp_probe.h"
+
+#if defined(CONFIG_DISP_PROBE)
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+/* Probes run in the interrupts, keep their statistics off the D-cache and the bus the scanout uses. */
+#if defined(NVT_DTCM)
+    NVT_DTCM S_DISP_PROBE g_asDispProbe[evDispProbeCNT];
+#else
+    S_DISP_PROBE g_asDispProbe[evDispProbeCNT];
+#endif
+
+#if defined(__CMSIS_HOST_H__)
+    uint32_t g_au32DispProbeHostEvent[evDispProbeCounterCNT];
+#endif
+
+static const char *const s_aszDispProbeName[evDispProbeCNT] =
+{
+    "RingBuild",
+    "PdmaIsr",
+    "GdmaIsr",
+    "BlankCb",
+    "TileReplay"
+};
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to start the cycle counter and the PMU event counters
+void disp_probe_start(void)
+{
+    nu_cyccnt_init();
+
+#if !defined(__CMSIS_HOST_H__)
+    /* Counters 1 and 3 count the overflows of 0 and 2, the event counters are only 16 bits wide. */
+    ARM_PMU_Set_EVTYPER(0, ARM_PMU_L1D_CACHE_MISS_RD);
+    ARM_PMU_Set_EVTYPER(1, ARM_PMU_CHAIN);
+    ARM_PMU_Set_EVTYPER(2, ARM_PMU_STALL);
+    ARM_PMU_Set_EVTYPER(3, ARM_PMU_CHAIN);
+    ARM_PMU_EVCNTR_ALL_Reset();
+    ARM_PMU_CNTR_Enable(PMU_CNTENSET_CNT0_ENABLE_Msk | PMU_CNTENSET_CNT1_ENABLE_Msk |
+                        PMU_CNTENSET_CNT2_ENABLE_Msk | PMU_CNTENSET_CNT3_ENABLE_Msk);
+    ARM_PMU_Enable();
+#endif
+}
+
+// Function to clear the statistics of every probe
+void disp_probe_reset(void)
+{
+    uint32_t u32PriMask = __get_PRIMASK();
+
+    __disable_irq();
+    memset(g_asDispProbe, 0, sizeof(g_asDispProbe));
+    __set_PRIMASK(u32PriMask);
+}
+
+// Function to get a copy of a probe, negative if evProbe is out of range
+int disp_probe_get(E_DISP_PROBE evProbe, S_DISP_PROBE *psProbe)
+{
+    uint32_t u32PriMask;
+
+    if ((evProbe < 0) || (evProbe >= evDispProbeCNT) || !psProbe)
+        return -1;
+
+    /* An interrupt must not update the probe halfway through the copy. */
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+    *psProbe = g_asDispProbe[evProbe];
+    __set_PRIMASK(u32PriMask);
+
+    return 0;
+}
+
+// Function to convert counter ticks to nanoseconds
+static uint32_t probe_ticks_to_ns(uint32_t u32Ticks)
+{
+    return (uint32_t)(((uint64_t)u32Ticks * 1000000000ULL) / nu_cyccnt_freq());
+}
+
+// Function to print the statistics of every probe that ran on the debug UART
+void disp_probe_dump(void)
+{
+    int i;
+
+    printf("%-10s %8s %9s %9s %9s %9s %7s %7s %7s %8s %8s %8s\n",
+           "Probe", "Count", "Min(cyc)", "Avg(cyc)", "Max(cyc)", "Max(us)",
+           "MissMin", "MissAvg", "MissMax", "StallMin", "StallAvg", "StallMax");
+
+    for (i = 0; i < evDispProbeCNT; i++)
+    {
+        S_DISP_PROBE sProbe;
+        const S_DISP_PROBE_STAT *psCyc = &sProbe.m_asStat[evDispProbeCycles];
+        const S_DISP_PROBE_STAT *psMiss = &sProbe.m_asStat[evDispProbeMiss];
+        const S_DISP_PROBE_STAT *psStall = &sProbe.m_asStat[evDispProbeStall];
+        uint32_t u32MaxNs;
+
+        disp_probe_get((E_DISP_PROBE)i, &sProbe);
+
+        if (!sProbe.m_u32Count)
+            continue;
+
+        u32MaxNs = probe_ticks_to_ns(psCyc->m_u32Max);
+
+        printf("%-10s %8u %9u %9u %9u %5u.%03u %7u %7u %7u %8u %8u %8u\n",
+               s_aszDispProbeName[i], sProbe.m_u32Count,
+               psCyc->m_u32Min, (uint32_t)(psCyc->m_u64Sum / sProbe.m_u32Count), psCyc->m_u32Max,
+               u32MaxNs / 1000, u32MaxNs % 1000,
+               psMiss->m_u32Min, (uint32_t)(psMiss->m_u64Sum / sProbe.m_u32Count), psMiss->m_u32Max,
+               psStall->m_u32Min, (uint32_t)(psStall->m_u64Sum / sProbe.m_u32Count), psStall->m_u32Max);
+    }
+}
+
+#endif /* defined(CONFIG_DISP_PROBE) */
@@ -0,0 +1,171 @@
+/**************************************************************************//**
+ * @file     disp_probe.h
+ * @brief    Hot-path probes. A disp_probe_begin()/disp_probe_end() pair adds
+ *           the cycles, L1 D-cache read misses and stall cycles in between to
+ *           the min/avg/max statistics of the probe, kept in DTCM. Cycles come
+ *           from nu_cyccnt.h, the events from two chained pairs of PMU event
+ *           counters. The Linux host build reads the events from a mock that
+ *           host code advances with disp_probe_host_add(). Enable
+ *           CONFIG_DISP_PROBE in disp.h, otherwise the probes are empty.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_PROBE_H__
+#define __DISP_PROBE_H__
+
+#include "disp.h"
+#include "nu_cyccnt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+typedef enum
+{
+    evDispProbeRingBuild,    /*!< Scanout ring build of the PDMA or GDMA backend */
+    evDispProbePdmaIsr,      /*!< PDMA scanout callback in PDMA_IRQHandler, blank callback included */
+    evDispProbeGdmaIsr,      /*!< GDMACH1_IRQHandler, blank callback included */
+    evDispProbeBlankCb,      /*!< Blank callback of the running backend */
+    evDispProbeTileReplay,   /*!< disp_tile.c render of one tile */
+    evDispProbeCNT           /*!< Number of probes */
+} E_DISP_PROBE;
+
+typedef enum
+{
+    evDispProbeCycles,       /*!< nu_cyccnt.h ticks */
+    evDispProbeMiss,         /*!< ARM_PMU_L1D_CACHE_MISS_RD on PMU counters 0 and 1 */
+    evDispProbeStall,        /*!< ARM_PMU_STALL on PMU counters 2 and 3 */
+    evDispProbeCounterCNT    /*!< Number of counters */
+} E_DISP_PROBE_COUNTER;
+
+// Statistics of one counter of a probe
+typedef struct
+{
+    uint32_t m_u32Min;
+    uint32_t m_u32Max;
+    uint64_t m_u64Sum;
+} S_DISP_PROBE_STAT;
+
+// One probe
+typedef struct
+{
+    uint32_t          m_u32Count;                               /*!< Completed begin/end pairs */
+    uint32_t          m_au32Begin[evDispProbeCounterCNT];       /*!< Counters at the last begin */
+    S_DISP_PROBE_STAT m_asStat[evDispProbeCounterCNT];
+} S_DISP_PROBE;
+
+#if defined(CONFIG_DISP_PROBE)
+
+extern S_DISP_PROBE g_asDispProbe[evDispProbeCNT];
+
+#if defined(__CMSIS_HOST_H__)
+    extern uint32_t g_au32DispProbeHostEvent[evDispProbeCounterCNT];
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to start the cycle counter and the PMU event counters
+void disp_probe_start(void);
+
+// Function to clear the statistics of every probe
+void disp_probe_reset(void);
+
+// Function to get a copy of a probe, negative if evProbe is out of range
+int disp_probe_get(E_DISP_PROBE evProbe, S_DISP_PROBE *psProbe);
+
+// Function to print the statistics of every probe that ran on the debug UART
+void disp_probe_dump(void);
+
+#if defined(__CMSIS_HOST_H__)
+// Function to advance the mock event counters of the host build
+__STATIC_INLINE void disp_probe_host_add(uint32_t u32Miss, uint32_t u32Stall)
+{
+    g_au32DispProbeHostEvent[evDispProbeMiss] += u32Miss;
+    g_au32DispProbeHostEvent[evDispProbeStall] += u32Stall;
+}
+#else
+// Function to read a pair of PMU event counters chained into 32 bits, the odd one counts overflows of the even one
+__STATIC_INLINE uint32_t disp_probe_pmu_get(uint32_t u32Even)
+{
+    uint32_t u32Hi, u32Lo;
+
+    do
+    {
+        u32Hi = ARM_PMU_Get_EVCNTR(u32Even + 1);
+        u32Lo = ARM_PMU_Get_EVCNTR(u32Even);
+    } while (u32Hi != ARM_PMU_Get_EVCNTR(u32Even + 1));
+
+    return (u32Hi << 16) | u32Lo;
+}
+#endif
+
+// Function to read every counter of a probe
+__STATIC_INLINE void disp_probe_read(uint32_t *pu32Counter)
+{
+#if defined(__CMSIS_HOST_H__)
+    pu32Counter[evDispProbeMiss] = g_au32DispProbeHostEvent[evDispProbeMiss];
+    pu32Counter[evDispProbeStall] = g_au32DispProbeHostEvent[evDispProbeStall];
+#else
+    pu32Counter[evDispProbeMiss] = disp_probe_pmu_get(0);
+    pu32Counter[evDispProbeStall] = disp_probe_pmu_get(2);
+#endif
+    pu32Counter[evDispProbeCycles] = nu_cyccnt_get();
+}
+
+// Function to mark the start of a probed path
+__STATIC_INLINE void disp_probe_begin(E_DISP_PROBE evProbe)
+{
+    disp_probe_read(g_asDispProbe[evProbe].m_au32Begin);
+}
+
+// Function to mark the end of a probed path and account it
+__STATIC_INLINE void disp_probe_end(E_DISP_PROBE evProbe)
+{
+    S_DISP_PROBE *psProbe = &g_asDispProbe[evProbe];
+    uint32_t au32End[evDispProbeCounterCNT];
+    int i;
+
+    disp_probe_read(au32End);
+
+    for (i = 0; i < evDispProbeCounterCNT; i++)
+    {
+        S_DISP_PROBE_STAT *psStat = &psProbe->m_asStat[i];
+        uint32_t u32Delta = au32End[i] - psProbe->m_au32Begin[i];
+
+        /* The first pair seeds min and max, the statistics need no initialization. */
+        if (!psProbe->m_u32Count || (u32Delta < psStat->m_u32Min))
+            psStat->m_u32Min = u32Delta;
+
+        if (!psProbe->m_u32Count || (u32Delta > psStat->m_u32Max))
+            psStat->m_u32Max = u32Delta;
+
+        psStat->m_u64Sum += u32Delta;
+    }
+
+    psProbe->m_u32Count++;
+}
+
+#else
+
+__STATIC_INLINE void disp_probe_begin(E_DISP_PROBE evProbe)
+{
+    (void)evProbe;
+}
+
+__STATIC_INLINE void disp_probe_end(E_DISP_PROBE evProbe)
+{
+    (void)evProbe;
+}
+
+#endif /* defined(CONFIG_DISP_PROBE) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_PROBE_H__ */
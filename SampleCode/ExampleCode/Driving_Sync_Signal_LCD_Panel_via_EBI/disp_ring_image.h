@@ -0,0 +1,1396 @@
+/* Generated by host/disp_ringgen.c for 480x272 DE-only, do not edit. */
+#ifndef __DISP_RING_IMAGE_H__
+#define __DISP_RING_IMAGE_H__
+
+#define DISP_RING_IMAGE_HACT          480   /*!< Panel the image was generated for */
+#define DISP_RING_IMAGE_VACT          272
+#define DISP_RING_IMAGE_HBP           30
+#define DISP_RING_IMAGE_HFP           5
+#define DISP_RING_IMAGE_HPW           41
+#define DISP_RING_IMAGE_VBP           2
+#define DISP_RING_IMAGE_VFP           27
+#define DISP_RING_IMAGE_VPW           10
+#define DISP_RING_IMAGE_DE_ONLY       1   /*!< CONFIG_LCD_PANEL_USE_DE_ONLY */
+#define DISP_RING_IMAGE_EBI_ADDR      0x60000006UL   /*!< CONFIG_DISP_EBI_ADDR */
+#define DISP_RING_IMAGE_DSC_NUM       545   /*!< Descriptors in the ring */
+#define DISP_RING_IMAGE_FETCH_SIZE    21800   /*!< Bytes the DMA fetches to walk the ring once */
+#define DISP_RING_IMAGE_RELOC_NUM     272   /*!< VRAM sources patched at start up */
+
+#define DISP_RING_SRCCFG_DUMMY        0x000F0807UL   /*!< SRCTRANSCFG of the blank word */
+#define DISP_RING_SRCCFG_VRAM         0x000F0807UL   /*!< SRCTRANSCFG of the VRAM */
+#define DISP_RING_DESCFG_EBI          0x000F0807UL   /*!< DESTRANSCFG of the EBI */
+
+/* Header word, then one word per register set in the header. */
+DISP_RING_IMAGE_SECTION static S_DSC_LCD s_sDscLCD =
+{
+    { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x54B454B4, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(1) } },   /*    0: blank lines */
+    {
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(2) } },   /*    1: line 0 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(3) } },   /*    2: line 0 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(4) } },   /*    3: line 1 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(5) } },   /*    4: line 1 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(6) } },   /*    5: line 2 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(7) } },   /*    6: line 2 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(8) } },   /*    7: line 3 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(9) } },   /*    8: line 3 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(10) } },   /*    9: line 4 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(11) } },   /*   10: line 4 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(12) } },   /*   11: line 5 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(13) } },   /*   12: line 5 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(14) } },   /*   13: line 6 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(15) } },   /*   14: line 6 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(16) } },   /*   15: line 7 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(17) } },   /*   16: line 7 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(18) } },   /*   17: line 8 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(19) } },   /*   18: line 8 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(20) } },   /*   19: line 9 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(21) } },   /*   20: line 9 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(22) } },   /*   21: line 10 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(23) } },   /*   22: line 10 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(24) } },   /*   23: line 11 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(25) } },   /*   24: line 11 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(26) } },   /*   25: line 12 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(27) } },   /*   26: line 12 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(28) } },   /*   27: line 13 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(29) } },   /*   28: line 13 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(30) } },   /*   29: line 14 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(31) } },   /*   30: line 14 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(32) } },   /*   31: line 15 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(33) } },   /*   32: line 15 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(34) } },   /*   33: line 16 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(35) } },   /*   34: line 16 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(36) } },   /*   35: line 17 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(37) } },   /*   36: line 17 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(38) } },   /*   37: line 18 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(39) } },   /*   38: line 18 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(40) } },   /*   39: line 19 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(41) } },   /*   40: line 19 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(42) } },   /*   41: line 20 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(43) } },   /*   42: line 20 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(44) } },   /*   43: line 21 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(45) } },   /*   44: line 21 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(46) } },   /*   45: line 22 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(47) } },   /*   46: line 22 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(48) } },   /*   47: line 23 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(49) } },   /*   48: line 23 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(50) } },   /*   49: line 24 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(51) } },   /*   50: line 24 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(52) } },   /*   51: line 25 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(53) } },   /*   52: line 25 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(54) } },   /*   53: line 26 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(55) } },   /*   54: line 26 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(56) } },   /*   55: line 27 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(57) } },   /*   56: line 27 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(58) } },   /*   57: line 28 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(59) } },   /*   58: line 28 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(60) } },   /*   59: line 29 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(61) } },   /*   60: line 29 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(62) } },   /*   61: line 30 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(63) } },   /*   62: line 30 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(64) } },   /*   63: line 31 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(65) } },   /*   64: line 31 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(66) } },   /*   65: line 32 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(67) } },   /*   66: line 32 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(68) } },   /*   67: line 33 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(69) } },   /*   68: line 33 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(70) } },   /*   69: line 34 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(71) } },   /*   70: line 34 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(72) } },   /*   71: line 35 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(73) } },   /*   72: line 35 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(74) } },   /*   73: line 36 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(75) } },   /*   74: line 36 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(76) } },   /*   75: line 37 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(77) } },   /*   76: line 37 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(78) } },   /*   77: line 38 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(79) } },   /*   78: line 38 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(80) } },   /*   79: line 39 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(81) } },   /*   80: line 39 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(82) } },   /*   81: line 40 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(83) } },   /*   82: line 40 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(84) } },   /*   83: line 41 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(85) } },   /*   84: line 41 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(86) } },   /*   85: line 42 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(87) } },   /*   86: line 42 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(88) } },   /*   87: line 43 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(89) } },   /*   88: line 43 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(90) } },   /*   89: line 44 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(91) } },   /*   90: line 44 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(92) } },   /*   91: line 45 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(93) } },   /*   92: line 45 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(94) } },   /*   93: line 46 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(95) } },   /*   94: line 46 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(96) } },   /*   95: line 47 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(97) } },   /*   96: line 47 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(98) } },   /*   97: line 48 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(99) } },   /*   98: line 48 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(100) } },   /*   99: line 49 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(101) } },   /*  100: line 49 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(102) } },   /*  101: line 50 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(103) } },   /*  102: line 50 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(104) } },   /*  103: line 51 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(105) } },   /*  104: line 51 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(106) } },   /*  105: line 52 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(107) } },   /*  106: line 52 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(108) } },   /*  107: line 53 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(109) } },   /*  108: line 53 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(110) } },   /*  109: line 54 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(111) } },   /*  110: line 54 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(112) } },   /*  111: line 55 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(113) } },   /*  112: line 55 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(114) } },   /*  113: line 56 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(115) } },   /*  114: line 56 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(116) } },   /*  115: line 57 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(117) } },   /*  116: line 57 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(118) } },   /*  117: line 58 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(119) } },   /*  118: line 58 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(120) } },   /*  119: line 59 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(121) } },   /*  120: line 59 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(122) } },   /*  121: line 60 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(123) } },   /*  122: line 60 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(124) } },   /*  123: line 61 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(125) } },   /*  124: line 61 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(126) } },   /*  125: line 62 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(127) } },   /*  126: line 62 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(128) } },   /*  127: line 63 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(129) } },   /*  128: line 63 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(130) } },   /*  129: line 64 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(131) } },   /*  130: line 64 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(132) } },   /*  131: line 65 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(133) } },   /*  132: line 65 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(134) } },   /*  133: line 66 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(135) } },   /*  134: line 66 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(136) } },   /*  135: line 67 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(137) } },   /*  136: line 67 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(138) } },   /*  137: line 68 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(139) } },   /*  138: line 68 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(140) } },   /*  139: line 69 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(141) } },   /*  140: line 69 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(142) } },   /*  141: line 70 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(143) } },   /*  142: line 70 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(144) } },   /*  143: line 71 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(145) } },   /*  144: line 71 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(146) } },   /*  145: line 72 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(147) } },   /*  146: line 72 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(148) } },   /*  147: line 73 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(149) } },   /*  148: line 73 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(150) } },   /*  149: line 74 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(151) } },   /*  150: line 74 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(152) } },   /*  151: line 75 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(153) } },   /*  152: line 75 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(154) } },   /*  153: line 76 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(155) } },   /*  154: line 76 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(156) } },   /*  155: line 77 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(157) } },   /*  156: line 77 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(158) } },   /*  157: line 78 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(159) } },   /*  158: line 78 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(160) } },   /*  159: line 79 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(161) } },   /*  160: line 79 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(162) } },   /*  161: line 80 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(163) } },   /*  162: line 80 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(164) } },   /*  163: line 81 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(165) } },   /*  164: line 81 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(166) } },   /*  165: line 82 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(167) } },   /*  166: line 82 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(168) } },   /*  167: line 83 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(169) } },   /*  168: line 83 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(170) } },   /*  169: line 84 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(171) } },   /*  170: line 84 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(172) } },   /*  171: line 85 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(173) } },   /*  172: line 85 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(174) } },   /*  173: line 86 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(175) } },   /*  174: line 86 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(176) } },   /*  175: line 87 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(177) } },   /*  176: line 87 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(178) } },   /*  177: line 88 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(179) } },   /*  178: line 88 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(180) } },   /*  179: line 89 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(181) } },   /*  180: line 89 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(182) } },   /*  181: line 90 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(183) } },   /*  182: line 90 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(184) } },   /*  183: line 91 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(185) } },   /*  184: line 91 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(186) } },   /*  185: line 92 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(187) } },   /*  186: line 92 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(188) } },   /*  187: line 93 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(189) } },   /*  188: line 93 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(190) } },   /*  189: line 94 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(191) } },   /*  190: line 94 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(192) } },   /*  191: line 95 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(193) } },   /*  192: line 95 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(194) } },   /*  193: line 96 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(195) } },   /*  194: line 96 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(196) } },   /*  195: line 97 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(197) } },   /*  196: line 97 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(198) } },   /*  197: line 98 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(199) } },   /*  198: line 98 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(200) } },   /*  199: line 99 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(201) } },   /*  200: line 99 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(202) } },   /*  201: line 100 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(203) } },   /*  202: line 100 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(204) } },   /*  203: line 101 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(205) } },   /*  204: line 101 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(206) } },   /*  205: line 102 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(207) } },   /*  206: line 102 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(208) } },   /*  207: line 103 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(209) } },   /*  208: line 103 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(210) } },   /*  209: line 104 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(211) } },   /*  210: line 104 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(212) } },   /*  211: line 105 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(213) } },   /*  212: line 105 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(214) } },   /*  213: line 106 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(215) } },   /*  214: line 106 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(216) } },   /*  215: line 107 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(217) } },   /*  216: line 107 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(218) } },   /*  217: line 108 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(219) } },   /*  218: line 108 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(220) } },   /*  219: line 109 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(221) } },   /*  220: line 109 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(222) } },   /*  221: line 110 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(223) } },   /*  222: line 110 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(224) } },   /*  223: line 111 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(225) } },   /*  224: line 111 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(226) } },   /*  225: line 112 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(227) } },   /*  226: line 112 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(228) } },   /*  227: line 113 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(229) } },   /*  228: line 113 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(230) } },   /*  229: line 114 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(231) } },   /*  230: line 114 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(232) } },   /*  231: line 115 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(233) } },   /*  232: line 115 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(234) } },   /*  233: line 116 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(235) } },   /*  234: line 116 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(236) } },   /*  235: line 117 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(237) } },   /*  236: line 117 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(238) } },   /*  237: line 118 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(239) } },   /*  238: line 118 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(240) } },   /*  239: line 119 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(241) } },   /*  240: line 119 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(242) } },   /*  241: line 120 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(243) } },   /*  242: line 120 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(244) } },   /*  243: line 121 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(245) } },   /*  244: line 121 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(246) } },   /*  245: line 122 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(247) } },   /*  246: line 122 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(248) } },   /*  247: line 123 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(249) } },   /*  248: line 123 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(250) } },   /*  249: line 124 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(251) } },   /*  250: line 124 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(252) } },   /*  251: line 125 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(253) } },   /*  252: line 125 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(254) } },   /*  253: line 126 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(255) } },   /*  254: line 126 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(256) } },   /*  255: line 127 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(257) } },   /*  256: line 127 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(258) } },   /*  257: line 128 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(259) } },   /*  258: line 128 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(260) } },   /*  259: line 129 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(261) } },   /*  260: line 129 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(262) } },   /*  261: line 130 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(263) } },   /*  262: line 130 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(264) } },   /*  263: line 131 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(265) } },   /*  264: line 131 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(266) } },   /*  265: line 132 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(267) } },   /*  266: line 132 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(268) } },   /*  267: line 133 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(269) } },   /*  268: line 133 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(270) } },   /*  269: line 134 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(271) } },   /*  270: line 134 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(272) } },   /*  271: line 135 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(273) } },   /*  272: line 135 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(274) } },   /*  273: line 136 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(275) } },   /*  274: line 136 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(276) } },   /*  275: line 137 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(277) } },   /*  276: line 137 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(278) } },   /*  277: line 138 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(279) } },   /*  278: line 138 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(280) } },   /*  279: line 139 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(281) } },   /*  280: line 139 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(282) } },   /*  281: line 140 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(283) } },   /*  282: line 140 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(284) } },   /*  283: line 141 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(285) } },   /*  284: line 141 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(286) } },   /*  285: line 142 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(287) } },   /*  286: line 142 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(288) } },   /*  287: line 143 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(289) } },   /*  288: line 143 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(290) } },   /*  289: line 144 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(291) } },   /*  290: line 144 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(292) } },   /*  291: line 145 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(293) } },   /*  292: line 145 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(294) } },   /*  293: line 146 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(295) } },   /*  294: line 146 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(296) } },   /*  295: line 147 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(297) } },   /*  296: line 147 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(298) } },   /*  297: line 148 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(299) } },   /*  298: line 148 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(300) } },   /*  299: line 149 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(301) } },   /*  300: line 149 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(302) } },   /*  301: line 150 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(303) } },   /*  302: line 150 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(304) } },   /*  303: line 151 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(305) } },   /*  304: line 151 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(306) } },   /*  305: line 152 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(307) } },   /*  306: line 152 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(308) } },   /*  307: line 153 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(309) } },   /*  308: line 153 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(310) } },   /*  309: line 154 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(311) } },   /*  310: line 154 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(312) } },   /*  311: line 155 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(313) } },   /*  312: line 155 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(314) } },   /*  313: line 156 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(315) } },   /*  314: line 156 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(316) } },   /*  315: line 157 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(317) } },   /*  316: line 157 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(318) } },   /*  317: line 158 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(319) } },   /*  318: line 158 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(320) } },   /*  319: line 159 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(321) } },   /*  320: line 159 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(322) } },   /*  321: line 160 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(323) } },   /*  322: line 160 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(324) } },   /*  323: line 161 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(325) } },   /*  324: line 161 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(326) } },   /*  325: line 162 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(327) } },   /*  326: line 162 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(328) } },   /*  327: line 163 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(329) } },   /*  328: line 163 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(330) } },   /*  329: line 164 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(331) } },   /*  330: line 164 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(332) } },   /*  331: line 165 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(333) } },   /*  332: line 165 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(334) } },   /*  333: line 166 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(335) } },   /*  334: line 166 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(336) } },   /*  335: line 167 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(337) } },   /*  336: line 167 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(338) } },   /*  337: line 168 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(339) } },   /*  338: line 168 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(340) } },   /*  339: line 169 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(341) } },   /*  340: line 169 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(342) } },   /*  341: line 170 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(343) } },   /*  342: line 170 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(344) } },   /*  343: line 171 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(345) } },   /*  344: line 171 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(346) } },   /*  345: line 172 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(347) } },   /*  346: line 172 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(348) } },   /*  347: line 173 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(349) } },   /*  348: line 173 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(350) } },   /*  349: line 174 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(351) } },   /*  350: line 174 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(352) } },   /*  351: line 175 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(353) } },   /*  352: line 175 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(354) } },   /*  353: line 176 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(355) } },   /*  354: line 176 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(356) } },   /*  355: line 177 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(357) } },   /*  356: line 177 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(358) } },   /*  357: line 178 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(359) } },   /*  358: line 178 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(360) } },   /*  359: line 179 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(361) } },   /*  360: line 179 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(362) } },   /*  361: line 180 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(363) } },   /*  362: line 180 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(364) } },   /*  363: line 181 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(365) } },   /*  364: line 181 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(366) } },   /*  365: line 182 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(367) } },   /*  366: line 182 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(368) } },   /*  367: line 183 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(369) } },   /*  368: line 183 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(370) } },   /*  369: line 184 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(371) } },   /*  370: line 184 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(372) } },   /*  371: line 185 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(373) } },   /*  372: line 185 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(374) } },   /*  373: line 186 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(375) } },   /*  374: line 186 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(376) } },   /*  375: line 187 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(377) } },   /*  376: line 187 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(378) } },   /*  377: line 188 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(379) } },   /*  378: line 188 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(380) } },   /*  379: line 189 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(381) } },   /*  380: line 189 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(382) } },   /*  381: line 190 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(383) } },   /*  382: line 190 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(384) } },   /*  383: line 191 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(385) } },   /*  384: line 191 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(386) } },   /*  385: line 192 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(387) } },   /*  386: line 192 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(388) } },   /*  387: line 193 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(389) } },   /*  388: line 193 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(390) } },   /*  389: line 194 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(391) } },   /*  390: line 194 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(392) } },   /*  391: line 195 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(393) } },   /*  392: line 195 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(394) } },   /*  393: line 196 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(395) } },   /*  394: line 196 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(396) } },   /*  395: line 197 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(397) } },   /*  396: line 197 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(398) } },   /*  397: line 198 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(399) } },   /*  398: line 198 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(400) } },   /*  399: line 199 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(401) } },   /*  400: line 199 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(402) } },   /*  401: line 200 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(403) } },   /*  402: line 200 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(404) } },   /*  403: line 201 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(405) } },   /*  404: line 201 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(406) } },   /*  405: line 202 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(407) } },   /*  406: line 202 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(408) } },   /*  407: line 203 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(409) } },   /*  408: line 203 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(410) } },   /*  409: line 204 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(411) } },   /*  410: line 204 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(412) } },   /*  411: line 205 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(413) } },   /*  412: line 205 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(414) } },   /*  413: line 206 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(415) } },   /*  414: line 206 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(416) } },   /*  415: line 207 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(417) } },   /*  416: line 207 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(418) } },   /*  417: line 208 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(419) } },   /*  418: line 208 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(420) } },   /*  419: line 209 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(421) } },   /*  420: line 209 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(422) } },   /*  421: line 210 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(423) } },   /*  422: line 210 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(424) } },   /*  423: line 211 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(425) } },   /*  424: line 211 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(426) } },   /*  425: line 212 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(427) } },   /*  426: line 212 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(428) } },   /*  427: line 213 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(429) } },   /*  428: line 213 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(430) } },   /*  429: line 214 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(431) } },   /*  430: line 214 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(432) } },   /*  431: line 215 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(433) } },   /*  432: line 215 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(434) } },   /*  433: line 216 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(435) } },   /*  434: line 216 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(436) } },   /*  435: line 217 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(437) } },   /*  436: line 217 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(438) } },   /*  437: line 218 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(439) } },   /*  438: line 218 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(440) } },   /*  439: line 219 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(441) } },   /*  440: line 219 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(442) } },   /*  441: line 220 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(443) } },   /*  442: line 220 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(444) } },   /*  443: line 221 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(445) } },   /*  444: line 221 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(446) } },   /*  445: line 222 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(447) } },   /*  446: line 222 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(448) } },   /*  447: line 223 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(449) } },   /*  448: line 223 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(450) } },   /*  449: line 224 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(451) } },   /*  450: line 224 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(452) } },   /*  451: line 225 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(453) } },   /*  452: line 225 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(454) } },   /*  453: line 226 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(455) } },   /*  454: line 226 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(456) } },   /*  455: line 227 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(457) } },   /*  456: line 227 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(458) } },   /*  457: line 228 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(459) } },   /*  458: line 228 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(460) } },   /*  459: line 229 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(461) } },   /*  460: line 229 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(462) } },   /*  461: line 230 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(463) } },   /*  462: line 230 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(464) } },   /*  463: line 231 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(465) } },   /*  464: line 231 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(466) } },   /*  465: line 232 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(467) } },   /*  466: line 232 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(468) } },   /*  467: line 233 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(469) } },   /*  468: line 233 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(470) } },   /*  469: line 234 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(471) } },   /*  470: line 234 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(472) } },   /*  471: line 235 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(473) } },   /*  472: line 235 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(474) } },   /*  473: line 236 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(475) } },   /*  474: line 236 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(476) } },   /*  475: line 237 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(477) } },   /*  476: line 237 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(478) } },   /*  477: line 238 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(479) } },   /*  478: line 238 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(480) } },   /*  479: line 239 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(481) } },   /*  480: line 239 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(482) } },   /*  481: line 240 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(483) } },   /*  482: line 240 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(484) } },   /*  483: line 241 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(485) } },   /*  484: line 241 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(486) } },   /*  485: line 242 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(487) } },   /*  486: line 242 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(488) } },   /*  487: line 243 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(489) } },   /*  488: line 243 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(490) } },   /*  489: line 244 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(491) } },   /*  490: line 244 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(492) } },   /*  491: line 245 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(493) } },   /*  492: line 245 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(494) } },   /*  493: line 246 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(495) } },   /*  494: line 246 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(496) } },   /*  495: line 247 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(497) } },   /*  496: line 247 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(498) } },   /*  497: line 248 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(499) } },   /*  498: line 248 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(500) } },   /*  499: line 249 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(501) } },   /*  500: line 249 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(502) } },   /*  501: line 250 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(503) } },   /*  502: line 250 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(504) } },   /*  503: line 251 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(505) } },   /*  504: line 251 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(506) } },   /*  505: line 252 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(507) } },   /*  506: line 252 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(508) } },   /*  507: line 253 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(509) } },   /*  508: line 253 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(510) } },   /*  509: line 254 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(511) } },   /*  510: line 254 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(512) } },   /*  511: line 255 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(513) } },   /*  512: line 255 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(514) } },   /*  513: line 256 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(515) } },   /*  514: line 256 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(516) } },   /*  515: line 257 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(517) } },   /*  516: line 257 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(518) } },   /*  517: line 258 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(519) } },   /*  518: line 258 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(520) } },   /*  519: line 259 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(521) } },   /*  520: line 259 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(522) } },   /*  521: line 260 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(523) } },   /*  522: line 260 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(524) } },   /*  523: line 261 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(525) } },   /*  524: line 261 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(526) } },   /*  525: line 262 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(527) } },   /*  526: line 262 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(528) } },   /*  527: line 263 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(529) } },   /*  528: line 263 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(530) } },   /*  529: line 264 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(531) } },   /*  530: line 264 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(532) } },   /*  531: line 265 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(533) } },   /*  532: line 265 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(534) } },   /*  533: line 266 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(535) } },   /*  534: line 266 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(536) } },   /*  535: line 267 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(537) } },   /*  536: line 267 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(538) } },   /*  537: line 268 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(539) } },   /*  538: line 268 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(540) } },   /*  539: line 269 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(541) } },   /*  540: line 269 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(542) } },   /*  541: line 270 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000000, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(543) } },   /*  542: line 270 HACT */
+        } },
+        { {
+            { { 0x40001D5D, 0x00000000, 0x00200201, DISP_RING_DUMMY, 0x60000006, 0x004C004C, DISP_RING_SRCCFG_DUMMY, DISP_RING_DESCFG_EBI, 0x00000000, DISP_RING_LINK(544) } },   /*  543: line 271 HFP+HSYNC+HBP */
+            { { 0x40001D5D, 0x00000001, 0x00200201, 0, 0x60000106, 0x01E001E0, DISP_RING_SRCCFG_VRAM, DISP_RING_DESCFG_EBI, 0x00000001, DISP_RING_LINK(0) } },   /*  544: line 271 HACT */
+        } },
+    }
+};
+
+/* Ring word and VRAM buffer byte offset of each active line source. */
+static const S_RINGRELOC s_asRingReloc[DISP_RING_IMAGE_RELOC_NUM] =
+{
+    {    35, 0x000000 },
+    {    67, 0x0003C0 },
+    {    99, 0x000780 },
+    {   131, 0x000B40 },
+    {   163, 0x000F00 },
+    {   195, 0x0012C0 },
+    {   227, 0x001680 },
+    {   259, 0x001A40 },
+    {   291, 0x001E00 },
+    {   323, 0x0021C0 },
+    {   355, 0x002580 },
+    {   387, 0x002940 },
+    {   419, 0x002D00 },
+    {   451, 0x0030C0 },
+    {   483, 0x003480 },
+    {   515, 0x003840 },
+    {   547, 0x003C00 },
+    {   579, 0x003FC0 },
+    {   611, 0x004380 },
+    {   643, 0x004740 },
+    {   675, 0x004B00 },
+    {   707, 0x004EC0 },
+    {   739, 0x005280 },
+    {   771, 0x005640 },
+    {   803, 0x005A00 },
+    {   835, 0x005DC0 },
+    {   867, 0x006180 },
+    {   899, 0x006540 },
+    {   931, 0x006900 },
+    {   963, 0x006CC0 },
+    {   995, 0x007080 },
+    {  1027, 0x007440 },
+    {  1059, 0x007800 },
+    {  1091, 0x007BC0 },
+    {  1123, 0x007F80 },
+    {  1155, 0x008340 },
+    {  1187, 0x008700 },
+    {  1219, 0x008AC0 },
+    {  1251, 0x008E80 },
+    {  1283, 0x009240 },
+    {  1315, 0x009600 },
+    {  1347, 0x0099C0 },
+    {  1379, 0x009D80 },
+    {  1411, 0x00A140 },
+    {  1443, 0x00A500 },
+    {  1475, 0x00A8C0 },
+    {  1507, 0x00AC80 },
+    {  1539, 0x00B040 },
+    {  1571, 0x00B400 },
+    {  1603, 0x00B7C0 },
+    {  1635, 0x00BB80 },
+    {  1667, 0x00BF40 },
+    {  1699, 0x00C300 },
+    {  1731, 0x00C6C0 },
+    {  1763, 0x00CA80 },
+    {  1795, 0x00CE40 },
+    {  1827, 0x00D200 },
+    {  1859, 0x00D5C0 },
+    {  1891, 0x00D980 },
+    {  1923, 0x00DD40 },
+    {  1955, 0x00E100 },
+    {  1987, 0x00E4C0 },
+    {  2019, 0x00E880 },
+    {  2051, 0x00EC40 },
+    {  2083, 0x00F000 },
+    {  2115, 0x00F3C0 },
+    {  2147, 0x00F780 },
+    {  2179, 0x00FB40 },
+    {  2211, 0x00FF00 },
+    {  2243, 0x0102C0 },
+    {  2275, 0x010680 },
+    {  2307, 0x010A40 },
+    {  2339, 0x010E00 },
+    {  2371, 0x0111C0 },
+    {  2403, 0x011580 },
+    {  2435, 0x011940 },
+    {  2467, 0x011D00 },
+    {  2499, 0x0120C0 },
+    {  2531, 0x012480 },
+    {  2563, 0x012840 },
+    {  2595, 0x012C00 },
+    {  2627, 0x012FC0 },
+    {  2659, 0x013380 },
+    {  2691, 0x013740 },
+    {  2723, 0x013B00 },
+    {  2755, 0x013EC0 },
+    {  2787, 0x014280 },
+    {  2819, 0x014640 },
+    {  2851, 0x014A00 },
+    {  2883, 0x014DC0 },
+    {  2915, 0x015180 },
+    {  2947, 0x015540 },
+    {  2979, 0x015900 },
+    {  3011, 0x015CC0 },
+    {  3043, 0x016080 },
+    {  3075, 0x016440 },
+    {  3107, 0x016800 },
+    {  3139, 0x016BC0 },
+    {  3171, 0x016F80 },
+    {  3203, 0x017340 },
+    {  3235, 0x017700 },
+    {  3267, 0x017AC0 },
+    {  3299, 0x017E80 },
+    {  3331, 0x018240 },
+    {  3363, 0x018600 },
+    {  3395, 0x0189C0 },
+    {  3427, 0x018D80 },
+    {  3459, 0x019140 },
+    {  3491, 0x019500 },
+    {  3523, 0x0198C0 },
+    {  3555, 0x019C80 },
+    {  3587, 0x01A040 },
+    {  3619, 0x01A400 },
+    {  3651, 0x01A7C0 },
+    {  3683, 0x01AB80 },
+    {  3715, 0x01AF40 },
+    {  3747, 0x01B300 },
+    {  3779, 0x01B6C0 },
+    {  3811, 0x01BA80 },
+    {  3843, 0x01BE40 },
+    {  3875, 0x01C200 },
+    {  3907, 0x01C5C0 },
+    {  3939, 0x01C980 },
+    {  3971, 0x01CD40 },
+    {  4003, 0x01D100 },
+    {  4035, 0x01D4C0 },
+    {  4067, 0x01D880 },
+    {  4099, 0x01DC40 },
+    {  4131, 0x01E000 },
+    {  4163, 0x01E3C0 },
+    {  4195, 0x01E780 },
+    {  4227, 0x01EB40 },
+    {  4259, 0x01EF00 },
+    {  4291, 0x01F2C0 },
+    {  4323, 0x01F680 },
+    {  4355, 0x01FA40 },
+    {  4387, 0x01FE00 },
+    {  4419, 0x0201C0 },
+    {  4451, 0x020580 },
+    {  4483, 0x020940 },
+    {  4515, 0x020D00 },
+    {  4547, 0x0210C0 },
+    {  4579, 0x021480 },
+    {  4611, 0x021840 },
+    {  4643, 0x021C00 },
+    {  4675, 0x021FC0 },
+    {  4707, 0x022380 },
+    {  4739, 0x022740 },
+    {  4771, 0x022B00 },
+    {  4803, 0x022EC0 },
+    {  4835, 0x023280 },
+    {  4867, 0x023640 },
+    {  4899, 0x023A00 },
+    {  4931, 0x023DC0 },
+    {  4963, 0x024180 },
+    {  4995, 0x024540 },
+    {  5027, 0x024900 },
+    {  5059, 0x024CC0 },
+    {  5091, 0x025080 },
+    {  5123, 0x025440 },
+    {  5155, 0x025800 },
+    {  5187, 0x025BC0 },
+    {  5219, 0x025F80 },
+    {  5251, 0x026340 },
+    {  5283, 0x026700 },
+    {  5315, 0x026AC0 },
+    {  5347, 0x026E80 },
+    {  5379, 0x027240 },
+    {  5411, 0x027600 },
+    {  5443, 0x0279C0 },
+    {  5475, 0x027D80 },
+    {  5507, 0x028140 },
+    {  5539, 0x028500 },
+    {  5571, 0x0288C0 },
+    {  5603, 0x028C80 },
+    {  5635, 0x029040 },
+    {  5667, 0x029400 },
+    {  5699, 0x0297C0 },
+    {  5731, 0x029B80 },
+    {  5763, 0x029F40 },
+    {  5795, 0x02A300 },
+    {  5827, 0x02A6C0 },
+    {  5859, 0x02AA80 },
+    {  5891, 0x02AE40 },
+    {  5923, 0x02B200 },
+    {  5955, 0x02B5C0 },
+    {  5987, 0x02B980 },
+    {  6019, 0x02BD40 },
+    {  6051, 0x02C100 },
+    {  6083, 0x02C4C0 },
+    {  6115, 0x02C880 },
+    {  6147, 0x02CC40 },
+    {  6179, 0x02D000 },
+    {  6211, 0x02D3C0 },
+    {  6243, 0x02D780 },
+    {  6275, 0x02DB40 },
+    {  6307, 0x02DF00 },
+    {  6339, 0x02E2C0 },
+    {  6371, 0x02E680 },
+    {  6403, 0x02EA40 },
+    {  6435, 0x02EE00 },
+    {  6467, 0x02F1C0 },
+    {  6499, 0x02F580 },
+    {  6531, 0x02F940 },
+    {  6563, 0x02FD00 },
+    {  6595, 0x0300C0 },
+    {  6627, 0x030480 },
+    {  6659, 0x030840 },
+    {  6691, 0x030C00 },
+    {  6723, 0x030FC0 },
+    {  6755, 0x031380 },
+    {  6787, 0x031740 },
+    {  6819, 0x031B00 },
+    {  6851, 0x031EC0 },
+    {  6883, 0x032280 },
+    {  6915, 0x032640 },
+    {  6947, 0x032A00 },
+    {  6979, 0x032DC0 },
+    {  7011, 0x033180 },
+    {  7043, 0x033540 },
+    {  7075, 0x033900 },
+    {  7107, 0x033CC0 },
+    {  7139, 0x034080 },
+    {  7171, 0x034440 },
+    {  7203, 0x034800 },
+    {  7235, 0x034BC0 },
+    {  7267, 0x034F80 },
+    {  7299, 0x035340 },
+    {  7331, 0x035700 },
+    {  7363, 0x035AC0 },
+    {  7395, 0x035E80 },
+    {  7427, 0x036240 },
+    {  7459, 0x036600 },
+    {  7491, 0x0369C0 },
+    {  7523, 0x036D80 },
+    {  7555, 0x037140 },
+    {  7587, 0x037500 },
+    {  7619, 0x0378C0 },
+    {  7651, 0x037C80 },
+    {  7683, 0x038040 },
+    {  7715, 0x038400 },
+    {  7747, 0x0387C0 },
+    {  7779, 0x038B80 },
+    {  7811, 0x038F40 },
+    {  7843, 0x039300 },
+    {  7875, 0x0396C0 },
+    {  7907, 0x039A80 },
+    {  7939, 0x039E40 },
+    {  7971, 0x03A200 },
+    {  8003, 0x03A5C0 },
+    {  8035, 0x03A980 },
+    {  8067, 0x03AD40 },
+    {  8099, 0x03B100 },
+    {  8131, 0x03B4C0 },
+    {  8163, 0x03B880 },
+    {  8195, 0x03BC40 },
+    {  8227, 0x03C000 },
+    {  8259, 0x03C3C0 },
+    {  8291, 0x03C780 },
+    {  8323, 0x03CB40 },
+    {  8355, 0x03CF00 },
+    {  8387, 0x03D2C0 },
+    {  8419, 0x03D680 },
+    {  8451, 0x03DA40 },
+    {  8483, 0x03DE00 },
+    {  8515, 0x03E1C0 },
+    {  8547, 0x03E580 },
+    {  8579, 0x03E940 },
+    {  8611, 0x03ED00 },
+    {  8643, 0x03F0C0 },
+    {  8675, 0x03F480 },
+    {  8707, 0x03F840 },
+};
+
+#endif /* __DISP_RING_IMAGE_H__ */
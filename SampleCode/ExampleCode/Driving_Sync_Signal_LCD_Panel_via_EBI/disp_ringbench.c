@@ -0,0 +1,256 @@
+/**************************************************************************//**
+ * @file     disp_ringbench.c
+ * @brief    Report the scanout ring footprint and timing over the UART console.
+ *           Enable CONFIG_DISP_RINGBENCH in disp.h. The running panel is
+ *           measured, the other panels of the matrix are predicted from the
+ *           measured EBI write rate. host/disp_ringbench.c reuses the report.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_RINGBENCH)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_RINGBENCH_NONCACHEABLE_SIZE    0x00030000UL              /*!< SRAM_NONCACHEABLE_SIZE in M55M1.scatter */
+#define DEF_RINGBENCH_CACHEABLE_SIZE       (0x00120000UL - 0x800UL)  /*!< __RW_SIZE in M55M1.scatter */
+#define DEF_RINGBENCH_PDMA_DSC_SIZE        16                        /*!< sizeof(DSCT_T) */
+#define DEF_RINGBENCH_GDMA_DSC_SIZE        64                        /*!< sizeof(S_CMDBUF) */
+#define DEF_RINGBENCH_MEASURE_FRAMES       60                        /*!< Blank interrupts to measure the frame rate */
+
+#if !defined(CONFIG_DISP_RINGBENCH_PCLK_HZ)
+    #define CONFIG_DISP_RINGBENCH_PCLK_HZ  10000000                  /*!< EBI write rate for predictions when not measured */
+#endif
+
+// Timing of one panel in the benchmark matrix
+typedef struct
+{
+    const char *m_szName;
+    uint16_t    m_u16HACT;
+    uint16_t    m_u16VACT;
+    uint16_t    m_u16HBP;
+    uint16_t    m_u16HFP;
+    uint16_t    m_u16HPW;
+    uint16_t    m_u16VBP;
+    uint16_t    m_u16VFP;
+    uint16_t    m_u16VPW;
+} S_RINGBENCH_PANEL;
+
+// One report row
+typedef struct
+{
+    const char *m_szBackend;
+    const char *m_szMode;
+    uint32_t    m_u32HACT;
+    uint32_t    m_u32VACT;
+    uint32_t    m_u32FrameClocks;   /*!< EBI writes of one frame */
+    uint32_t    m_u32DscNum;
+    uint32_t    m_u32RingSize;
+    uint32_t    m_u32FetchSize;
+    uint32_t    m_u32BuildNs;       /*!< 0: not measured */
+    uint32_t    m_u32FlipNs;        /*!< 0: not measured */
+} S_RINGBENCH_ROW;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+/* Keep in step with the panel list in host/disp_ringbench.sh. */
+static const S_RINGBENCH_PANEL s_asRingBenchPanels[] =
+{
+    { "480x272",   480, 272,  30,   5, 41,  2, 27, 10 },
+    { "800x480",   800, 480,  26, 210, 20, 13, 22, 10 },
+    { "1024x600", 1024, 600, 140, 160, 20, 20, 12,  3 },
+};
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to convert counter ticks to nanoseconds
+static uint32_t ringbench_ticks_to_ns(uint32_t u32Ticks)
+{
+    return (uint32_t)(((uint64_t)u32Ticks * 1000000000ULL) / nu_cyccnt_freq());
+}
+
+// Function to format nanoseconds as microseconds, '-' if not measured
+static void ringbench_format_us(char *szBuf, int i32Size, uint32_t u32Ns)
+{
+    if (u32Ns)
+        snprintf(szBuf, i32Size, "%u.%02u", u32Ns / 1000, (u32Ns % 1000) / 10);
+    else
+        snprintf(szBuf, i32Size, "-");
+}
+
+// Function to print the report header
+static void ringbench_print_header(void)
+{
+    printf("%-7s %-6s %-9s %6s %8s %8s %9s %8s %7s %8s %10s %9s %s\n",
+           "Backend", "Mode", "Panel", "DSC", "Ring(B)", "Fetch(B)", "Build(us)", "Flip(us)",
+           "FPS", "VRAM(KB)", "Fetch(KB/s)", "RingInNC", "VRAMInRAM");
+}
+
+// Function to print one report row, the frame rate is predicted from the EBI write rate
+static void ringbench_print_row(const S_RINGBENCH_ROW *psRow, uint32_t u32PclkHz)
+{
+    char szPanel[16];
+    char szBuild[16];
+    char szFlip[16];
+    uint32_t u32Fps10 = (uint32_t)(((uint64_t)u32PclkHz * 10ULL) / psRow->m_u32FrameClocks);
+    uint32_t u32VRAMSize = psRow->m_u32HACT * psRow->m_u32VACT * sizeof(uint16_t) * CONFIG_VRAM_BUF_NUM;
+    uint32_t u32FetchRate = (uint32_t)(((uint64_t)psRow->m_u32FetchSize * u32Fps10) / 10240ULL);
+
+    snprintf(szPanel, sizeof(szPanel), "%ux%u", psRow->m_u32HACT, psRow->m_u32VACT);
+
+    ringbench_format_us(szBuild, sizeof(szBuild), psRow->m_u32BuildNs);
+    ringbench_format_us(szFlip, sizeof(szFlip), psRow->m_u32FlipNs);
+
+    printf("%-7s %-6s %-9s %6u %8u %8u %9s %8s %5u.%u %8u %10u %9s %s\n",
+           psRow->m_szBackend, psRow->m_szMode, szPanel,
+           psRow->m_u32DscNum, psRow->m_u32RingSize, psRow->m_u32FetchSize,
+           szBuild, szFlip,
+           u32Fps10 / 10, u32Fps10 % 10,
+           u32VRAMSize / 1024, u32FetchRate,
+           (psRow->m_u32RingSize <= DEF_RINGBENCH_NONCACHEABLE_SIZE) ? "yes" : "NO",
+           (u32VRAMSize <= DEF_RINGBENCH_CACHEABLE_SIZE) ? "yes" : "NO");
+}
+
+// Function to fill a predicted row of a matrix panel, the fetch size assumes full descriptors
+static void ringbench_predict_row(S_RINGBENCH_ROW *psRow, const S_RINGBENCH_PANEL *psPanel, int bGDMA, int bDEOnly)
+{
+    uint32_t u32HTotal = psPanel->m_u16HFP + psPanel->m_u16HPW + psPanel->m_u16HBP + psPanel->m_u16HACT;
+    uint32_t u32VTotal = psPanel->m_u16VFP + psPanel->m_u16VPW + psPanel->m_u16VBP + psPanel->m_u16VACT;
+    uint32_t u32DscSize = bGDMA ? DEF_RINGBENCH_GDMA_DSC_SIZE : DEF_RINGBENCH_PDMA_DSC_SIZE;
+
+    psRow->m_szBackend = bGDMA ? "GDMA" : "PDMA";
+    psRow->m_szMode = bDEOnly ? "DE" : "SYNC";
+    psRow->m_u32HACT = psPanel->m_u16HACT;
+    psRow->m_u32VACT = psPanel->m_u16VACT;
+    psRow->m_u32FrameClocks = u32HTotal * u32VTotal;
+
+    /* DE-only: one blanking descriptor plus porch/active pair per line, full sync: four H stages per line. */
+    psRow->m_u32DscNum = bDEOnly ? (1 + 2 * psPanel->m_u16VACT) : (4 * u32VTotal);
+    psRow->m_u32RingSize = psRow->m_u32DscNum * u32DscSize;
+    psRow->m_u32FetchSize = psRow->m_u32RingSize;
+    psRow->m_u32BuildNs = 0;
+    psRow->m_u32FlipNs = 0;
+}
+
+// Function to fill the row of the running panel from the ring statistics
+static void ringbench_current_row(S_RINGBENCH_ROW *psRow, const S_DISP_RINGINFO *psInfo)
+{
+    psRow->m_szBackend = psInfo->m_szBackend;
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    psRow->m_szMode = "DE";
+#else
+    psRow->m_szMode = "SYNC";
+#endif
+    psRow->m_u32HACT = CONFIG_TIMING_HACT;
+    psRow->m_u32VACT = CONFIG_TIMING_VACT;
+    /* Every panel of the target writes its frame through the one EBI. */
+    psRow->m_u32FrameClocks = DEF_PANEL_NUM * DEF_HACT_ALL * DEF_VACT_ALL;
+    psRow->m_u32DscNum = psInfo->m_u32DscNum;
+    psRow->m_u32RingSize = psInfo->m_u32RingSize;
+    psRow->m_u32FetchSize = psInfo->m_u32FetchSize;
+    psRow->m_u32BuildNs = ringbench_ticks_to_ns(psInfo->m_u32BuildCycles);
+    psRow->m_u32FlipNs = ringbench_ticks_to_ns(psInfo->m_u32FlipMaxCycles);
+}
+
+#if !defined(DISP_RINGBENCH_HOST)
+
+// Function to measure the EBI write rate from the blank interrupts of the running ring
+static uint32_t ringbench_measure_pclk(void)
+{
+    S_DISP_RINGINFO sInfo;
+    uint32_t u32Start, u32Elapsed, u32Count;
+    uint32_t u32Timeout = nu_cyccnt_freq() * 2;
+
+    disp_get_ringinfo(&sInfo);
+    u32Count = sInfo.m_u32BlankCount;
+
+    /* Align to a blank interrupt. */
+    u32Start = nu_cyccnt_get();
+
+    do
+    {
+        disp_get_ringinfo(&sInfo);
+
+        if ((nu_cyccnt_get() - u32Start) > u32Timeout)
+            return 0;
+    } while (sInfo.m_u32BlankCount == u32Count);
+
+    u32Count = sInfo.m_u32BlankCount;
+    u32Start = nu_cyccnt_get();
+
+    do
+    {
+        disp_get_ringinfo(&sInfo);
+        u32Elapsed = nu_cyccnt_get() - u32Start;
+
+        if (u32Elapsed > (u32Timeout * 2))
+            return 0;
+    } while ((sInfo.m_u32BlankCount - u32Count) < DEF_RINGBENCH_MEASURE_FRAMES);
+
+    return (uint32_t)(((uint64_t)DEF_PANEL_NUM * DEF_HACT_ALL * DEF_VACT_ALL * DEF_RINGBENCH_MEASURE_FRAMES * nu_cyccnt_freq()) / u32Elapsed);
+}
+
+// Function to report the ring benchmark
+static int disp_ringbench_init(void)
+{
+    int i;
+    S_DISP_RINGINFO sInfo;
+    S_RINGBENCH_ROW sRow;
+    uint32_t u32PclkHz;
+
+    disp_get_ringinfo(&sInfo);
+
+    if (!sInfo.m_u32BuildCycles)
+    {
+        printf("Ring benchmark: display is not initialized.\n");
+        return -1;
+    }
+
+    u32PclkHz = ringbench_measure_pclk();
+
+    if (!u32PclkHz)
+    {
+        printf("Ring benchmark: no blank interrupt, predict with %u Hz.\n", CONFIG_DISP_RINGBENCH_PCLK_HZ);
+        u32PclkHz = CONFIG_DISP_RINGBENCH_PCLK_HZ;
+    }
+    else
+    {
+        printf("Ring benchmark: measured EBI write rate %u Hz.\n", u32PclkHz);
+    }
+
+    /* Running panel, measured. */
+    disp_get_ringinfo(&sInfo);
+    ringbench_print_header();
+    ringbench_current_row(&sRow, &sInfo);
+    ringbench_print_row(&sRow, u32PclkHz);
+
+    /* Panel matrix, predicted. */
+    for (i = 0; i < (sizeof(s_asRingBenchPanels) / sizeof(s_asRingBenchPanels[0])); i++)
+    {
+        int bGDMA, bDEOnly;
+
+        for (bGDMA = 0; bGDMA < 2; bGDMA++)
+        {
+            for (bDEOnly = 1; bDEOnly >= 0; bDEOnly--)
+            {
+                ringbench_predict_row(&sRow, &s_asRingBenchPanels[i], bGDMA, bDEOnly);
+                ringbench_print_row(&sRow, u32PclkHz);
+            }
+        }
+    }
+
+    return 0;
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_RINGBENCH", disp_ringbench_init, NULL);
+
+#endif /* !defined(DISP_RINGBENCH_HOST) */
+
+#endif /* defined(CONFIG_DISP_RINGBENCH) */
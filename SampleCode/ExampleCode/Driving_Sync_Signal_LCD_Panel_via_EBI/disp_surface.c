@@ -0,0 +1,288 @@
+/**************************************************************************//**
+ * @file     disp_surface.c
+ * @brief    Drawing surface with dirty-rectangle tracked D-cache maintenance.
+ *           Rectangles that touch or overlap without growing the covered
+ *           area are merged, the table never holds more than
+ *           CONFIG_DISP_SURFACE_RECTS. At flush each rectangle row becomes a
+ *           cache-line range, ranges closer than CONFIG_DISP_SURFACE_GAP_LINES
+ *           are joined, so a full-width rectangle is one range.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp.h"
+#include "disp_surface.h"
+#include "disp_mpu.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_SURFACE_LINE_MASK    ((uint32_t)DCACHE_LINE_SIZE - 1)
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to get the area of a rectangle
+static uint32_t surface_rect_area(const S_DISP_RECT *psRect)
+{
+    return (uint32_t)psRect->m_u16W * psRect->m_u16H;
+}
+
+// Function to get the bounding rectangle of two rectangles
+static void surface_rect_union(S_DISP_RECT *psOut, const S_DISP_RECT *psA, const S_DISP_RECT *psB)
+{
+    uint32_t u32X0 = (psA->m_u16X < psB->m_u16X) ? psA->m_u16X : psB->m_u16X;
+    uint32_t u32Y0 = (psA->m_u16Y < psB->m_u16Y) ? psA->m_u16Y : psB->m_u16Y;
+    uint32_t u32X1 = ((psA->m_u16X + psA->m_u16W) > (psB->m_u16X + psB->m_u16W)) ? (psA->m_u16X + psA->m_u16W) : (psB->m_u16X + psB->m_u16W);
+    uint32_t u32Y1 = ((psA->m_u16Y + psA->m_u16H) > (psB->m_u16Y + psB->m_u16H)) ? (psA->m_u16Y + psA->m_u16H) : (psB->m_u16Y + psB->m_u16H);
+
+    psOut->m_u16X = (uint16_t)u32X0;
+    psOut->m_u16Y = (uint16_t)u32Y0;
+    psOut->m_u16W = (uint16_t)(u32X1 - u32X0);
+    psOut->m_u16H = (uint16_t)(u32Y1 - u32Y0);
+}
+
+// Function to remove a rectangle from the dirty table
+static void surface_rect_remove(S_DISP_SURFACE *psSurf, uint32_t u32Idx)
+{
+    psSurf->m_u32RectNum--;
+    psSurf->m_asRect[u32Idx] = psSurf->m_asRect[psSurf->m_u32RectNum];
+}
+
+// Function to clip a rectangle to the surface, returns 0 if nothing is left
+static int surface_clip(const S_DISP_SURFACE *psSurf, S_DISP_RECT *psOut, int i32X, int i32Y, int i32W, int i32H)
+{
+    if (i32X < 0)
+    {
+        i32W += i32X;
+        i32X = 0;
+    }
+
+    if (i32Y < 0)
+    {
+        i32H += i32Y;
+        i32Y = 0;
+    }
+
+    if ((i32X + i32W) > psSurf->m_u16Width)
+        i32W = psSurf->m_u16Width - i32X;
+
+    if ((i32Y + i32H) > psSurf->m_u16Height)
+        i32H = psSurf->m_u16Height - i32Y;
+
+    if ((i32W <= 0) || (i32H <= 0))
+        return 0;
+
+    psOut->m_u16X = (uint16_t)i32X;
+    psOut->m_u16Y = (uint16_t)i32Y;
+    psOut->m_u16W = (uint16_t)i32W;
+    psOut->m_u16H = (uint16_t)i32H;
+
+    return 1;
+}
+
+// Function to initialize a surface over a pixel buffer, nothing is dirty
+int disp_surface_init(S_DISP_SURFACE *psSurf, void *pvBuf, uint16_t u16Width, uint16_t u16Height)
+{
+    if (!psSurf || !pvBuf || !u16Width || !u16Height)
+        return -1;
+
+    memset(psSurf, 0, sizeof(S_DISP_SURFACE));
+
+    psSurf->m_pu16Buf = (uint16_t *)pvBuf;
+    psSurf->m_u16Width = u16Width;
+    psSurf->m_u16Height = u16Height;
+
+    return 0;
+}
+
+// Function to record a rectangle the CPU has drawn, clipped to the surface
+void disp_surface_mark_dirty(S_DISP_SURFACE *psSurf, int i32X, int i32Y, int i32W, int i32H)
+{
+    S_DISP_RECT sNew, sUnion;
+    uint32_t i;
+
+    if (!surface_clip(psSurf, &sNew, i32X, i32Y, i32W, i32H))
+        return;
+
+    /* Absorb every rectangle the new one can take in for free, rescan after each merge. */
+    i = 0;
+
+    while (i < psSurf->m_u32RectNum)
+    {
+        surface_rect_union(&sUnion, &sNew, &psSurf->m_asRect[i]);
+
+        if (surface_rect_area(&sUnion) <= (surface_rect_area(&sNew) + surface_rect_area(&psSurf->m_asRect[i])))
+        {
+            surface_rect_remove(psSurf, i);
+            sNew = sUnion;
+            i = 0;
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    /* Table full, merge into the rectangle that grows the least. */
+    if (psSurf->m_u32RectNum >= CONFIG_DISP_SURFACE_RECTS)
+    {
+        uint32_t u32Best = 0, u32BestGrow = UINT32_MAX;
+
+        for (i = 0; i < psSurf->m_u32RectNum; i++)
+        {
+            uint32_t u32Grow;
+
+            surface_rect_union(&sUnion, &sNew, &psSurf->m_asRect[i]);
+            u32Grow = surface_rect_area(&sUnion) - surface_rect_area(&psSurf->m_asRect[i]);
+
+            if (u32Grow < u32BestGrow)
+            {
+                u32BestGrow = u32Grow;
+                u32Best = i;
+            }
+        }
+
+        surface_rect_union(&psSurf->m_asRect[u32Best], &sNew, &psSurf->m_asRect[u32Best]);
+        return;
+    }
+
+    psSurf->m_asRect[psSurf->m_u32RectNum++] = sNew;
+}
+
+// Function to fill a rectangle and record it as dirty
+void disp_surface_fill_rect(S_DISP_SURFACE *psSurf, int i32X, int i32Y, int i32W, int i32H, uint16_t u16Color)
+{
+    S_DISP_RECT sRect;
+    uint32_t x, y;
+
+    if (!surface_clip(psSurf, &sRect, i32X, i32Y, i32W, i32H))
+        return;
+
+    for (y = sRect.m_u16Y; y < (uint32_t)(sRect.m_u16Y + sRect.m_u16H); y++)
+    {
+        uint16_t *pu16Row = &psSurf->m_pu16Buf[y * psSurf->m_u16Width];
+
+        for (x = sRect.m_u16X; x < (uint32_t)(sRect.m_u16X + sRect.m_u16W); x++)
+            pu16Row[x] = u16Color;
+    }
+
+    disp_surface_mark_dirty(psSurf, sRect.m_u16X, sRect.m_u16Y, sRect.m_u16W, sRect.m_u16H);
+}
+
+// Function to clean a cache-line aligned address range, the caller issues the barrier
+static uint32_t surface_clean_range(uint32_t u32Start, uint32_t u32End)
+{
+    uint32_t u32Lines = (u32End - u32Start) / DCACHE_LINE_SIZE;
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) && !defined(__CMSIS_HOST_H__)
+    for (; u32Start < u32End; u32Start += DCACHE_LINE_SIZE)
+        SCB->DCCMVAC = u32Start;
+#endif
+
+    return u32Lines;
+}
+
+// Function to clean the cache lines of the dirty rectangles and forget them, returns the lines cleaned
+int disp_surface_flush(S_DISP_SURFACE *psSurf)
+{
+    uint32_t u32Base, u32PendStart = 0, u32PendEnd = 0;
+    uint32_t u32Lines = 0, u32Ranges = 0;
+    uint32_t i, y;
+
+    if (!psSurf || !psSurf->m_pu16Buf)
+        return -1;
+
+    psSurf->m_u32CleanLines = 0;
+    psSurf->m_u32CleanRanges = 0;
+
+    if (!psSurf->m_u32RectNum)
+        return 0;
+
+    /* Write-through and non-cacheable buffers are already in SRAM once the writes drain. */
+    if (disp_mpu_get_policy(psSurf->m_pu16Buf) != evDispCacheWriteBack)
+    {
+        __DSB();
+        psSurf->m_u32RectNum = 0;
+        return 0;
+    }
+
+    u32Base = (uint32_t)psSurf->m_pu16Buf;
+
+    /* Order the rectangles by address so neighbouring rows join. */
+    for (i = 1; i < psSurf->m_u32RectNum; i++)
+    {
+        S_DISP_RECT sKey = psSurf->m_asRect[i];
+        uint32_t j = i;
+
+        while (j && ((psSurf->m_asRect[j - 1].m_u16Y > sKey.m_u16Y) ||
+                     ((psSurf->m_asRect[j - 1].m_u16Y == sKey.m_u16Y) && (psSurf->m_asRect[j - 1].m_u16X > sKey.m_u16X))))
+        {
+            psSurf->m_asRect[j] = psSurf->m_asRect[j - 1];
+            j--;
+        }
+
+        psSurf->m_asRect[j] = sKey;
+    }
+
+    __DSB();
+
+    for (i = 0; i < psSurf->m_u32RectNum; i++)
+    {
+        const S_DISP_RECT *psRect = &psSurf->m_asRect[i];
+
+        for (y = psRect->m_u16Y; y < (uint32_t)(psRect->m_u16Y + psRect->m_u16H); y++)
+        {
+            uint32_t u32Pixel = y * psSurf->m_u16Width + psRect->m_u16X;
+            uint32_t u32Start = (u32Base + u32Pixel * sizeof(uint16_t)) & ~DEF_SURFACE_LINE_MASK;
+            uint32_t u32End = (u32Base + (u32Pixel + psRect->m_u16W) * sizeof(uint16_t) + DEF_SURFACE_LINE_MASK) & ~DEF_SURFACE_LINE_MASK;
+
+            if ((u32PendEnd > u32PendStart) &&
+                    (u32Start >= u32PendStart) &&
+                    (u32Start <= (u32PendEnd + CONFIG_DISP_SURFACE_GAP_LINES * DCACHE_LINE_SIZE)))
+            {
+                /* Join, cleaning a short gap costs less than another range. */
+                if (u32End > u32PendEnd)
+                    u32PendEnd = u32End;
+
+                continue;
+            }
+
+            if (u32PendEnd > u32PendStart)
+            {
+                u32Lines += surface_clean_range(u32PendStart, u32PendEnd);
+                u32Ranges++;
+            }
+
+            u32PendStart = u32Start;
+            u32PendEnd = u32End;
+        }
+    }
+
+    if (u32PendEnd > u32PendStart)
+    {
+        u32Lines += surface_clean_range(u32PendStart, u32PendEnd);
+        u32Ranges++;
+    }
+
+    __DSB();
+    __ISB();
+
+    psSurf->m_u32RectNum = 0;
+    psSurf->m_u32CleanLines = u32Lines;
+    psSurf->m_u32CleanRanges = u32Ranges;
+
+    return (int)u32Lines;
+}
+
+// Function to flush a surface and show it from the next frame
+int disp_surface_present(S_DISP_SURFACE *psSurf)
+{
+    int i32Ret = disp_surface_flush(psSurf);
+
+    if (i32Ret >= 0)
+        disp_set_vrambufaddr(psSurf->m_pu16Buf);
+
+    return i32Ret;
+}
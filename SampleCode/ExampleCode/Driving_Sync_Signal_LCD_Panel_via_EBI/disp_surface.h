@@ -0,0 +1,62 @@
+/**************************************************************************//**
+ * @file     disp_surface.h
+ * @brief    Drawing surface over a VRAM buffer with dirty-rectangle tracked
+ *           D-cache maintenance. Drawing marks the touched rectangles, the
+ *           flush cleans only their cache lines before the buffer is shown.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_SURFACE_H__
+#define __DISP_SURFACE_H__
+
+#include "NuMicro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CONFIG_DISP_SURFACE_RECTS         8   /*!< Dirty rectangles tracked per surface, more are merged */
+#define CONFIG_DISP_SURFACE_GAP_LINES     2   /*!< Clean through gaps of up to this many cache lines instead of splitting the range */
+
+// Rectangle in pixels
+typedef struct
+{
+    uint16_t m_u16X;
+    uint16_t m_u16Y;
+    uint16_t m_u16W;
+    uint16_t m_u16H;
+} S_DISP_RECT;
+
+// Drawing surface over an RGB565 buffer
+typedef struct
+{
+    uint16_t   *m_pu16Buf;          /*!< Pixel buffer */
+    uint16_t    m_u16Width;         /*!< Width in pixels, also the stride */
+    uint16_t    m_u16Height;        /*!< Height in pixels */
+    uint32_t    m_u32RectNum;       /*!< Dirty rectangles recorded */
+    S_DISP_RECT m_asRect[CONFIG_DISP_SURFACE_RECTS];
+    uint32_t    m_u32CleanLines;    /*!< Cache lines cleaned by the last flush */
+    uint32_t    m_u32CleanRanges;   /*!< Contiguous ranges cleaned by the last flush */
+} S_DISP_SURFACE;
+
+// Function to initialize a surface over a pixel buffer, nothing is dirty
+int disp_surface_init(S_DISP_SURFACE *psSurf, void *pvBuf, uint16_t u16Width, uint16_t u16Height);
+
+// Function to record a rectangle the CPU has drawn, clipped to the surface
+void disp_surface_mark_dirty(S_DISP_SURFACE *psSurf, int i32X, int i32Y, int i32W, int i32H);
+
+// Function to fill a rectangle and record it as dirty
+void disp_surface_fill_rect(S_DISP_SURFACE *psSurf, int i32X, int i32Y, int i32W, int i32H, uint16_t u16Color);
+
+// Function to clean the cache lines of the dirty rectangles and forget them, returns the lines cleaned
+int disp_surface_flush(S_DISP_SURFACE *psSurf);
+
+// Function to flush a surface and show it from the next frame
+int disp_surface_present(S_DISP_SURFACE *psSurf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_SURFACE_H__ */
@@ -0,0 +1,179 @@
+/**************************************************************************//**
+ * @file     disp_swapbench.c
+ * @brief    Report frame pacing of each swapchain present mode over the UART
+ *           console. Enable CONFIG_DISP_SWAPBENCH in disp.h. A bar sweeping
+ *           the screen is rendered as fast as buffers can be acquired for
+ *           DEF_SWAPBENCH_FRAMES blanks. Set CONFIG_VRAM_BUF_NUM to 3 to see
+ *           rendering run ahead. A last run paces a frame every
+ *           DEF_SWAPBENCH_PACE blanks with disp_present_at(). The VRAM
+ *           content is overwritten.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "disp_surface.h"
+#include "disp_swapchain.h"
+#include "disp_vsync.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_SWAPBENCH)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_SWAPBENCH_FRAMES     120   /*!< Blanks to run each present mode for */
+#define DEF_SWAPBENCH_BAR_W      32    /*!< Width of the sweeping bar */
+#define DEF_SWAPBENCH_PACE       2     /*!< Blanks between frames of the paced run */
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to render one frame of the sweeping bar
+static void swapbench_render(S_DISP_SURFACE *psSurf, uint32_t u32Frame)
+{
+    int i32X = (int)((u32Frame * 8) % (CONFIG_TIMING_HACT - DEF_SWAPBENCH_BAR_W));
+
+    disp_surface_fill_rect(psSurf, 0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT, 0x0010);
+    disp_surface_fill_rect(psSurf, i32X, 0, DEF_SWAPBENCH_BAR_W, CONFIG_TIMING_VACT, 0xFFFF);
+    disp_surface_flush(psSurf);
+}
+
+// Function to run one present mode, returns negative if the blank interrupt stopped
+static int swapbench_run(E_DISP_PRESENT_MODE evMode)
+{
+    S_DISP_SURFACE sSurf;
+    S_DISP_SWAPCHAIN_STATS sStats;
+    S_DISP_RINGINFO sInfo;
+    uint32_t u32Blank, u32Frames = 0, u32Start, u32Elapsed;
+    uint32_t u32Timeout = nu_cyccnt_freq() * 2;
+    uint32_t u32LastBlank, u32LastBlankTime;
+
+    if (disp_swapchain_init(evMode) < 0)
+        return -1;
+
+    disp_get_ringinfo(&sInfo);
+    u32Blank = sInfo.m_u32BlankCount;
+    u32LastBlank = u32Blank;
+    u32Start = u32LastBlankTime = nu_cyccnt_get();
+
+    do
+    {
+        int i32Idx = disp_swapchain_acquire();
+
+        if (i32Idx >= 0)
+        {
+            disp_surface_init(&sSurf, disp_get_vrambuf(i32Idx), CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+            swapbench_render(&sSurf, u32Frames++);
+            disp_swapchain_present(i32Idx);
+        }
+        else
+        {
+            /* Every buffer is queued or on screen until the next blank. */
+            disp_wait_vblank(NULL);
+        }
+
+        disp_get_ringinfo(&sInfo);
+
+        if (sInfo.m_u32BlankCount != u32LastBlank)
+        {
+            u32LastBlank = sInfo.m_u32BlankCount;
+            u32LastBlankTime = nu_cyccnt_get();
+        }
+        else if ((nu_cyccnt_get() - u32LastBlankTime) > u32Timeout)
+        {
+            disp_swapchain_fini();
+            return -1;
+        }
+    } while ((sInfo.m_u32BlankCount - u32Blank) < DEF_SWAPBENCH_FRAMES);
+
+    u32Elapsed = nu_cyccnt_get() - u32Start;
+    disp_swapchain_fini();
+    disp_swapchain_get_stats(&sStats);
+
+    printf("%-8s %9u %6u %8u %9u %11u %10u\n",
+           disp_swapchain_mode_name(evMode),
+           sStats.m_u32Presented, sStats.m_u32Shown, sStats.m_u32Dropped, sStats.m_u32Repeated,
+           sStats.m_u32AcquireFails,
+           (uint32_t)(((uint64_t)u32Frames * nu_cyccnt_freq()) / u32Elapsed));
+
+    return 0;
+}
+
+// Function to present a frame every DEF_SWAPBENCH_PACE blanks and report the interval jitter
+static int swapbench_paced(void)
+{
+    S_DISP_SURFACE sSurf;
+    S_DISP_PRESENT_TIME sTime;
+    S_DISP_VSYNC_STATS sStats;
+    uint32_t u32Frame, u32Prev = 0, u32Min = 0xFFFFFFFF, u32Max = 0;
+    int i;
+
+    u32Frame = disp_get_frame(NULL);
+
+    for (i = 0; i < (DEF_SWAPBENCH_FRAMES / DEF_SWAPBENCH_PACE); i++)
+    {
+        disp_surface_init(&sSurf, disp_get_vrambuf(i & 1), CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+        swapbench_render(&sSurf, (uint32_t)i);
+
+        u32Frame += DEF_SWAPBENCH_PACE;
+
+        if (disp_present_at(disp_get_vrambuf(i & 1), u32Frame, &sTime) < 0)
+            return -1;
+
+        /* Keep the grid when late so one miss is counted once. */
+        u32Frame = sTime.m_u32Frame;
+
+        if (i && u32Prev && sTime.m_u32Stamp)
+        {
+            uint32_t u32Interval = sTime.m_u32Stamp - u32Prev;
+
+            u32Min = (u32Interval < u32Min) ? u32Interval : u32Min;
+            u32Max = (u32Interval > u32Max) ? u32Interval : u32Max;
+        }
+
+        u32Prev = sTime.m_u32Stamp;
+    }
+
+    disp_vsync_get_stats(&sStats);
+
+    printf("Paced every %d blanks: %u presents, %u missed by %u frames, interval %u..%u cycles.\n",
+           DEF_SWAPBENCH_PACE, sStats.m_u32Presents, sStats.m_u32Missed, sStats.m_u32LateFrames,
+           (u32Min == 0xFFFFFFFF) ? 0 : u32Min, u32Max);
+
+    return 0;
+}
+
+// Function to report the swapchain benchmark
+static int disp_swapbench_init(void)
+{
+    DispBlankCb pfnBlankCb;
+    int i32Mode, i32Ret = 0;
+
+    nu_cyccnt_init();
+
+    printf("Swapchain benchmark: %d VRAM buffers, %d blanks per mode.\n", CONFIG_VRAM_BUF_NUM, DEF_SWAPBENCH_FRAMES);
+    printf("%-8s %9s %6s %8s %9s %11s %10s\n", "Mode", "Presented", "Shown", "Dropped", "Repeated", "AcquireFail", "Render/s");
+
+    /* The swapchain chains the blank callback it replaces, hold the player off the VRAM buffers meanwhile. */
+    pfnBlankCb = disp_get_blankcb();
+    disp_set_blankcb(NULL);
+
+    for (i32Mode = 0; (i32Mode < evDispPresentCNT) && !i32Ret; i32Mode++)
+        i32Ret = swapbench_run((E_DISP_PRESENT_MODE)i32Mode);
+
+    disp_set_blankcb(pfnBlankCb);
+
+    if (i32Ret < 0)
+    {
+        printf("Swapchain benchmark: no blank interrupt.\n");
+        return -1;
+    }
+
+    return swapbench_paced();
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_SWAPBENCH", disp_swapbench_init, NULL);
+
+#endif /* defined(CONFIG_DISP_SWAPBENCH) */
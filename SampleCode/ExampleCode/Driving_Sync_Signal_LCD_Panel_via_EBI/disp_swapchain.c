@@ -0,0 +1,237 @@
+/**************************************************************************//**
+ * @file     disp_swapchain.c
+ * @brief    Swapchain over the VRAM buffers. The backend switches the ring to
+ *           the address of disp_set_vrambufaddr() at the next blank, then
+ *           calls the blank callback with the address now scanned out. So a
+ *           presented buffer is pending until the callback sees its address,
+ *           and only then is the buffer it replaces released. The callback
+ *           runs after the last active line, the lines up to the next
+ *           fetch from VRAM already point at the new buffer.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp.h"
+#include "disp_swapchain.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+typedef enum
+{
+    evSwapBufFree,          /*!< Free to acquire */
+    evSwapBufAcquired,      /*!< Rendered into by the application */
+    evSwapBufQueued,        /*!< Presented, waiting in the FIFO */
+    evSwapBufPending,       /*!< Presented, the ring switches to it at the next blank */
+    evSwapBufScanout        /*!< Scanned out */
+} E_SWAP_BUF_STATE;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static volatile E_SWAP_BUF_STATE s_aevBufState[CONFIG_VRAM_BUF_NUM];
+static volatile int s_ai32Queue[CONFIG_VRAM_BUF_NUM];
+static volatile uint32_t s_u32QueueHead = 0;
+static volatile uint32_t s_u32QueueNum = 0;
+static volatile int s_i32Pending = -1;
+static volatile int s_i32Scanout = -1;
+static E_DISP_PRESENT_MODE s_evMode = evDispPresentFIFO;
+static DispBlankCb s_pfnPrevBlankCb = NULL;
+static int s_bInit = 0;
+static S_DISP_SWAPCHAIN_STATS s_sStats;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to get the VRAM buffer index of an address, -1 if it is not a VRAM buffer
+static int swapchain_index_of(const void *pvAddr)
+{
+    int i;
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+    {
+        if (disp_get_vrambuf(i) == pvAddr)
+            return i;
+    }
+
+    return -1;
+}
+
+// Function to make a buffer the one the ring switches to at the next blank
+static void swapchain_set_pending(int i32Idx)
+{
+    s_i32Pending = i32Idx;
+    s_aevBufState[i32Idx] = evSwapBufPending;
+    disp_set_vrambufaddr(disp_get_vrambuf(i32Idx));
+}
+
+// Blank callback, runs in the scanout DMA interrupt
+static void swapchain_blankcb(void *p)
+{
+    if ((s_i32Pending >= 0) && (p == disp_get_vrambuf(s_i32Pending)))
+    {
+        /* The ring no longer refers to the old buffer from this blank on. */
+        if (s_i32Scanout >= 0)
+            s_aevBufState[s_i32Scanout] = evSwapBufFree;
+
+        s_i32Scanout = s_i32Pending;
+        s_aevBufState[s_i32Scanout] = evSwapBufScanout;
+        s_i32Pending = -1;
+        s_sStats.m_u32Shown++;
+    }
+    else
+    {
+        s_sStats.m_u32Repeated++;
+    }
+
+    if ((s_i32Pending < 0) && s_u32QueueNum)
+    {
+        int i32Idx = s_ai32Queue[s_u32QueueHead];
+
+        s_u32QueueHead = (s_u32QueueHead + 1) % CONFIG_VRAM_BUF_NUM;
+        s_u32QueueNum--;
+        swapchain_set_pending(i32Idx);
+    }
+
+    if (s_pfnPrevBlankCb)
+        s_pfnPrevBlankCb(p);
+}
+
+// Function to take over the VRAM buffers and the blank callback, the buffer on screen stays there. The blank callback it replaces still runs after each blank and must not flip buffers
+int disp_swapchain_init(E_DISP_PRESENT_MODE evMode)
+{
+    uint32_t u32PriMask;
+    int i;
+
+    if (s_bInit || (evMode >= evDispPresentCNT))
+        return -1;
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+        s_aevBufState[i] = evSwapBufFree;
+
+    s_u32QueueHead = 0;
+    s_u32QueueNum = 0;
+    s_i32Pending = -1;
+    s_evMode = evMode;
+    memset(&s_sStats, 0, sizeof(s_sStats));
+
+    /* A splash outside the VRAM buffers needs no release. */
+    s_i32Scanout = swapchain_index_of(disp_get_vrambufaddr());
+
+    if (s_i32Scanout >= 0)
+        s_aevBufState[s_i32Scanout] = evSwapBufScanout;
+
+    s_pfnPrevBlankCb = disp_get_blankcb();
+    disp_set_blankcb(swapchain_blankcb);
+    s_bInit = 1;
+
+    __set_PRIMASK(u32PriMask);
+
+    return 0;
+}
+
+// Function to hand the blank callback back, the last presented buffer stays on screen
+void disp_swapchain_fini(void)
+{
+    if (!s_bInit)
+        return;
+
+    disp_set_blankcb(s_pfnPrevBlankCb);
+    s_pfnPrevBlankCb = NULL;
+    s_bInit = 0;
+}
+
+// Function to get a buffer to render into, negative if every buffer is queued or on screen
+int disp_swapchain_acquire(void)
+{
+    uint32_t u32PriMask;
+    int i, i32Idx = -1;
+
+    if (!s_bInit)
+        return -1;
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    for (i = 0; i < CONFIG_VRAM_BUF_NUM; i++)
+    {
+        if (s_aevBufState[i] == evSwapBufFree)
+        {
+            s_aevBufState[i] = evSwapBufAcquired;
+            i32Idx = i;
+            break;
+        }
+    }
+
+    if (i32Idx < 0)
+        s_sStats.m_u32AcquireFails++;
+
+    __set_PRIMASK(u32PriMask);
+
+    return i32Idx;
+}
+
+// Function to queue an acquired buffer for display, the caller must have cleaned its D-cache lines
+int disp_swapchain_present(int i32Idx)
+{
+    uint32_t u32PriMask;
+
+    if (!s_bInit || (i32Idx < 0) || (i32Idx >= CONFIG_VRAM_BUF_NUM) || (s_aevBufState[i32Idx] != evSwapBufAcquired))
+        return -1;
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+
+    s_sStats.m_u32Presented++;
+
+    if (s_i32Pending < 0)
+    {
+        swapchain_set_pending(i32Idx);
+    }
+    else if (s_evMode == evDispPresentMailbox)
+    {
+        /* Not latched yet, the ring never saw the older buffer. */
+        s_aevBufState[s_i32Pending] = evSwapBufFree;
+        s_sStats.m_u32Dropped++;
+        swapchain_set_pending(i32Idx);
+    }
+    else
+    {
+        s_ai32Queue[(s_u32QueueHead + s_u32QueueNum) % CONFIG_VRAM_BUF_NUM] = i32Idx;
+        s_u32QueueNum++;
+        s_aevBufState[i32Idx] = evSwapBufQueued;
+    }
+
+    __set_PRIMASK(u32PriMask);
+
+    return 0;
+}
+
+// Function to give an acquired buffer back without presenting it
+int disp_swapchain_release(int i32Idx)
+{
+    if (!s_bInit || (i32Idx < 0) || (i32Idx >= CONFIG_VRAM_BUF_NUM) || (s_aevBufState[i32Idx] != evSwapBufAcquired))
+        return -1;
+
+    s_aevBufState[i32Idx] = evSwapBufFree;
+
+    return 0;
+}
+
+// Function to get the swapchain statistics
+void disp_swapchain_get_stats(S_DISP_SWAPCHAIN_STATS *psStats)
+{
+    *psStats = s_sStats;
+}
+
+// Function to get the name of a present mode
+const char *disp_swapchain_mode_name(E_DISP_PRESENT_MODE evMode)
+{
+    static const char *const s_aszName[evDispPresentCNT] = { "FIFO", "Mailbox" };
+
+    return (evMode < evDispPresentCNT) ? s_aszName[evMode] : "?";
+}
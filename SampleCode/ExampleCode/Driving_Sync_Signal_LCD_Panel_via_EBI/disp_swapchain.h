@@ -0,0 +1,63 @@
+/**************************************************************************//**
+ * @file     disp_swapchain.h
+ * @brief    Acquire/present swapchain over the CONFIG_VRAM_BUF_NUM VRAM
+ *           buffers. A buffer goes back to the free pool only at the blank
+ *           the scanout has moved to a newer buffer, so a free buffer is
+ *           never read by the DMA. With 3 or more buffers rendering runs
+ *           ahead of the scanout instead of waiting for the blank.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_SWAPCHAIN_H__
+#define __DISP_SWAPCHAIN_H__
+
+#include "NuMicro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    evDispPresentFIFO,       /*!< Every presented buffer is shown for at least one frame, in order */
+    evDispPresentMailbox,    /*!< The newest presented buffer is shown at the next blank, older unshown ones are dropped */
+    evDispPresentCNT         /*!< Number of present modes */
+} E_DISP_PRESENT_MODE;
+
+// Swapchain statistics
+typedef struct
+{
+    uint32_t m_u32Presented;        /*!< Buffers presented */
+    uint32_t m_u32Shown;            /*!< Buffers the scanout switched to */
+    uint32_t m_u32Dropped;          /*!< Mailbox buffers replaced before they were shown */
+    uint32_t m_u32Repeated;         /*!< Blanks without a new buffer, the last frame is shown again */
+    uint32_t m_u32AcquireFails;     /*!< Acquires with every buffer queued or on screen */
+} S_DISP_SWAPCHAIN_STATS;
+
+// Function to take over the VRAM buffers and the blank callback, the buffer on screen stays there. The blank callback it replaces still runs after each blank and must not flip buffers
+int disp_swapchain_init(E_DISP_PRESENT_MODE evMode);
+
+// Function to hand the blank callback back, the last presented buffer stays on screen
+void disp_swapchain_fini(void);
+
+// Function to get a buffer to render into, negative if every buffer is queued or on screen
+int disp_swapchain_acquire(void);
+
+// Function to queue an acquired buffer for display, the caller must have cleaned its D-cache lines
+int disp_swapchain_present(int i32Idx);
+
+// Function to give an acquired buffer back without presenting it
+int disp_swapchain_release(int i32Idx);
+
+// Function to get the swapchain statistics
+void disp_swapchain_get_stats(S_DISP_SWAPCHAIN_STATS *psStats);
+
+// Function to get the name of a present mode
+const char *disp_swapchain_mode_name(E_DISP_PRESENT_MODE evMode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_SWAPCHAIN_H__ */
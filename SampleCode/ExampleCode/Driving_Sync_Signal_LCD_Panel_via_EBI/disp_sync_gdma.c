@@ -6,14 +6,20 @@
  * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
  *****************************************************************************/
 
+#include <string.h>
 #include "dma350_lib.h"
 #include "dma350_ch_drv.h"
 #include "disp.h"
+#include "disp_backend.h"
+#include "disp_panel.h"
+#include "disp_probe.h"
 #include "nu_bitutil.h"
+#include "nu_cyccnt.h"
 
 /*---------------------------------------------------------------------------*/
 /* Define                                                                    */
 /*---------------------------------------------------------------------------*/
+#define DEF_GDMA_IRQ_PRIORITY   0   /*!< CH0 and CH1 share it, neither may preempt the other halfway through the prefetch state */
 
 typedef struct
 {
@@ -26,6 +32,16 @@ typedef struct
     S_CMDBUF m_dscH[evHStageCNT]; // Array of H stage descriptors
 } S_DSC_HLINE;
 
+// Descriptor generated once per shape and copied for each line of that shape
+typedef struct
+{
+    S_CMDBUF m_sCmd;
+    uint8_t  m_u8Words;        /*!< Words generated, 0 until built */
+    uint8_t  m_u8IntrenIdx;    /*!< Words patched in each copy */
+    uint8_t  m_u8SrcIdx;
+    uint8_t  m_u8LinkIdx;
+} S_CMDTPL;
+
 typedef struct
 {
 #if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
@@ -34,71 +50,77 @@ typedef struct
     S_DSC_HLINE    m_dscV[DEF_TOTAL_VLINES];
 } S_DSC_LCD;
 
+_Static_assert(sizeof(S_DSC_LCD) / sizeof(S_CMDBUF) == DISP_PANEL_DSC_NUM, "The GDMA ring must hold one command per stage of disp_panel.h.");
+_Static_assert(DISP_PANEL_XFER_MAX <= 0xFFFF, "A stage of this panel is longer than the 16-bit XSIZE of a DMA-350 command.");
+
+#if defined(CONFIG_DISP_RING_IMAGE)
+// Ring word of the generated image pointing into the VRAM, patched at start up
+typedef struct
+{
+    uint32_t m_u32Word;        /*!< Word index from the start of the ring */
+    uint32_t m_u32Offset;      /*!< Byte offset in the VRAM buffer */
+} S_RINGRELOC;
+#endif
+
 /*---------------------------------------------------------------------------*/
 /* Global variables                                                          */
 /*---------------------------------------------------------------------------*/
-#if defined(NVT_NONCACHEABLE)
+static uint32_t s_u32DummyData = 0xffffffff;
+
+#if defined(CONFIG_DISP_RING_IMAGE)
+    /* The links and the blank source of the image are address constants, the scatter-load copies it. */
+    #define DISP_RING_IMAGE_SECTION    NVT_NONCACHEABLE_INIT
+    #define DISP_RING_LINK(n)          ((uint32_t)&s_sDscLCD + (n) * sizeof(S_CMDBUF) + DMA_CH_LINKADDR_LINKADDREN_Msk)
+    #define DISP_RING_DUMMY            ((uint32_t)&s_u32DummyData)
+    #include "disp_ring_image.h"
+
+    #if (DISP_RING_IMAGE_HACT != CONFIG_TIMING_HACT) || (DISP_RING_IMAGE_VACT != CONFIG_TIMING_VACT) || \
+        (DISP_RING_IMAGE_HBP != CONFIG_TIMING_HBP) || (DISP_RING_IMAGE_HFP != CONFIG_TIMING_HFP) || (DISP_RING_IMAGE_HPW != CONFIG_TIMING_HPW) || \
+        (DISP_RING_IMAGE_VBP != CONFIG_TIMING_VBP) || (DISP_RING_IMAGE_VFP != CONFIG_TIMING_VFP) || (DISP_RING_IMAGE_VPW != CONFIG_TIMING_VPW) || \
+        (DISP_RING_IMAGE_DE_ONLY != defined(CONFIG_LCD_PANEL_USE_DE_ONLY)) || (DISP_RING_IMAGE_EBI_ADDR != CONFIG_DISP_EBI_ADDR)
+        #error "disp_ring_image.h was generated for another panel, run host/disp_ringgen.sh."
+    #endif
+#elif defined(NVT_NONCACHEABLE)
     NVT_NONCACHEABLE static S_DSC_LCD s_sDscLCD;
 #else
     static S_DSC_LCD s_sDscLCD;
 #endif
 
+static S_CMDTPL s_asCmdTpl[evVStageCNT][evHStageCNT];
+
 extern struct dma350_ch_dev_t *const GDMA_CH_DEV_S[];
 
-uint8_t g_au8FrameBuf[CONFIG_VRAM_TOTAL_ALLOCATED_SIZE] __attribute__((aligned(DCACHE_LINE_SIZE))); // Declare VRAM instance.
-static uint32_t s_u32DummyData = 0xffffffff;
 static S_CMDBUF *s_head = (S_CMDBUF *) &s_sDscLCD;
 static S_CMDBUF *s_end  = (S_CMDBUF *) &s_sDscLCD + (sizeof(s_sDscLCD) / sizeof(S_CMDBUF) - 1);
 static volatile uint16_t *s_pu16BufAddr = NULL;
-static DispBlankCb s_DispBlankCb = NULL;
-
-static const uint32_t s_au32HTiming[evHStageCNT] =
-{
-#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
-    DEF_HACT_INDEX,
-    CONFIG_TIMING_HACT
+static volatile int s_i32CopyState = 0;     /*!< 1: busy, 0: idle, negative: failed */
+static void *s_pvCopyDst = NULL;
+static uint32_t s_u32CopySize = 0;          /*!< Bytes of one row */
+static uint32_t s_u32CopyPitch = 0;         /*!< Bytes between destination rows */
+static uint32_t s_u32CopyRows = 0;
+static volatile uint32_t s_u32CopyIrq = 0;  /*!< 1: the copy completes in GDMACH0_IRQHandler */
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+static DispDmaDoneCb s_pfnCopyDone = NULL;
+static void *s_pvCopyUser = NULL;
+/* Linked commands of a frame-sized byte swap, read by CH0 */
+#if defined(NVT_NONCACHEABLE)
+    NVT_NONCACHEABLE static uint32_t s_au32SwapCmd[DMA350_ENDIAN_SWAP_CMDBUF_WORDS(CONFIG_TIMING_HACT * CONFIG_TIMING_VACT)];
 #else
-    CONFIG_TIMING_HFP,
-    CONFIG_TIMING_HPW,
-    CONFIG_TIMING_HBP,
-    CONFIG_TIMING_HACT
+    static uint32_t s_au32SwapCmd[DMA350_ENDIAN_SWAP_CMDBUF_WORDS(CONFIG_TIMING_HACT * CONFIG_TIMING_VACT)];
 #endif
-};
-
-static const uint32_t s_au32VTiming[evVStageCNT] =
-{
-#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
-    DEF_VACT_INDEX,
-    CONFIG_TIMING_VACT
-#else
-    CONFIG_TIMING_VFP,
-    CONFIG_TIMING_VPW,
-    CONFIG_TIMING_VBP,
-    CONFIG_TIMING_VACT
 #endif
+static S_DISP_RINGINFO s_sRingInfo =
+{
+    .m_szBackend    = "GDMA",
+    .m_u32DscNum    = sizeof(S_DSC_LCD) / sizeof(S_CMDBUF),
+    .m_u32DscSize   = sizeof(S_CMDBUF),
+    .m_u32RingSize  = sizeof(S_DSC_LCD),
+    .m_u32FetchSize = 0,
 };
+
 /*---------------------------------------------------------------------------*/
 /* Functions                                                                 */
 /*---------------------------------------------------------------------------*/
-// Function to get the current V stage based on the line index
-static E_VSTAGE get_current_vstage(int i32LineIdx)
-{
-    int sum = 0;
-    E_VSTAGE i;
-
-    for (i = 0; i < evVStageCNT; i++)
-    {
-        sum += s_au32VTiming[i];
-
-        if (i32LineIdx < sum)
-        {
-            return i;
-        }
-    }
-
-    return 0;
-}
-
 // Function to initialize the GDMA descriptors for display synchronization
 static void disp_cmdlink_config(struct dma350_cmdlink_gencfg_t *cmdlink_cfg, uint32_t u32AddrSrc, uint32_t u32AddrDst, uint32_t u32XferCount, uint16_t u16AddrSrcInc, uint16_t u16AddrDstInc)
 {
@@ -113,11 +135,56 @@ static void disp_cmdlink_config(struct dma350_cmdlink_gencfg_t *cmdlink_cfg, uin
     dma350_cmdlink_enable_linkaddr(cmdlink_cfg);
 }
 
+// Function to get the word of a field in a descriptor, the header is word 0
+static uint32_t disp_cmdtpl_index(uint32_t u32Header, uint32_t u32FieldSet)
+{
+    uint32_t u32HdrVal = u32Header & (u32FieldSet - 1) & ~0x3; //Start bit2
+    uint32_t u32Idx = 1;
+
+    while (u32HdrVal)
+    {
+        u32Idx++;
+        u32HdrVal &= (u32HdrVal - 1);
+    }
+
+    return u32Idx;
+}
+
+// Function to generate a descriptor template, only the source, interrupt enable and link differ between its copies
+static void disp_cmdtpl_build(S_CMDTPL *psTpl, struct dma350_cmdlink_gencfg_t *cmdlink_cfg)
+{
+    uint32_t *pu32End;
+
+    dma350_cmdlink_disable_intr(cmdlink_cfg, DMA350_CH_INTREN_DONE);
+    dma350_cmdlink_set_linkaddr32(cmdlink_cfg, 0);
+    pu32End = dma350_cmdlink_generate(cmdlink_cfg, psTpl->m_sCmd.m_cmdbuf, &psTpl->m_sCmd.m_cmdbuf[DEF_CMDBUF_SIZE - 1]);
+
+    psTpl->m_u8Words = (uint8_t)(pu32End - psTpl->m_sCmd.m_cmdbuf);
+    psTpl->m_u8IntrenIdx = (uint8_t)disp_cmdtpl_index(psTpl->m_sCmd.m_cmdbuf[0], DMA350_CMDLINK_INTREN_SET);
+    psTpl->m_u8SrcIdx = (uint8_t)disp_cmdtpl_index(psTpl->m_sCmd.m_cmdbuf[0], DMA350_CMDLINK_SRC_ADDR_SET);
+    psTpl->m_u8LinkIdx = (uint8_t)disp_cmdtpl_index(psTpl->m_sCmd.m_cmdbuf[0], DMA350_CMDLINK_LINKADDR_SET);
+}
+
+// Function to write a descriptor as a copy of its template
+static void disp_cmdtpl_stamp(S_CMDBUF *psDsc, const S_CMDTPL *psTpl, uint32_t u32AddrSrc, int i32Intr, const S_CMDBUF *psLink)
+{
+    uint32_t *pu32Dsc = psDsc->m_cmdbuf;
+    uint32_t u32Intren = psTpl->m_sCmd.m_cmdbuf[psTpl->m_u8IntrenIdx];
+
+    memcpy(pu32Dsc, psTpl->m_sCmd.m_cmdbuf, psTpl->m_u8Words * sizeof(uint32_t));
+    pu32Dsc[psTpl->m_u8IntrenIdx] = i32Intr ? (u32Intren | DMA350_CH_INTREN_DONE) : (u32Intren & ~DMA350_CH_INTREN_DONE);
+    pu32Dsc[psTpl->m_u8SrcIdx] = u32AddrSrc;
+    pu32Dsc[psTpl->m_u8LinkIdx] = (psTpl->m_sCmd.m_cmdbuf[psTpl->m_u8LinkIdx] & ~DMA_CH_LINKADDR_LINKADDR_Msk) |
+                                  ((uint32_t)psLink & DMA_CH_LINKADDR_LINKADDR_Msk);
+}
+
 static void disp_gdma_dsc_init(void)
 {
 
     int i;
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
     uint16_t *pu16Buf = (uint16_t *)s_pu16BufAddr;
+#endif
     S_CMDBUF *next = s_head; // first descriptor.
     struct dma350_cmdlink_gencfg_t cmdlink_cfg;
 
@@ -131,8 +198,8 @@ static void disp_gdma_dsc_init(void)
 
     /* (CONFIG_TIMING_VFP+CONFIG_TIMING_VPW+CONFIG_TIMING_VBP) * (CONFIG_TIMING_HFP+CONFIG_TIMING_HPW+CONFIG_TIMING_HBP+CONFIG_TIMING_HACT) */
     u32AddrSrc = (uint32_t)&s_u32DummyData;
-    u32AddrDst = CONFIG_DISP_EBI_ADDR;
-    u32XferCount = (CONFIG_TIMING_VFP + CONFIG_TIMING_VPW + CONFIG_TIMING_VBP) * (CONFIG_TIMING_HFP + CONFIG_TIMING_HPW + CONFIG_TIMING_HBP + CONFIG_TIMING_HACT);
+    u32AddrDst = disp_panel_ebi_addr(evVStageVFP_VSYNC_VBP, evHStageHFP_HSYNC_HBP);
+    u32XferCount = DISP_PANEL_BLANK_XFER;
     u16AddrSrcInc = 0;
     u16AddrDstInc = 0;
     disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, u32XferCount, u16AddrSrcInc, u16AddrDstInc);
@@ -141,118 +208,109 @@ static void disp_gdma_dsc_init(void)
     dma350_cmdlink_generate(&cmdlink_cfg, (uint32_t *)next, (uint32_t *)((uint32_t)next + sizeof(S_CMDBUF) - sizeof(uint32_t)));
     next++;
 
+    /* Front descriptor */
+    u32AddrSrc = (uint32_t)&s_u32DummyData;
+    u32AddrDst = disp_panel_ebi_addr(evVStageVACT, evHStageHFP_HSYNC_HBP);
+    u32XferCount = disp_panel_hstage_xfer(evHStageHFP_HSYNC_HBP);
+    u16AddrSrcInc = 0;
+    u16AddrDstInc = 0;
+
+    disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, u32XferCount, u16AddrSrcInc, u16AddrDstInc);
+    disp_cmdtpl_build(&s_asCmdTpl[evVStageVACT][evHStageHFP_HSYNC_HBP], &cmdlink_cfg);
+
+    /* Backend descriptor */
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    u32AddrSrc = (uint32_t)disp_prefetch_get_linebuf(0);
+#else
+    u32AddrSrc = (uint32_t)pu16Buf;
+#endif
+    u32AddrDst = disp_panel_ebi_addr(evVStageVACT, evHStageHACT);
+    u32XferCount = disp_panel_hstage_xfer(evHStageHACT);
+    u16AddrSrcInc = 1;
+    u16AddrDstInc = 0;
+
+    disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, u32XferCount, u16AddrSrcInc, u16AddrDstInc);
+    disp_cmdtpl_build(&s_asCmdTpl[evVStageVACT][evHStageHACT], &cmdlink_cfg);
+
     for (i = 0; i < CONFIG_TIMING_VACT; i++)
     {
-        /* Front descriptor */
-        u32AddrSrc = (uint32_t)&s_u32DummyData;
-        u32AddrDst = CONFIG_DISP_EBI_ADDR;
-        u32XferCount = CONFIG_TIMING_HFP + CONFIG_TIMING_HPW + CONFIG_TIMING_HBP;
-        u16AddrSrcInc = 0;
-        u16AddrDstInc = 0;
-
-        disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, u32XferCount, u16AddrSrcInc, u16AddrDstInc);
-        dma350_cmdlink_disable_intr(&cmdlink_cfg, DMA350_CH_INTREN_DONE);
-        dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)(next + 1));
-        dma350_cmdlink_generate(&cmdlink_cfg, (uint32_t *)next, (uint32_t *)((uint32_t)next + sizeof(S_CMDBUF) - sizeof(uint32_t)));
+        disp_cmdtpl_stamp(next, &s_asCmdTpl[evVStageVACT][evHStageHFP_HSYNC_HBP], (uint32_t)&s_u32DummyData, 0, next + 1);
         next++;
 
-        /* Backend descriptor */
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+        u32AddrSrc = (uint32_t)disp_prefetch_get_linebuf(i);
+#else
         u32AddrSrc = (uint32_t)&pu16Buf[i * CONFIG_TIMING_HACT];
-        u32AddrDst = CONFIG_DISP_EBI_ADDR + CONFIG_DISP_DE_ACTIVE;
-        u32XferCount = CONFIG_TIMING_HACT;
-        u16AddrSrcInc = 1;
-        u16AddrDstInc = 0;
-
-        disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, u32XferCount, u16AddrSrcInc, u16AddrDstInc);
+#endif
 
         if (i == (CONFIG_TIMING_VACT - 1))
         {
-            dma350_cmdlink_enable_intr(&cmdlink_cfg, DMA350_CH_INTREN_DONE);
-            dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)s_head);
+            disp_cmdtpl_stamp(next, &s_asCmdTpl[evVStageVACT][evHStageHACT], u32AddrSrc, 1, s_head);
         }
         else
         {
-            dma350_cmdlink_disable_intr(&cmdlink_cfg, DMA350_CH_INTREN_DONE);
-            dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)(next + 1));
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+            /* Raise a line-interrupt to pace the prefetcher. */
+            disp_cmdtpl_stamp(next, &s_asCmdTpl[evVStageVACT][evHStageHACT], u32AddrSrc, 1, next + 1);
+#else
+            disp_cmdtpl_stamp(next, &s_asCmdTpl[evVStageVACT][evHStageHACT], u32AddrSrc, 0, next + 1);
+#endif
         }
 
-        dma350_cmdlink_generate(&cmdlink_cfg, (uint32_t *)next, (uint32_t *)((uint32_t)next + sizeof(S_CMDBUF) - sizeof(uint32_t)));
         next++;
 
     } // for(i = 0; i < CONFIG_TIMING_VACT; i++)
 
 #else
 
+    for (i = 0; i < evVStageCNT; i++)
+    {
+        E_HSTAGE evH;
+
+        for (evH = 0; evH < evHStageCNT; evH++)
+            s_asCmdTpl[i][evH].m_u8Words = 0;
+    }
+
     for (i = 0; i < DEF_TOTAL_VLINES; i++)
     {
         E_HSTAGE evH;
-        E_VSTAGE evV = get_current_vstage(i);
+        E_VSTAGE evV = disp_panel_vstage(i);
 
-        /* Set each VSYNC lines. */
+        /* Set each H stage of the line, the destination address drives the sync levels of disp_panel.h. */
         for (evH = 0; evH < evHStageCNT; evH++)
         {
+            S_CMDTPL *psTpl = &s_asCmdTpl[evV][evH];
             uint32_t u32AddrSrc = (uint32_t)&s_u32DummyData;
-            uint32_t u32AddrDst;
-            uint32_t u32XferCount = s_au32HTiming[evH];
-            uint16_t u16AddrSrcInc = 0;
-            uint16_t u16AddrDstInc = 0;
+            int i32Active = disp_panel_is_active(evV, evH);
+            int i32Intr;
 
-            switch (evV)
+            /* The active stage increments its source through the VRAM line, the others repeat the blank word. */
+            if (i32Active)
             {
-                case evVStageVSYNC:
-                    /* Set each H stage in a VSYNC line. */
-                    /* Set source memory address is fixed and destination memory address is fixed. */
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_VSYNC_ACTIVE + CONFIG_DISP_HSYNC_ACTIVE) :
-                                 (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_VSYNC_ACTIVE);
-                    break;
-
-                case evVStageVBP:
-                    /* Set each H stage in a VBP line. */
-                    /* Set source memory address is fixed and destination memory address is fixed. */
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_HSYNC_ACTIVE) : (CONFIG_DISP_EBI_ADDR);
-                    break;
-
-                case evVStageVACT:
-
-                    /* Set each H stage in a VACT line. */
-                    /* evHStageHACT stage: Set source memory address is incremented and destination memory address is fixed. */
-                    /* Others stage: Set source memory address is fixed and destination memory address is fixed. */
-                    if (evH == evHStageHACT)
-                    {
-                        u32AddrSrc = (uint32_t)pu16Buf;
-                        pu16Buf = pu16Buf + CONFIG_TIMING_HACT;
-                    }
-
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_HSYNC_ACTIVE) :
-                                 (evH == evHStageHACT) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_DE_ACTIVE) :
-                                 (CONFIG_DISP_EBI_ADDR);
-                    u16AddrSrcInc = (evH == evHStageHACT) ? 1 : 0;
-                    break;
-
-                case evVStageVFP:
-                    /* Set each H stage in a VFP line. */
-                    /* Set source memory address is fixed and destination memory address is fixed. */
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_HSYNC_ACTIVE) : (CONFIG_DISP_EBI_ADDR);
-                    break;
-
-                default:
-                    break;
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+                /* Scan out of the SRAM line buffers, the prefetcher fills them from VRAM. */
+                u32AddrSrc = (uint32_t)disp_prefetch_get_linebuf(i - DEF_VACT_INDEX);
+#else
+                u32AddrSrc = (uint32_t)pu16Buf;
+                pu16Buf = pu16Buf + CONFIG_TIMING_HACT;
+#endif
             }
 
-            disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, u32XferCount, u16AddrSrcInc, u16AddrDstInc);
-
-            if (next == s_end)
+            /* Lines of a V stage only differ in the source of the active stage, generate the first one. */
+            if (!psTpl->m_u8Words)
             {
-                dma350_cmdlink_enable_intr(&cmdlink_cfg, DMA350_CH_INTREN_DONE);
-                dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)s_head);
-            }
-            else
-            {
-                dma350_cmdlink_disable_intr(&cmdlink_cfg, DMA350_CH_INTREN_DONE);
-                dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)(next + 1));
+                disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, disp_panel_ebi_addr(evV, evH), disp_panel_hstage_xfer(evH), i32Active ? 1 : 0, 0);
+                disp_cmdtpl_build(psTpl, &cmdlink_cfg);
             }
 
-            dma350_cmdlink_generate(&cmdlink_cfg, (uint32_t *)next, (uint32_t *)((uint32_t)next + sizeof(S_CMDBUF) - sizeof(uint32_t)));
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+            /* Raise a line-interrupt to pace the prefetcher. */
+            i32Intr = (next == s_end) || i32Active;
+#else
+            i32Intr = (next == s_end);
+#endif
+
+            disp_cmdtpl_stamp(next, psTpl, u32AddrSrc, i32Intr, (next == s_end) ? s_head : (next + 1));
 
             next++;
 
@@ -264,6 +322,34 @@ static void disp_gdma_dsc_init(void)
 
 }
 
+#if defined(CONFIG_DISP_RING_IMAGE)
+// Function to point the generated ring image at the start buffer, fails if the image carries other DMA attributes than the MPU gives
+static int disp_gdma_image_init(void)
+{
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
+    uint32_t *pu32Ring = (uint32_t *)&s_sDscLCD;
+    uint32_t u32SrcCfgDummy, u32DesCfgEBI, i;
+
+    disp_cmdlink_config(&cmdlink_cfg, (uint32_t)&s_u32DummyData, CONFIG_DISP_EBI_ADDR, 1, 0, 0);
+    u32SrcCfgDummy = cmdlink_cfg.cfg.srctranscfg;
+    u32DesCfgEBI = cmdlink_cfg.cfg.destranscfg;
+    disp_cmdlink_config(&cmdlink_cfg, (uint32_t)s_pu16BufAddr, CONFIG_DISP_EBI_ADDR, 1, 1, 0);
+
+    if ((u32SrcCfgDummy != DISP_RING_SRCCFG_DUMMY) || (cmdlink_cfg.cfg.srctranscfg != DISP_RING_SRCCFG_VRAM) ||
+            (u32DesCfgEBI != DISP_RING_DESCFG_EBI))
+    {
+        printf("Ring image attributes differ, building the ring. Regenerate with host/disp_ringgen.sh -S 0x%08X -V 0x%08X -E 0x%08X.\n",
+               u32SrcCfgDummy, cmdlink_cfg.cfg.srctranscfg, u32DesCfgEBI);
+        return -1;
+    }
+
+    for (i = 0; i < DISP_RING_IMAGE_RELOC_NUM; i++)
+        pu32Ring[s_asRingReloc[i].m_u32Word] = (uint32_t)s_pu16BufAddr + s_asRingReloc[i].m_u32Offset;
+
+    return 0;
+}
+#endif
+
 // Array of strings representing the GDMA descriptor item names
 static const char *szGDMADscItemName[] =
 {
@@ -398,6 +484,110 @@ static uint32_t gdma_dsc_find_srcaddr_index(S_CMDBUF *psCmdBuf)
     return 0xffffffff;
 }
 
+// Function to count the bytes GDMA fetches to walk the command ring once
+static uint32_t gdma_dsc_fetch_size(void)
+{
+    S_CMDBUF *next;
+    uint32_t u32Size = 0;
+
+    for (next = s_head; next <= s_end; next++)
+    {
+        struct dma350_cmdlink_gencfg_t *cmdlink_cfg = (struct dma350_cmdlink_gencfg_t *)next;
+        uint32_t u32HdrVal = cmdlink_cfg->header & ~0x3; //Start bit2
+
+        /* Header word plus one word per register set in the header. */
+        u32Size += sizeof(uint32_t);
+
+        while (u32HdrVal)
+        {
+            u32Size += sizeof(uint32_t);
+            u32HdrVal &= (u32HdrVal - 1);
+        }
+    }
+
+    return u32Size;
+}
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+// Function to get the index of the command the scanout channel is on
+static uint32_t disp_gdma_dsc_index(void)
+{
+    /* LINKADDR holds the next command, which is enough to tell the next line. */
+    uint32_t u32Next = GDMA_CH_DEV_S[1]->cfg.ch_base->CH_LINKADDR & DMA_CH_LINKADDR_LINKADDR_Msk;
+
+    return (u32Next - (uint32_t)s_head) / sizeof(S_CMDBUF);
+}
+
+// Function to copy one line from VRAM into a line buffer on GDMA CH0
+static int disp_gdma_prefetch_copy(void *pvDst, const void *pvSrc, uint32_t u32Size)
+{
+    return (dma350_memcpy(GDMA_CH_DEV_S[0], pvSrc, pvDst, u32Size, DMA350_LIB_EXEC_IRQ) == DMA350_LIB_ERR_NONE) ? 0 : -1;
+}
+
+// GDMA line copy interrupt handler, gdma_init() gives it the priority of GDMACH1_IRQHandler
+NVT_ITCM void GDMACH0_IRQHandler(void)
+{
+    union dma350_ch_status_t status = dma350_ch_get_status(GDMA_CH_DEV_S[0]);
+
+    if (status.b.STAT_DONE)
+    {
+        GDMA_CH_DEV_S[0]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_DONE;
+
+        disp_prefetch_copy_done();
+    }
+    else if (status.b.STAT_ERR)
+    {
+        GDMA_CH_DEV_S[0]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_ERR;
+    }
+}
+
+#else
+
+// Function to finish the background copy that completes in the interrupt
+static void disp_gdma_copy_done(int i32Result)
+{
+    DispDmaDoneCb pfnDone = s_pfnCopyDone;
+    uint32_t i;
+
+    if (i32Result == 0)
+    {
+        /* Drop lines the core may have speculatively fetched during the copy. */
+        for (i = 0; i < s_u32CopyRows; i++)
+            SCB_InvalidateDCache_by_Addr((uint8_t *)s_pvCopyDst + (i * s_u32CopyPitch), (int32_t)s_u32CopySize);
+    }
+
+    s_pfnCopyDone = NULL;
+    s_u32CopyIrq = 0;
+    s_i32CopyState = i32Result;
+
+    if (pfnDone)
+        pfnDone(s_pvCopyUser, i32Result);
+}
+
+// GDMA copy interrupt handler, only background swaps enable the CH0 done interrupt
+NVT_ITCM void GDMACH0_IRQHandler(void)
+{
+    union dma350_ch_status_t status = dma350_ch_get_status(GDMA_CH_DEV_S[0]);
+
+    if (status.b.STAT_DONE)
+    {
+        GDMA_CH_DEV_S[0]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_DONE;
+
+        if (s_u32CopyIrq)
+            disp_gdma_copy_done(0);
+    }
+    else if (status.b.STAT_ERR)
+    {
+        GDMA_CH_DEV_S[0]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_ERR;
+
+        if (s_u32CopyIrq)
+            disp_gdma_copy_done(-1);
+    }
+}
+
+#endif
+
 // GDMA interrupt handler
 NVT_ITCM void GDMACH1_IRQHandler(void)
 {
@@ -405,21 +595,51 @@ NVT_ITCM void GDMACH1_IRQHandler(void)
 
     if (status.b.STAT_DONE)
     {
+        uint32_t u32IsrStart = nu_cyccnt_get();
+        DispBlankCb pfnBlankCb;
+
+        disp_probe_begin(evDispProbeGdmaIsr);
+
         GDMA_CH_DEV_S[1]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_DONE;
 
-#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+        uint32_t u32Start;
+
+        /* Line-interrupts only advance the prefetcher, the last line ends the frame. */
+        if (disp_prefetch_scanline(disp_gdma_dsc_index()) < CONFIG_TIMING_VACT)
+        {
+            disp_probe_end(evDispProbeGdmaIsr);
+            disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
+            return;
+        }
+
+        /* The ring always scans the line buffers, switch the prefetch source instead. */
+        u32Start = nu_cyccnt_get();
+        disp_prefetch_frame((const uint16_t *)s_pu16BufAddr);
+        s_sRingInfo.m_u32FlipCycles = nu_cyccnt_get() - u32Start;
+
+        if (s_sRingInfo.m_u32FlipCycles > s_sRingInfo.m_u32FlipMaxCycles)
+            s_sRingInfo.m_u32FlipMaxCycles = s_sRingInfo.m_u32FlipCycles;
+
+#elif defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
         uint32_t u32SrcBufAddrIdx = gdma_dsc_find_srcaddr_index(&s_sDscLCD.m_dscV[0].m_dscH[evHStageHACT]) + 1;
 
         if ((s_sDscLCD.m_dscV[0].m_dscH[evHStageHACT].m_cmdbuf[u32SrcBufAddrIdx] != (uint32_t)s_pu16BufAddr))
         {
             int i;
+            uint32_t u32Start = nu_cyccnt_get();
 
             /* Switch new VRAM buffer address. */
-            for (i = 0; i < s_au32VTiming[evVStageVACT]; i++)
+            for (i = 0; i < CONFIG_TIMING_VACT; i++)
             {
                 /* Update every lines. */
                 s_sDscLCD.m_dscV[i].m_dscH[evHStageHACT].m_cmdbuf[u32SrcBufAddrIdx] = (uint32_t)&s_pu16BufAddr[i * CONFIG_TIMING_HACT];
             }
+
+            s_sRingInfo.m_u32FlipCycles = nu_cyccnt_get() - u32Start;
+
+            if (s_sRingInfo.m_u32FlipCycles > s_sRingInfo.m_u32FlipMaxCycles)
+                s_sRingInfo.m_u32FlipMaxCycles = s_sRingInfo.m_u32FlipCycles;
         }
 
 #else
@@ -428,19 +648,37 @@ NVT_ITCM void GDMACH1_IRQHandler(void)
         if ((s_sDscLCD.m_dscV[DEF_VACT_INDEX].m_dscH[evHStageHACT].m_cmdbuf[u32SrcBufAddrIdx] != (uint32_t)s_pu16BufAddr))
         {
             int i;
+            uint32_t u32Start = nu_cyccnt_get();
 
             /* Switch new VRAM buffer address. */
-            for (i = 0; i < s_au32VTiming[evVStageVACT]; i++)
+            for (i = 0; i < CONFIG_TIMING_VACT; i++)
             {
                 /* Update every lines. */
                 s_sDscLCD.m_dscV[DEF_VACT_INDEX + i].m_dscH[evHStageHACT].m_cmdbuf[u32SrcBufAddrIdx] = (uint32_t)&s_pu16BufAddr[i * CONFIG_TIMING_HACT];
             }
+
+            s_sRingInfo.m_u32FlipCycles = nu_cyccnt_get() - u32Start;
+
+            if (s_sRingInfo.m_u32FlipCycles > s_sRingInfo.m_u32FlipMaxCycles)
+                s_sRingInfo.m_u32FlipMaxCycles = s_sRingInfo.m_u32FlipCycles;
         }
 
 #endif
 
-        if (s_DispBlankCb)
-            s_DispBlankCb((void *)s_pu16BufAddr);
+        s_sRingInfo.m_u32BlankStamp = nu_cyccnt_get();
+        s_sRingInfo.m_u32BlankCount++;
+
+        pfnBlankCb = disp_get_blankcb();
+
+        if (pfnBlankCb)
+        {
+            disp_probe_begin(evDispProbeBlankCb);
+            pfnBlankCb((void *)s_pu16BufAddr);
+            disp_probe_end(evDispProbeBlankCb);
+        }
+
+        disp_probe_end(evDispProbeGdmaIsr);
+        disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
     }
     else
     {
@@ -467,8 +705,13 @@ static void gdma_init(void)
     dma350_set_ch_privileged(&GDMA_DEV_S, 1);
 
     /* Enable NVIC for GDMA CH1 */
+    NVIC_SetPriority(GDMACH1_IRQn, DEF_GDMA_IRQ_PRIORITY);
     NVIC_EnableIRQ(GDMACH1_IRQn);
 
+    /* Enable NVIC for GDMA CH0, the line copy channel in the HyperRAM mode, background swaps otherwise */
+    NVIC_SetPriority(GDMACH0_IRQn, DEF_GDMA_IRQ_PRIORITY);
+    NVIC_EnableIRQ(GDMACH0_IRQn);
+
     /* Unlock protected registers */
     if (u32RegLocked)
         SYS_LockReg();
@@ -486,6 +729,9 @@ static void gdma_fini(void)
     /* Disable NVIC for GDMA CH1 */
     NVIC_DisableIRQ(GDMACH1_IRQn);
 
+    /* Disable NVIC for GDMA CH0 */
+    NVIC_DisableIRQ(GDMACH0_IRQn);
+
     /* Reset GDMA module */
     SYS_ResetModule(SYS_GDMA0RST);
 
@@ -497,21 +743,35 @@ static void gdma_fini(void)
         SYS_LockReg();
 }
 
-// Function to initialize EBI sync GDMA
-static int disp_sync_gdma_init(void)
+// Function to initialize EBI sync GDMA and start the scanout on a buffer
+static int disp_sync_gdma_init(void *pvBufAddr)
 {
     enum dma350_lib_error_t lib_err;
 
-    /* Set the VRAM address by default. */
-    s_pu16BufAddr = (uint16_t *)g_au8FrameBuf;
+    s_pu16BufAddr = (volatile uint16_t *)pvBufAddr;
 
     /* Enable GDMA module clock and un-mask interrupt. */
     gdma_init();
 
     /* Initial all Lines descriptor-link. */
-    disp_gdma_dsc_init();
+    nu_cyccnt_init();
+    disp_probe_begin(evDispProbeRingBuild);
+    s_sRingInfo.m_u32BuildCycles = nu_cyccnt_get();
+#if defined(CONFIG_DISP_RING_IMAGE)
+    if (disp_gdma_image_init() < 0)
+#endif
+        disp_gdma_dsc_init();
+    s_sRingInfo.m_u32BuildCycles = nu_cyccnt_get() - s_sRingInfo.m_u32BuildCycles;
+    disp_probe_end(evDispProbeRingBuild);
+    s_sRingInfo.m_u32FetchSize = gdma_dsc_fetch_size();
     //disp_gdma_dsc_dump();
 
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    /* Fill the first line buffers before the ring reaches line 0. */
+    disp_prefetch_init(disp_gdma_prefetch_copy);
+    disp_prefetch_frame((const uint16_t *)s_pu16BufAddr);
+#endif
+
     /* Link to external command */
     dma350_ch_enable_linkaddr(GDMA_CH_DEV_S[1]);
     dma350_ch_set_linkaddr32(GDMA_CH_DEV_S[1], (uint32_t) s_head);
@@ -526,25 +786,196 @@ static int disp_sync_gdma_fini(void)
     /* Disable GDMA module clock and mask interrupt. */
     gdma_fini();
 
+    /* A copy in flight on CH0 ends with the reset. */
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    s_pfnCopyDone = NULL;
+#endif
+    s_u32CopyIrq = 0;
+    s_i32CopyState = 0;
+
     return 0;
 }
 
-// Function to set the VRAM buffer address
-void disp_set_vrambufaddr(void *pvBufAddr)
+// Function to scan out another VRAM buffer from the next blank
+static void disp_gdma_flip(void *pvBufAddr)
 {
     s_pu16BufAddr = (volatile uint16_t *)pvBufAddr;
 }
 
-// Function to get the VRAM buffer address
-void *disp_get_vrambufaddr(void)
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+// Function to prepare the D-cache for a background copy of rows
+static void disp_gdma_copy_cache(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32RowSize, uint32_t u32Rows)
+{
+    uint32_t i;
+
+    /* The DMA reads memory, not the D-cache, and the destination must not keep lines to write back over it. */
+    for (i = 0; i < u32Rows; i++)
+    {
+        SCB_CleanDCache_by_Addr((uint8_t *)pvSrc + (i * u32SrcPitch), (int32_t)u32RowSize);
+        SCB_CleanInvalidateDCache_by_Addr((uint8_t *)pvDst + (i * u32DstPitch), (int32_t)u32RowSize);
+    }
+}
+
+// Function to record the rows of the copy started on CH0 for disp_gdma_copy_poll()
+static void disp_gdma_copy_started(void *pvDst, uint32_t u32DstPitch, uint32_t u32RowSize, uint32_t u32Rows)
+{
+    s_pvCopyDst = pvDst;
+    s_u32CopySize = u32RowSize;
+    s_u32CopyPitch = u32DstPitch;
+    s_u32CopyRows = u32Rows;
+    s_i32CopyState = 1;
+}
+#endif
+
+// Function to check the background copy, 1 while busy, 0 when done, negative on failure
+static int disp_gdma_copy_poll(void)
+{
+    /* A swap completes in GDMACH0_IRQHandler. */
+    if ((s_i32CopyState > 0) && !s_u32CopyIrq)
+    {
+        union dma350_ch_status_t status = dma350_ch_get_status(GDMA_CH_DEV_S[0]);
+
+        if (status.b.STAT_DONE)
+        {
+            uint32_t i;
+
+            GDMA_CH_DEV_S[0]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_DONE;
+
+            /* Drop lines the core may have speculatively fetched during the copy. */
+            for (i = 0; i < s_u32CopyRows; i++)
+                SCB_InvalidateDCache_by_Addr((uint8_t *)s_pvCopyDst + (i * s_u32CopyPitch), (int32_t)s_u32CopySize);
+
+            s_i32CopyState = 0;
+        }
+        else if (status.b.STAT_ERR)
+        {
+            GDMA_CH_DEV_S[0]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_ERR;
+            s_i32CopyState = -1;
+        }
+    }
+
+    return s_i32CopyState;
+}
+
+// Function to start a background copy on GDMA CH0, negative if it is busy
+static int disp_gdma_copy(void *pvDst, const void *pvSrc, uint32_t u32Size)
+{
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    /* CH0 prefetches lines for the scanout. */
+    (void)pvDst;
+    (void)pvSrc;
+    (void)u32Size;
+    return -1;
+#else
+
+    if (!pvDst || !pvSrc || !u32Size || (disp_gdma_copy_poll() > 0))
+        return -1;
+
+    disp_gdma_copy_cache(pvDst, u32Size, pvSrc, u32Size, u32Size, 1);
+
+    /* CH0 is idle outside the HyperRAM mode, poll it instead of taking its interrupt. */
+    if (dma350_memcpy(GDMA_CH_DEV_S[0], pvSrc, pvDst, u32Size, DMA350_LIB_EXEC_START_ONLY) != DMA350_LIB_ERR_NONE)
+        return -1;
+
+    disp_gdma_copy_started(pvDst, u32Size, u32Size, 1);
+
+    return 0;
+#endif
+}
+
+// Function to start a background copy of a rectangle of RGB565 pixels, pitches in pixels. Negative if no channel is free or the rectangle is too tall
+static int disp_gdma_copy_rect(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32Width, uint32_t u32Height)
+{
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    /* CH0 prefetches lines for the scanout. */
+    (void)pvDst;
+    (void)u32DstPitch;
+    (void)pvSrc;
+    (void)u32SrcPitch;
+    (void)u32Width;
+    (void)u32Height;
+    return -1;
+#else
+    uint32_t u32RowSize = u32Width * sizeof(uint16_t);
+
+    if (!pvDst || !pvSrc || !u32Width || !u32Height || (u32Height > UINT16_MAX) ||
+            (u32SrcPitch > UINT16_MAX) || (u32DstPitch > UINT16_MAX) || (disp_gdma_copy_poll() > 0))
+        return -1;
+
+    disp_gdma_copy_cache(pvDst, u32DstPitch * sizeof(uint16_t), pvSrc, u32SrcPitch * sizeof(uint16_t), u32RowSize, u32Height);
+
+    /* One 2D command, the Y strides walk both pitches. */
+    if (dma350_draw_from_canvas(GDMA_CH_DEV_S[0], pvSrc, pvDst,
+                                u32Width, (uint16_t)u32Height, (uint16_t)u32SrcPitch,
+                                u32Width, (uint16_t)u32Height, (uint16_t)u32DstPitch,
+                                DMA350_CH_TRANSIZE_16BITS, DMA350_LIB_TRANSFORM_NONE,
+                                DMA350_LIB_EXEC_START_ONLY) != DMA350_LIB_ERR_NONE)
+        return -1;
+
+    disp_gdma_copy_started(pvDst, u32DstPitch * sizeof(uint16_t), u32RowSize, u32Height);
+
+    return 0;
+#endif
+}
+
+// Function to start a background byte swap of RGB565 pixels between big- and little-endian order, negative if CH0 is busy
+static int disp_gdma_swap565(void *pvDst, const void *pvSrc, uint32_t u32Pixels, DispDmaDoneCb pfnDone, void *pvUser)
 {
-    return (void *)s_pu16BufAddr;
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    /* CH0 prefetches lines for the scanout. */
+    (void)pvDst;
+    (void)pvSrc;
+    (void)u32Pixels;
+    (void)pfnDone;
+    (void)pvUser;
+    return -1;
+#else
+    uint32_t u32Size = u32Pixels * sizeof(uint16_t);
+
+    if (!pvDst || !pvSrc || !u32Pixels || (u32Pixels > (CONFIG_TIMING_HACT * CONFIG_TIMING_VACT)) || (disp_gdma_copy_poll() > 0))
+        return -1;
+
+    disp_gdma_copy_cache(pvDst, u32Size, pvSrc, u32Size, u32Size, 1);
+
+    /* The interrupt may come before the start returns. */
+    s_pfnCopyDone = pfnDone;
+    s_pvCopyUser = pvUser;
+    s_u32CopyIrq = 1;
+    disp_gdma_copy_started(pvDst, u32Size, u32Size, 1);
+
+    /* One chain of 64K-pixel commands, a single done interrupt at the end. */
+    if (dma350_endian_swap_linked(GDMA_CH_DEV_S[0], pvSrc, pvDst, sizeof(uint16_t), u32Pixels,
+                                  s_au32SwapCmd, sizeof(s_au32SwapCmd) / sizeof(s_au32SwapCmd[0]),
+                                  DMA350_LIB_EXEC_IRQ) != DMA350_LIB_ERR_NONE)
+    {
+        dma350_ch_disable_intr(GDMA_CH_DEV_S[0], DMA350_CH_INTREN_DONE);
+        s_pfnCopyDone = NULL;
+        s_u32CopyIrq = 0;
+        s_i32CopyState = 0;
+        return -1;
+    }
+
+    return 0;
+#endif
 }
 
-// Function to set the blank event callback function
-void disp_set_blankcb(DispBlankCb f)
+// Function to get the scanout ring statistics
+static void disp_gdma_get_ringinfo(S_DISP_RINGINFO *psInfo)
 {
-    s_DispBlankCb = f;
+    *psInfo = s_sRingInfo;
 }
 
-COMPONENT_EXPORT("DISP_SYNC_GDMA", disp_sync_gdma_init, disp_sync_gdma_fini);
+const S_DISP_BACKEND g_sDispBackendGDMA =
+{
+    "GDMA",
+    disp_sync_gdma_init,
+    disp_sync_gdma_fini,
+    disp_gdma_flip,
+    disp_gdma_copy,
+    disp_gdma_copy_rect,
+    disp_gdma_copy_poll,
+    disp_gdma_swap565,
+    disp_gdma_get_ringinfo,
+    NULL,                       /* CH0 copies and CH1 scans out, no channel is left for a second panel. */
+    NULL
+};
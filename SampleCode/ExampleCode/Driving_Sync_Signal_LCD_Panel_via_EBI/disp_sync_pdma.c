@@ -8,12 +8,18 @@
 
 #include "pdma_lib.h"
 #include "disp.h"
+#include "disp_backend.h"
+#include "disp_panel.h"
+#include "disp_probe.h"
 #include "nu_bitutil.h"
+#include "nu_cyccnt.h"
 
 /*---------------------------------------------------------------------------*/
 /* Define                                                                    */
 /*---------------------------------------------------------------------------*/
 
+#define DEF_COPY_RECT_ROWS_MAX    64   /*!< Rows of a rectangle copy, one scatter-gather descriptor each */
+
 // Structure representing the H stage descriptor
 typedef struct
 {
@@ -29,51 +35,56 @@ typedef struct
     S_DSC_HLINE    m_dscV[DEF_TOTAL_VLINES];
 } S_DSC_LCD;
 
+_Static_assert(sizeof(S_DSC_LCD) / sizeof(DSCT_T) == DISP_PANEL_DSC_NUM, "The PDMA ring must hold one descriptor per stage of disp_panel.h.");
+_Static_assert(DISP_PANEL_XFER_MAX <= NU_PDMA_MAX_TXCNT, "A stage of this panel is longer than the transfer count of a PDMA descriptor.");
+
 /*---------------------------------------------------------------------------*/
 /* Global variables                                                          */
 /*---------------------------------------------------------------------------*/
 #if defined(NVT_NONCACHEABLE)
     NVT_NONCACHEABLE static S_DSC_LCD s_sDscLCD;
+    NVT_NONCACHEABLE static DSCT_T s_asCopyDsc[DEF_COPY_RECT_ROWS_MAX];
+#if defined(CONFIG_DISP_PANEL2)
+    NVT_NONCACHEABLE static S_DSC_LCD s_sDscLCD2;
+#endif
 #else
     static S_DSC_LCD s_sDscLCD;
+    static DSCT_T s_asCopyDsc[DEF_COPY_RECT_ROWS_MAX];
+#if defined(CONFIG_DISP_PANEL2)
+    static S_DSC_LCD s_sDscLCD2;
+#endif
 #endif
 
-uint8_t g_au8FrameBuf[CONFIG_VRAM_TOTAL_ALLOCATED_SIZE] __attribute__((aligned(DCACHE_LINE_SIZE))); // Declare VRAM instance.
 static uint32_t s_u32DummyData = 0xffffffff;
 static nu_pdma_desc_t s_head = (nu_pdma_desc_t) &s_sDscLCD;
 static nu_pdma_desc_t s_end = (nu_pdma_desc_t) &s_sDscLCD + (sizeof(s_sDscLCD) / sizeof(DSCT_T) - 1);
 static volatile uint16_t *s_pu16BufAddr = NULL;
-static DispBlankCb s_DispBlankCb = NULL;
-
-// Array of H timing values
-static const uint32_t s_au32HTiming[evHStageCNT] =
+static S_DISP_RINGINFO s_sRingInfo =
 {
-#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
-    DEF_HACT_INDEX,
-    CONFIG_TIMING_HACT
-#else
-    CONFIG_TIMING_HFP,
-    CONFIG_TIMING_HPW,
-    CONFIG_TIMING_HBP,
-    CONFIG_TIMING_HACT
-#endif
+    .m_szBackend    = "PDMA",
+    .m_u32DscNum    = DEF_PANEL_NUM * sizeof(S_DSC_LCD) / sizeof(DSCT_T),
+    .m_u32DscSize   = sizeof(DSCT_T),
+    .m_u32RingSize  = DEF_PANEL_NUM * sizeof(S_DSC_LCD),
+    .m_u32FetchSize = DEF_PANEL_NUM * sizeof(S_DSC_LCD),
 };
 
-// Array of V timing values
-static const uint32_t s_au32VTiming[evVStageCNT] =
-{
-#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
-    (CONFIG_TIMING_VFP + CONFIG_TIMING_VPW + CONFIG_TIMING_VBP),
-    CONFIG_TIMING_VACT
-#else
-    CONFIG_TIMING_VFP,
-    CONFIG_TIMING_VPW,
-    CONFIG_TIMING_VBP,
-    CONFIG_TIMING_VACT
+static int s_i32Channel = -1;
+
+#if defined(CONFIG_DISP_PANEL2)
+    static volatile uint16_t *s_pu16BufAddr2 = NULL;
+    static int s_i32Channel2 = -1;
 #endif
-};
 
-static int s_i32Channel = -1;
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+    static int s_i32PrefetchChannel = -1;
+#endif
+
+static int s_i32CopyChannel = -1;
+static volatile int s_i32CopyState = 0;     /*!< 1: busy, 0: idle, negative: failed */
+static void *s_pvCopyDst = NULL;
+static uint32_t s_u32CopySize = 0;          /*!< Bytes of one row */
+static uint32_t s_u32CopyPitch = 0;         /*!< Bytes between destination rows */
+static uint32_t s_u32CopyRows = 0;
 
 /*---------------------------------------------------------------------------*/
 /* Functions                                                                 */
@@ -95,30 +106,13 @@ static void disp_pdma_dsc_dump(void)
     } while (s_head != next);
 }
 
-// Function to get the current V stage based on the line index
-static E_VSTAGE get_current_vstage(int i32LineIdx)
-{
-    int sum = 0;
-    E_VSTAGE i;
-
-    for (i = 0; i < evVStageCNT; i++)
-    {
-        sum += s_au32VTiming[i];
-
-        if (i32LineIdx < sum)
-        {
-            return i;
-        }
-    }
-
-    return 0;
-}
-
 // Function to initialize the PDMA descriptors
 static void disp_pdma_dsc_init(void)
 {
     int i;
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
     uint16_t *pu16Buf = (uint16_t *)s_pu16BufAddr;
+#endif
     nu_pdma_desc_t next = s_head; // first descriptor.
 
 #if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
@@ -129,8 +123,8 @@ static void disp_pdma_dsc_init(void)
     nu_pdma_m2m_desc_setup(next,
                            16,
                            (uint32_t)&s_u32DummyData,
-                           CONFIG_DISP_EBI_ADDR,
-                           (CONFIG_TIMING_VFP + CONFIG_TIMING_VPW + CONFIG_TIMING_VBP) * (CONFIG_TIMING_HFP + CONFIG_TIMING_HPW + CONFIG_TIMING_HBP + CONFIG_TIMING_HACT),
+                           disp_panel_ebi_addr(evVStageVFP_VSYNC_VBP, evHStageHFP_HSYNC_HBP),
+                           DISP_PANEL_BLANK_XFER,
                            eMemCtl_SrcFix_DstFix,
                            next + 1,
                            1);
@@ -142,8 +136,8 @@ static void disp_pdma_dsc_init(void)
         nu_pdma_m2m_desc_setup(next,
                                16,
                                (uint32_t)&s_u32DummyData,
-                               CONFIG_DISP_EBI_ADDR,
-                               (CONFIG_TIMING_HFP + CONFIG_TIMING_HPW + CONFIG_TIMING_HBP),
+                               disp_panel_ebi_addr(evVStageVACT, evHStageHFP_HSYNC_HBP),
+                               disp_panel_hstage_xfer(evHStageHFP_HSYNC_HBP),
                                eMemCtl_SrcFix_DstFix,
                                next + 1,
                                1);
@@ -152,12 +146,21 @@ static void disp_pdma_dsc_init(void)
         /* Backend descriptor */
         nu_pdma_m2m_desc_setup(next,
                                16,
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+                               (uint32_t)disp_prefetch_get_linebuf(i),
+#else
                                (uint32_t)&pu16Buf[i * CONFIG_TIMING_HACT],
-                               CONFIG_DISP_EBI_ADDR + CONFIG_DISP_DE_ACTIVE,
-                               CONFIG_TIMING_HACT,
+#endif
+                               disp_panel_ebi_addr(evVStageVACT, evHStageHACT),
+                               disp_panel_hstage_xfer(evHStageHACT),
                                eMemCtl_SrcInc_DstFix,
                                next + 1,
                                1);
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+        /* Raise a line-interrupt to pace the prefetcher. */
+        next->CTL &= ~PDMA_DSCT_CTL_TBINTDIS_Msk;
+#endif
         next++;
 
     } // for(i = 0; i < CONFIG_TIMING_VACT; i++)
@@ -167,67 +170,42 @@ static void disp_pdma_dsc_init(void)
     for (i = 0; i < DEF_TOTAL_VLINES; i++)
     {
         E_HSTAGE evH;
-        E_VSTAGE evV = get_current_vstage(i);
+        E_VSTAGE evV = disp_panel_vstage(i);
 
-        /* Set each VSYNC lines. */
+        /* Set each H stage of the line, the destination address drives the sync levels of disp_panel.h. */
         for (evH = 0; evH < evHStageCNT; evH++)
         {
             uint32_t u32AddrSrc = (uint32_t)&s_u32DummyData;
-            uint32_t u32AddrDst;
-            uint32_t u32DataWidth = 16;
-            uint32_t u32XferCount = s_au32HTiming[evH];
-            nu_pdma_memctrl_t evMemCtrl = eMemCtl_SrcFix_DstFix;
+            int i32Active = disp_panel_is_active(evV, evH);
 
-            switch (evV)
+            /* The active stage increments its source through the VRAM line, the others repeat the blank word. */
+            if (i32Active)
             {
-                case evVStageVSYNC:
-                    /* Set each H stage in a VSYNC line. */
-                    /* Set source memory address is fixed and destination memory address is fixed. */
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_VSYNC_ACTIVE + CONFIG_DISP_HSYNC_ACTIVE) :
-                                 (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_VSYNC_ACTIVE);
-                    break;
-
-                case evVStageVBP:
-                    /* Set each H stage in a VBP line. */
-                    /* Set source memory address is fixed and destination memory address is fixed. */
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_HSYNC_ACTIVE) : (CONFIG_DISP_EBI_ADDR);
-                    break;
-
-                case evVStageVACT:
-
-                    /* Set each H stage in a VACT line. */
-                    /* evHStageHACT stage: Set source memory address is incremented and destination memory address is fixed. */
-                    /* Others stage: Set source memory address is fixed and destination memory address is fixed. */
-                    if (evH == evHStageHACT)
-                    {
-                        u32AddrSrc = (uint32_t)pu16Buf;
-                        pu16Buf = pu16Buf + CONFIG_TIMING_HACT;
-                    }
-
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_HSYNC_ACTIVE) :
-                                 (evH == evHStageHACT) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_DE_ACTIVE) :
-                                 (CONFIG_DISP_EBI_ADDR);
-                    evMemCtrl = (evH == evHStageHACT) ? eMemCtl_SrcInc_DstFix : eMemCtl_SrcFix_DstFix;
-                    break;
-
-                case evVStageVFP:
-                    /* Set each H stage in a VFP line. */
-                    /* Set source memory address is fixed and destination memory address is fixed. */
-                    u32AddrDst = (evH == evHStageHSYNC) ? (CONFIG_DISP_EBI_ADDR + CONFIG_DISP_HSYNC_ACTIVE) : (CONFIG_DISP_EBI_ADDR);
-                    break;
-
-                default:
-                    break;
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+                /* Scan out of the SRAM line buffers, the prefetcher fills them from VRAM. */
+                u32AddrSrc = (uint32_t)disp_prefetch_get_linebuf(i - DEF_VACT_INDEX);
+#else
+                u32AddrSrc = (uint32_t)pu16Buf;
+                pu16Buf = pu16Buf + CONFIG_TIMING_HACT;
+#endif
             }
 
             nu_pdma_m2m_desc_setup(next,
-                                   u32DataWidth,
+                                   16,
                                    u32AddrSrc,
-                                   u32AddrDst,
-                                   u32XferCount,
-                                   evMemCtrl,
+                                   disp_panel_ebi_addr(evV, evH),
+                                   disp_panel_hstage_xfer(evH),
+                                   i32Active ? eMemCtl_SrcInc_DstFix : eMemCtl_SrcFix_DstFix,
                                    next + 1,
                                    1);
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+            /* Raise a line-interrupt to pace the prefetcher. */
+            if (i32Active)
+                next->CTL &= ~PDMA_DSCT_CTL_TBINTDIS_Msk;
+
+#endif
             next++;
 
         } // for (evH = 0; evH < evHStageCNT; evH++)
@@ -243,31 +221,160 @@ static void disp_pdma_dsc_init(void)
     s_end->CTL &= ~PDMA_DSCT_CTL_TBINTDIS_Msk;
 }
 
+#if defined(CONFIG_DISP_PANEL2)
+
+// Function to initialize the descriptors of the second panel from the ring of the first
+static void disp_pdma_dsc2_init(void)
+{
+    const DSCT_T *psSrc = (const DSCT_T *)&s_sDscLCD;
+    DSCT_T *psDst = (DSCT_T *)&s_sDscLCD2;
+    int i;
+
+    for (i = 0; i < DISP_PANEL_DSC_NUM; i++)
+    {
+        /* Same stages and interrupts, written to the other bank and linked within this ring. */
+        psDst[i] = psSrc[i];
+        psDst[i].DA += DISP_PANEL2_EBI_OFFSET;
+        psDst[i].NEXT = psSrc[i].NEXT - (uint32_t)&s_sDscLCD + (uint32_t)&s_sDscLCD2;
+
+        /* The active stages scan the VRAM of the second panel, the others keep the blank word. */
+        if (psSrc[i].SA != (uint32_t)&s_u32DummyData)
+            psDst[i].SA = psSrc[i].SA - (uint32_t)s_pu16BufAddr + (uint32_t)s_pu16BufAddr2;
+    }
+}
+
+#endif
+
+#if !defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+// Function to point the active stages of a ring at another VRAM buffer if it changed
+static void disp_pdma_dsc_flip(S_DSC_LCD *psDsc, volatile uint16_t *pu16BufAddr)
+{
+    if (psDsc->m_dscV[DEF_VACT_INDEX].m_dscH[evHStageHACT].SA != (uint32_t)pu16BufAddr)
+    {
+        // Switch new VRAM buffer address.
+        int i;
+        uint32_t u32Start = nu_cyccnt_get();
+
+        for (i = 0; i < CONFIG_TIMING_VACT; i++)
+        {
+            /* Update every lines. */
+            psDsc->m_dscV[DEF_VACT_INDEX + i].m_dscH[evHStageHACT].SA = (uint32_t)&pu16BufAddr[i * CONFIG_TIMING_HACT];
+        }
+
+        s_sRingInfo.m_u32FlipCycles = nu_cyccnt_get() - u32Start;
+
+        if (s_sRingInfo.m_u32FlipCycles > s_sRingInfo.m_u32FlipMaxCycles)
+            s_sRingInfo.m_u32FlipMaxCycles = s_sRingInfo.m_u32FlipCycles;
+    }
+}
+
+#endif
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+// Function to get the index of the descriptor the scanout channel is on
+static uint32_t disp_pdma_dsc_index(void)
+{
+    PDMA_T *pdma = (s_i32Channel < PDMA_CH_MAX) ? PDMA0 : PDMA1;
+
+    return (pdma->CURSCAT[s_i32Channel % PDMA_CH_MAX] - (uint32_t)s_head) / sizeof(DSCT_T);
+}
+
+// Function to copy one line from VRAM into a line buffer
+static int disp_pdma_prefetch_copy(void *pvDst, const void *pvSrc, uint32_t u32Size)
+{
+    /* Word beats when the line allows it, HyperRAM bursts cost the same per beat. */
+    if (((uint32_t)pvSrc | (uint32_t)pvDst | u32Size) & 0x3)
+        return nu_pdma_transfer(s_i32PrefetchChannel, 16, (uint32_t)pvSrc, (uint32_t)pvDst, u32Size / sizeof(uint16_t), 0);
+
+    return nu_pdma_transfer(s_i32PrefetchChannel, 32, (uint32_t)pvSrc, (uint32_t)pvDst, u32Size / sizeof(uint32_t), 0);
+}
+
+// Callback function for the line copy completion
+static void nu_pdma_prefetch_cb(void *pvUserData, uint32_t u32Events)
+{
+    if (u32Events & NU_PDMA_EVENT_TRANSFER_DONE)
+        disp_prefetch_copy_done();
+}
+
+#endif
+
 // Callback function for PDMA transfer completion
 static void nu_pdma_memfun_cb(void *pvUserData, uint32_t u32Events)
 {
     if ((u32Events == NU_PDMA_EVENT_TRANSFER_DONE))
     {
-        if (s_sDscLCD.m_dscV[DEF_VACT_INDEX].m_dscH[evHStageHACT].SA != (uint32_t)s_pu16BufAddr)
-        {
-            // Switch new VRAM buffer address.
-            int i;
+        uint32_t u32IsrStart = nu_cyccnt_get();
+        DispBlankCb pfnBlankCb;
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+        uint32_t u32Start;
+#endif
 
-            for (i = 0; i < s_au32VTiming[evVStageVACT]; i++)
-            {
-                /* Update every lines. */
-                s_sDscLCD.m_dscV[DEF_VACT_INDEX + i].m_dscH[evHStageHACT].SA = (uint32_t)&s_pu16BufAddr[i * CONFIG_TIMING_HACT];
-            }
+        disp_probe_begin(evDispProbePdmaIsr);
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+        /* Line-interrupts only advance the prefetcher, the last line ends the frame. */
+        if (disp_prefetch_scanline(disp_pdma_dsc_index()) < CONFIG_TIMING_VACT)
+        {
+            disp_probe_end(evDispProbePdmaIsr);
+            disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
+            return;
         }
-        else
+
+        /* The ring always scans the line buffers, switch the prefetch source instead. */
+        u32Start = nu_cyccnt_get();
+        disp_prefetch_frame((const uint16_t *)s_pu16BufAddr);
+        s_sRingInfo.m_u32FlipCycles = nu_cyccnt_get() - u32Start;
+
+        if (s_sRingInfo.m_u32FlipCycles > s_sRingInfo.m_u32FlipMaxCycles)
+            s_sRingInfo.m_u32FlipMaxCycles = s_sRingInfo.m_u32FlipCycles;
+
+#else
+
+        disp_pdma_dsc_flip(&s_sDscLCD, s_pu16BufAddr);
+
+#endif
+
+        s_sRingInfo.m_u32BlankStamp = nu_cyccnt_get();
+        s_sRingInfo.m_u32BlankCount++;
+
+        pfnBlankCb = disp_get_blankcb();
+
+        if (pfnBlankCb)
         {
+            disp_probe_begin(evDispProbeBlankCb);
+            pfnBlankCb((void *)s_pu16BufAddr);
+            disp_probe_end(evDispProbeBlankCb);
         }
 
-        if (s_DispBlankCb)
-            s_DispBlankCb((void *)s_pu16BufAddr);
+        disp_probe_end(evDispProbePdmaIsr);
+        disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
     }
 }
 
+#if defined(CONFIG_DISP_PANEL2)
+
+// Callback function for the blank of the second panel, the first panel alone paces the blank callback
+static void nu_pdma_panel2_cb(void *pvUserData, uint32_t u32Events)
+{
+    if ((u32Events == NU_PDMA_EVENT_TRANSFER_DONE))
+    {
+        uint32_t u32IsrStart = nu_cyccnt_get();
+
+#if CONFIG_DISP_PANEL2_MIRROR
+        disp_pdma_dsc_flip(&s_sDscLCD2, s_pu16BufAddr);
+#else
+        disp_pdma_dsc_flip(&s_sDscLCD2, s_pu16BufAddr2);
+#endif
+
+        disp_backend_isr_done(&s_sRingInfo, u32IsrStart);
+    }
+}
+
+#endif
+
 // Function to initialize the PDMA module
 static void pdma_init(void)
 {
@@ -312,13 +419,15 @@ static void pdma_fini(void)
         SYS_LockReg();
 }
 
-// Function to initialize the EBI sync PDMA
-static int disp_sync_pdma_init(void)
+// Function to initialize the EBI sync PDMA and start the scanout on a buffer
+static int disp_sync_pdma_init(void *pvBufAddr)
 {
     struct nu_pdma_chn_cb sChnCB;
 
-    /* Set the VRAM address by default. */
-    s_pu16BufAddr = (uint16_t *)g_au8FrameBuf;
+    s_pu16BufAddr = (volatile uint16_t *)pvBufAddr;
+#if defined(CONFIG_DISP_PANEL2)
+    s_pu16BufAddr2 = (volatile uint16_t *)disp_panel2_get_vrambufaddr();
+#endif
 
     pdma_init();
 
@@ -332,7 +441,15 @@ static int disp_sync_pdma_init(void)
     }
 
     /* Initial all Lines descriptor-link. */
+    nu_cyccnt_init();
+    disp_probe_begin(evDispProbeRingBuild);
+    s_sRingInfo.m_u32BuildCycles = nu_cyccnt_get();
     disp_pdma_dsc_init();
+#if defined(CONFIG_DISP_PANEL2)
+    disp_pdma_dsc2_init();
+#endif
+    s_sRingInfo.m_u32BuildCycles = nu_cyccnt_get() - s_sRingInfo.m_u32BuildCycles;
+    disp_probe_end(evDispProbeRingBuild);
 
     /* Dump all Lines descriptor-link. */
     // disp_pdma_dsc_dump();
@@ -345,6 +462,53 @@ static int disp_sync_pdma_init(void)
     nu_pdma_filtering_set(s_i32Channel, NU_PDMA_EVENT_TRANSFER_DONE);
     nu_pdma_callback_register(s_i32Channel, &sChnCB);
 
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+    if (s_i32PrefetchChannel < 0)
+    {
+        /* Allocate a second PDMA channel to copy lines out of HyperRAM. */
+        s_i32PrefetchChannel = nu_pdma_channel_allocate(PDMA_MEM);
+
+        if (s_i32PrefetchChannel < 0)
+            return -1;
+    }
+
+    sChnCB.m_eCBType = eCBType_Event;
+    sChnCB.m_pfnCBHandler = nu_pdma_prefetch_cb;
+    sChnCB.m_pvUserData = (void *)NULL;
+
+    nu_pdma_filtering_set(s_i32PrefetchChannel, NU_PDMA_EVENT_TRANSFER_DONE);
+    nu_pdma_callback_register(s_i32PrefetchChannel, &sChnCB);
+
+    /* Fill the first line buffers before the ring reaches line 0. */
+    disp_prefetch_init(disp_pdma_prefetch_copy);
+    disp_prefetch_frame((const uint16_t *)s_pu16BufAddr);
+
+#endif
+
+#if defined(CONFIG_DISP_PANEL2)
+
+    if (s_i32Channel2 < 0)
+    {
+        /* Allocate a channel for the ring of the second panel, both rings share the EBI burst by burst. */
+        s_i32Channel2 = nu_pdma_channel_allocate(PDMA_MEM);
+
+        if (s_i32Channel2 < 0)
+            return -1;
+    }
+
+    sChnCB.m_eCBType = eCBType_Event;
+    sChnCB.m_pfnCBHandler = nu_pdma_panel2_cb;
+    sChnCB.m_pvUserData = (void *)NULL;
+
+    nu_pdma_filtering_set(s_i32Channel2, NU_PDMA_EVENT_TRANSFER_DONE);
+    nu_pdma_callback_register(s_i32Channel2, &sChnCB);
+
+    if (nu_pdma_sg_transfer(s_i32Channel2, (nu_pdma_desc_t)&s_sDscLCD2, 0) < 0)
+        return -1;
+
+#endif
+
     /* Trigger scatter-gather transferring. */
     return nu_pdma_sg_transfer(s_i32Channel, s_head, 0);
 }
@@ -360,27 +524,223 @@ static int disp_sync_pdma_fini(void)
         s_i32Channel = -1;
     }
 
+#if defined(CONFIG_DISP_PANEL2)
+
+    if (s_i32Channel2 >= 0)
+    {
+        /* Free the channel of the second panel. */
+        nu_pdma_channel_free(s_i32Channel2);
+
+        s_i32Channel2 = -1;
+    }
+
+#endif
+
+    if (s_i32CopyChannel >= 0)
+    {
+        /* Free the background copy channel. */
+        nu_pdma_channel_free(s_i32CopyChannel);
+
+        s_i32CopyChannel = -1;
+        s_i32CopyState = 0;
+    }
+
+#if defined(CONFIG_DISP_VRAM_IN_HYPERRAM)
+
+    if (s_i32PrefetchChannel >= 0)
+    {
+        /* Free the line copy channel. */
+        nu_pdma_channel_free(s_i32PrefetchChannel);
+
+        s_i32PrefetchChannel = -1;
+    }
+
+#endif
+
     pdma_fini();
 
     return 0;
 }
 
-// Function to set the VRAM buffer address
-void disp_set_vrambufaddr(void *pvBufAddr)
+// Function to scan out another VRAM buffer from the next blank
+static void disp_pdma_flip(void *pvBufAddr)
 {
     s_pu16BufAddr = (volatile uint16_t *)pvBufAddr;
 }
 
-// Function to get the VRAM buffer address
-void *disp_get_vrambufaddr(void)
+#if defined(CONFIG_DISP_PANEL2)
+
+// Function to scan out another VRAM buffer on the second panel from its next blank
+static void disp_pdma_flip2(void *pvBufAddr)
 {
-    return (void *)s_pu16BufAddr;
+    s_pu16BufAddr2 = (volatile uint16_t *)pvBufAddr;
 }
 
-// Function to set the blank callback function
-void disp_set_blankcb(DispBlankCb f)
+#endif
+
+// Callback function for the background copy completion
+static void nu_pdma_copy_cb(void *pvUserData, uint32_t u32Events)
 {
-    s_DispBlankCb = f;
+    s_i32CopyState = (u32Events & NU_PDMA_EVENT_TRANSFER_DONE) ? 0 : -1;
 }
 
-COMPONENT_EXPORT("DISP_SYNC_PDMA", disp_sync_pdma_init, disp_sync_pdma_fini);
+// Function to allocate the background copy channel on first use, the scanout channel stays untouched
+static int disp_pdma_copy_channel(void)
+{
+    struct nu_pdma_chn_cb sChnCB;
+
+    if (s_i32CopyChannel >= 0)
+        return 0;
+
+    s_i32CopyChannel = nu_pdma_channel_allocate(PDMA_MEM);
+
+    if (s_i32CopyChannel < 0)
+        return -1;
+
+    sChnCB.m_eCBType = eCBType_Event;
+    sChnCB.m_pfnCBHandler = nu_pdma_copy_cb;
+    sChnCB.m_pvUserData = (void *)NULL;
+
+    nu_pdma_filtering_set(s_i32CopyChannel, NU_PDMA_EVENT_TRANSFER_DONE | NU_PDMA_EVENT_ABORT);
+    nu_pdma_callback_register(s_i32CopyChannel, &sChnCB);
+
+    return 0;
+}
+
+// Function to prepare the D-cache for a background copy of rows and record them for disp_pdma_copy_poll()
+static void disp_pdma_copy_begin(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32RowSize, uint32_t u32Rows)
+{
+    uint32_t i;
+
+    /* The DMA reads memory, not the D-cache, and the destination must not keep lines to write back over it. */
+    for (i = 0; i < u32Rows; i++)
+    {
+        SCB_CleanDCache_by_Addr((uint8_t *)pvSrc + (i * u32SrcPitch), (int32_t)u32RowSize);
+        SCB_CleanInvalidateDCache_by_Addr((uint8_t *)pvDst + (i * u32DstPitch), (int32_t)u32RowSize);
+    }
+
+    s_pvCopyDst = pvDst;
+    s_u32CopySize = u32RowSize;
+    s_u32CopyPitch = u32DstPitch;
+    s_u32CopyRows = u32Rows;
+    s_i32CopyState = 1;
+}
+
+// Function to start a background copy on the spare PDMA channel, negative if none is free
+static int disp_pdma_copy(void *pvDst, const void *pvSrc, uint32_t u32Size)
+{
+    if (!pvDst || !pvSrc || !u32Size || (s_i32CopyState > 0) || (disp_pdma_copy_channel() < 0))
+        return -1;
+
+    disp_pdma_copy_begin(pvDst, u32Size, pvSrc, u32Size, u32Size, 1);
+
+    if (nu_pdma_transfer(s_i32CopyChannel,
+                         (((uint32_t)pvSrc | (uint32_t)pvDst | u32Size) & 0x3) ? 8 : 32,
+                         (uint32_t)pvSrc,
+                         (uint32_t)pvDst,
+                         (((uint32_t)pvSrc | (uint32_t)pvDst | u32Size) & 0x3) ? u32Size : (u32Size / sizeof(uint32_t)),
+                         0) < 0)
+    {
+        s_i32CopyState = 0;
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to start a background copy of a rectangle of RGB565 pixels, pitches in pixels. Negative if no channel is free or the rectangle is too tall
+static int disp_pdma_copy_rect(void *pvDst, uint32_t u32DstPitch, const void *pvSrc, uint32_t u32SrcPitch, uint32_t u32Width, uint32_t u32Height)
+{
+    uint32_t u32RowSize = u32Width * sizeof(uint16_t);
+    uint32_t u32DataWidth, i;
+
+    if (!pvDst || !pvSrc || !u32Width || !u32Height || (u32Height > DEF_COPY_RECT_ROWS_MAX) ||
+            (s_i32CopyState > 0) || (disp_pdma_copy_channel() < 0))
+        return -1;
+
+    /* This PDMA has no stride registers, each row is a scatter-gather descriptor. Words when every row allows them. */
+    u32DataWidth = (((uint32_t)pvSrc | (uint32_t)pvDst | (u32SrcPitch * sizeof(uint16_t)) | (u32DstPitch * sizeof(uint16_t)) | u32RowSize) & 0x3) ? 16 : 32;
+
+    for (i = 0; i < u32Height; i++)
+    {
+        if (nu_pdma_m2m_desc_setup(&s_asCopyDsc[i],
+                                   u32DataWidth,
+                                   (uint32_t)pvSrc + (i * u32SrcPitch * sizeof(uint16_t)),
+                                   (uint32_t)pvDst + (i * u32DstPitch * sizeof(uint16_t)),
+                                   u32RowSize / (u32DataWidth / 8),
+                                   eMemCtl_SrcInc_DstInc,
+                                   ((i + 1) == u32Height) ? NULL : &s_asCopyDsc[i + 1],
+                                   ((i + 1) == u32Height) ? 0 : 1) < 0)
+            return -1;
+    }
+
+    SCB_CleanDCache_by_Addr(s_asCopyDsc, (int32_t)(u32Height * sizeof(DSCT_T)));
+
+    disp_pdma_copy_begin(pvDst, u32DstPitch * sizeof(uint16_t), pvSrc, u32SrcPitch * sizeof(uint16_t), u32RowSize, u32Height);
+
+    if (nu_pdma_sg_transfer(s_i32CopyChannel, &s_asCopyDsc[0], 0) < 0)
+    {
+        s_i32CopyState = 0;
+        s_pvCopyDst = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to start a background byte swap of RGB565 pixels, the PDMA cannot swap
+static int disp_pdma_swap565(void *pvDst, const void *pvSrc, uint32_t u32Pixels, DispDmaDoneCb pfnDone, void *pvUser)
+{
+    /* The PDMA moves whole beats and cannot swap the bytes inside one. */
+    (void)pvDst;
+    (void)pvSrc;
+    (void)u32Pixels;
+    (void)pfnDone;
+    (void)pvUser;
+
+    return -1;
+}
+
+// Function to check the background copy, 1 while busy, 0 when done, negative on failure
+static int disp_pdma_copy_poll(void)
+{
+    int i32State = s_i32CopyState;
+
+    if ((i32State == 0) && s_pvCopyDst)
+    {
+        uint32_t i;
+
+        /* Drop lines the core may have speculatively fetched during the copy. */
+        for (i = 0; i < s_u32CopyRows; i++)
+            SCB_InvalidateDCache_by_Addr((uint8_t *)s_pvCopyDst + (i * s_u32CopyPitch), (int32_t)s_u32CopySize);
+
+        s_pvCopyDst = NULL;
+    }
+
+    return i32State;
+}
+
+// Function to get the scanout ring statistics
+static void disp_pdma_get_ringinfo(S_DISP_RINGINFO *psInfo)
+{
+    *psInfo = s_sRingInfo;
+}
+
+const S_DISP_BACKEND g_sDispBackendPDMA =
+{
+    "PDMA",
+    disp_sync_pdma_init,
+    disp_sync_pdma_fini,
+    disp_pdma_flip,
+    disp_pdma_copy,
+    disp_pdma_copy_rect,
+    disp_pdma_copy_poll,
+    disp_pdma_swap565,
+    disp_pdma_get_ringinfo,
+#if defined(CONFIG_DISP_PANEL2)
+    disp_pdma_flip2,
+#else
+    NULL,
+#endif
+    NULL
+};
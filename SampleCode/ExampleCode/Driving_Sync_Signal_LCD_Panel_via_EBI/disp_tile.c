@@ -0,0 +1,438 @@
+/**************************************************************************//**
+ * @file     disp_tile.c
+ * @brief    Tile renderer. Dirty tiles are rendered in row order, each one
+ *           replays the recorded commands clipped to it, starting from the
+ *           last one that covers the tile with opaque pixels. A tile with no
+ *           such command is loaded from the back buffer first, so blends and
+ *           uncovered pixels see what evDispTileDirect mode would see. Two
+ *           scratch tiles live in DTCM: in evDispTileOverlap mode one is
+ *           rendered while the other is pushed by disp_dma_copy_rect(). A
+ *           push the DMA refuses, because the copy channel is busy or absent,
+ *           is done by the CPU from the same scratch tile.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "disp_tile.h"
+#include "disp_probe.h"
+#include "nu_cyccnt.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_TILE_PIXELS     (CONFIG_DISP_TILE_W * CONFIG_DISP_TILE_H)
+
+#if (CONFIG_DISP_TILE_H > 64)
+    #error "CONFIG_DISP_TILE_H is limited by the rows of the PDMA rectangle copy."
+#endif
+
+// Tile being pushed to the back buffer
+typedef struct
+{
+    const uint16_t *m_pu16Src;    /*!< Scratch tile, NULL when nothing is in flight */
+    uint16_t       *m_pu16Dst;
+    uint32_t        m_u32W;
+    uint32_t        m_u32H;
+    int             m_bDma;
+} S_TILE_PUSH;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+#if defined(NVT_DTCM)
+    NVT_DTCM static uint16_t s_au16Scratch[2][DEF_TILE_PIXELS] __attribute__((aligned(DCACHE_LINE_SIZE)));
+#else
+    static uint16_t s_au16Scratch[2][DEF_TILE_PIXELS] __attribute__((aligned(DCACHE_LINE_SIZE)));
+#endif
+
+static S_TILE_PUSH s_sPush;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to clip a rectangle to the panel, returns 0 if nothing is left
+static int tile_clip(S_DISP_RECT *psOut, int i32X, int i32Y, int i32W, int i32H)
+{
+    if (i32X < 0)
+    {
+        i32W += i32X;
+        i32X = 0;
+    }
+
+    if (i32Y < 0)
+    {
+        i32H += i32Y;
+        i32Y = 0;
+    }
+
+    if ((i32X + i32W) > CONFIG_TIMING_HACT)
+        i32W = CONFIG_TIMING_HACT - i32X;
+
+    if ((i32Y + i32H) > CONFIG_TIMING_VACT)
+        i32H = CONFIG_TIMING_VACT - i32Y;
+
+    if ((i32W <= 0) || (i32H <= 0))
+        return 0;
+
+    psOut->m_u16X = (uint16_t)i32X;
+    psOut->m_u16Y = (uint16_t)i32Y;
+    psOut->m_u16W = (uint16_t)i32W;
+    psOut->m_u16H = (uint16_t)i32H;
+
+    return 1;
+}
+
+// Function to get the next free command, clipped to the panel. NULL if the table is full or nothing is visible
+static S_DISP_TILE_CMD *tile_cmd_new(S_DISP_TILE *psTile, E_DISP_TILE_CMD evCmd, int *pi32X, int *pi32Y, int i32W, int i32H, int *pi32Ret)
+{
+    S_DISP_TILE_CMD *psCmd;
+
+    *pi32Ret = -1;
+
+    if (psTile->m_u32CmdNum >= CONFIG_DISP_TILE_CMDS)
+        return NULL;
+
+    psCmd = &psTile->m_asCmd[psTile->m_u32CmdNum];
+    *pi32Ret = 0;
+
+    if (!tile_clip(&psCmd->m_sRect, *pi32X, *pi32Y, i32W, i32H))
+        return NULL;
+
+    /* Offset of the clipped origin, for the blit source. */
+    *pi32X = psCmd->m_sRect.m_u16X - *pi32X;
+    *pi32Y = psCmd->m_sRect.m_u16Y - *pi32Y;
+
+    psCmd->m_evCmd = evCmd;
+    psTile->m_u32CmdNum++;
+
+    return psCmd;
+}
+
+// Function to blend one RGB565 pixel, 0 to 32 alpha
+static uint16_t tile_blend565(uint16_t u16Dst, uint32_t u32Src, uint32_t u32Alpha)
+{
+    /* Green in the high half, red and blue in the low half, each with headroom for the product. */
+    uint32_t u32D = ((uint32_t)u16Dst | ((uint32_t)u16Dst << 16)) & 0x07E0F81FUL;
+    uint32_t u32R = (((u32Src * u32Alpha) + (u32D * (32 - u32Alpha))) >> 5) & 0x07E0F81FUL;
+
+    return (uint16_t)(u32R | (u32R >> 16));
+}
+
+// Function to find the last opaque command covering a whole area, negative if the pixels below show through
+static int tile_opaque_base(const S_DISP_TILE *psTile, const S_DISP_RECT *psArea)
+{
+    int i;
+
+    for (i = (int)psTile->m_u32CmdNum - 1; i >= 0; i--)
+    {
+        const S_DISP_TILE_CMD *psCmd = &psTile->m_asCmd[i];
+
+        if (psCmd->m_evCmd == evDispTileCmdBlend)
+            continue;
+
+        if ((psCmd->m_sRect.m_u16X <= psArea->m_u16X) &&
+                (psCmd->m_sRect.m_u16Y <= psArea->m_u16Y) &&
+                ((psCmd->m_sRect.m_u16X + psCmd->m_sRect.m_u16W) >= (psArea->m_u16X + psArea->m_u16W)) &&
+                ((psCmd->m_sRect.m_u16Y + psCmd->m_sRect.m_u16H) >= (psArea->m_u16Y + psArea->m_u16H)))
+            return i;
+    }
+
+    return -1;
+}
+
+// Function to load an area of the back buffer into a scratch tile with the CPU
+static void tile_load(const uint16_t *pu16Src, uint16_t *pu16Scratch, const S_DISP_RECT *psArea)
+{
+    uint32_t y;
+
+    /* Pushes of the other tiles invalidate their lines once done, the cached back buffer is current. */
+    for (y = 0; y < psArea->m_u16H; y++)
+        memcpy(&pu16Scratch[y * CONFIG_DISP_TILE_W], &pu16Src[y * CONFIG_TIMING_HACT], psArea->m_u16W * sizeof(uint16_t));
+}
+
+// Function to replay the commands from u32First over an area of the panel into a buffer with a pitch in pixels
+static void tile_replay(const S_DISP_TILE *psTile, uint32_t u32First, const S_DISP_RECT *psArea, uint16_t *pu16Buf, uint32_t u32Pitch)
+{
+    uint32_t i;
+
+    for (i = u32First; i < psTile->m_u32CmdNum; i++)
+    {
+        const S_DISP_TILE_CMD *psCmd = &psTile->m_asCmd[i];
+        int i32X0 = (psCmd->m_sRect.m_u16X > psArea->m_u16X) ? psCmd->m_sRect.m_u16X : psArea->m_u16X;
+        int i32Y0 = (psCmd->m_sRect.m_u16Y > psArea->m_u16Y) ? psCmd->m_sRect.m_u16Y : psArea->m_u16Y;
+        int i32X1 = ((psCmd->m_sRect.m_u16X + psCmd->m_sRect.m_u16W) < (psArea->m_u16X + psArea->m_u16W)) ?
+                    (psCmd->m_sRect.m_u16X + psCmd->m_sRect.m_u16W) : (psArea->m_u16X + psArea->m_u16W);
+        int i32Y1 = ((psCmd->m_sRect.m_u16Y + psCmd->m_sRect.m_u16H) < (psArea->m_u16Y + psArea->m_u16H)) ?
+                    (psCmd->m_sRect.m_u16Y + psCmd->m_sRect.m_u16H) : (psArea->m_u16Y + psArea->m_u16H);
+        int i32W = i32X1 - i32X0;
+        int x, y;
+
+        if ((i32W <= 0) || (i32Y1 <= i32Y0))
+            continue;
+
+        for (y = i32Y0; y < i32Y1; y++)
+        {
+            uint16_t *pu16Row = &pu16Buf[(uint32_t)(y - psArea->m_u16Y) * u32Pitch + (uint32_t)(i32X0 - psArea->m_u16X)];
+
+            switch (psCmd->m_evCmd)
+            {
+                case evDispTileCmdFill:
+                    for (x = 0; x < i32W; x++)
+                        pu16Row[x] = psCmd->m_u16Color;
+
+                    break;
+
+                case evDispTileCmdBlend:
+                {
+                    uint32_t u32Src = ((uint32_t)psCmd->m_u16Color | ((uint32_t)psCmd->m_u16Color << 16)) & 0x07E0F81FUL;
+                    uint32_t u32Alpha = ((uint32_t)psCmd->m_u16Alpha + 4) >> 3;
+
+                    for (x = 0; x < i32W; x++)
+                        pu16Row[x] = tile_blend565(pu16Row[x], u32Src, u32Alpha);
+
+                    break;
+                }
+
+                case evDispTileCmdBlit:
+                    memcpy(pu16Row,
+                           &psCmd->m_pu16Src[(uint32_t)(y - psCmd->m_sRect.m_u16Y) * psCmd->m_u32SrcPitch + (uint32_t)(i32X0 - psCmd->m_sRect.m_u16X)],
+                           (uint32_t)i32W * sizeof(uint16_t));
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+// Function to copy a scratch tile into the back buffer with the CPU
+static void tile_push_cpu(const S_TILE_PUSH *psPush)
+{
+    uint32_t y;
+
+    for (y = 0; y < psPush->m_u32H; y++)
+    {
+        uint16_t *pu16Dst = &psPush->m_pu16Dst[y * CONFIG_TIMING_HACT];
+
+        memcpy(pu16Dst, &psPush->m_pu16Src[y * CONFIG_DISP_TILE_W], psPush->m_u32W * sizeof(uint16_t));
+        SCB_CleanDCache_by_Addr(pu16Dst, (int32_t)(psPush->m_u32W * sizeof(uint16_t)));
+    }
+}
+
+// Function to wait for the tile in flight, its scratch tile is free afterwards
+static void tile_push_wait(S_DISP_TILE *psTile)
+{
+    uint32_t u32Start;
+    int i32Ret;
+
+    if (!s_sPush.m_pu16Src)
+        return;
+
+    if (s_sPush.m_bDma)
+    {
+        u32Start = nu_cyccnt_get();
+
+        while ((i32Ret = disp_dma_copy_poll()) > 0);
+
+        psTile->m_sStats.m_u32WaitCycles += nu_cyccnt_get() - u32Start;
+
+        /* The scratch tile is intact, finish the push with the CPU. */
+        if (i32Ret < 0)
+        {
+            tile_push_cpu(&s_sPush);
+            psTile->m_sStats.m_u32DmaPushes--;
+            psTile->m_sStats.m_u32CpuPushes++;
+        }
+    }
+
+    s_sPush.m_pu16Src = NULL;
+}
+
+// Function to start pushing a scratch tile to the back buffer
+static void tile_push_start(S_DISP_TILE *psTile, const uint16_t *pu16Src, uint16_t *pu16Dst, uint32_t u32W, uint32_t u32H)
+{
+    s_sPush.m_pu16Src = pu16Src;
+    s_sPush.m_pu16Dst = pu16Dst;
+    s_sPush.m_u32W = u32W;
+    s_sPush.m_u32H = u32H;
+    s_sPush.m_bDma = (disp_dma_copy_rect(pu16Dst, CONFIG_TIMING_HACT, pu16Src, CONFIG_DISP_TILE_W, u32W, u32H) == 0);
+
+    if (s_sPush.m_bDma)
+    {
+        psTile->m_sStats.m_u32DmaPushes++;
+    }
+    else
+    {
+        tile_push_cpu(&s_sPush);
+        psTile->m_sStats.m_u32CpuPushes++;
+    }
+
+    if (psTile->m_evMode == evDispTileSerial)
+        tile_push_wait(psTile);
+}
+
+// Function to initialize a renderer
+int disp_tile_init(S_DISP_TILE *psTile, E_DISP_TILE_MODE evMode)
+{
+    if (!psTile || (evMode >= evDispTileCNT))
+        return -1;
+
+    memset(psTile, 0, sizeof(S_DISP_TILE));
+    psTile->m_evMode = evMode;
+
+    return 0;
+}
+
+// Function to start recording a frame into a back buffer, no command and no dirty tile
+int disp_tile_begin(S_DISP_TILE *psTile, void *pvBack)
+{
+    if (!psTile || !pvBack)
+        return -1;
+
+    psTile->m_pu16Dst = (uint16_t *)pvBack;
+    psTile->m_u32CmdNum = 0;
+    memset(psTile->m_au32Dirty, 0, sizeof(psTile->m_au32Dirty));
+
+    return 0;
+}
+
+// Function to record an opaque fill, returns negative if the command table is full
+int disp_tile_fill(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H, uint16_t u16Color)
+{
+    int i32Ret;
+    S_DISP_TILE_CMD *psCmd = tile_cmd_new(psTile, evDispTileCmdFill, &i32X, &i32Y, i32W, i32H, &i32Ret);
+
+    if (psCmd)
+        psCmd->m_u16Color = u16Color;
+
+    return i32Ret;
+}
+
+// Function to record a color blended over what is below, returns negative if the command table is full
+int disp_tile_blend(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H, uint16_t u16Color, uint8_t u8Alpha)
+{
+    int i32Ret;
+    S_DISP_TILE_CMD *psCmd = tile_cmd_new(psTile, evDispTileCmdBlend, &i32X, &i32Y, i32W, i32H, &i32Ret);
+
+    if (psCmd)
+    {
+        psCmd->m_u16Color = u16Color;
+        psCmd->m_u16Alpha = u8Alpha;
+    }
+
+    return i32Ret;
+}
+
+// Function to record an opaque copy of RGB565 pixels, the source must stay valid until disp_tile_end()
+int disp_tile_blit(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H, const void *pvSrc, uint32_t u32SrcPitch)
+{
+    int i32Ret;
+    S_DISP_TILE_CMD *psCmd;
+
+    if (!pvSrc)
+        return -1;
+
+    psCmd = tile_cmd_new(psTile, evDispTileCmdBlit, &i32X, &i32Y, i32W, i32H, &i32Ret);
+
+    if (psCmd)
+    {
+        /* i32X and i32Y now hold the clipped-off part of the source. */
+        psCmd->m_pu16Src = (const uint16_t *)pvSrc + ((uint32_t)i32Y * u32SrcPitch) + (uint32_t)i32X;
+        psCmd->m_u32SrcPitch = u32SrcPitch;
+    }
+
+    return i32Ret;
+}
+
+// Function to mark the tiles under a rectangle for redraw, commands do not mark what they cover
+void disp_tile_mark_dirty(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H)
+{
+    S_DISP_RECT sRect;
+    uint32_t u32Col, u32Row;
+
+    if (!tile_clip(&sRect, i32X, i32Y, i32W, i32H))
+        return;
+
+    for (u32Row = sRect.m_u16Y / CONFIG_DISP_TILE_H; u32Row <= (uint32_t)(sRect.m_u16Y + sRect.m_u16H - 1) / CONFIG_DISP_TILE_H; u32Row++)
+    {
+        for (u32Col = sRect.m_u16X / CONFIG_DISP_TILE_W; u32Col <= (uint32_t)(sRect.m_u16X + sRect.m_u16W - 1) / CONFIG_DISP_TILE_W; u32Col++)
+        {
+            uint32_t u32Idx = u32Row * DISP_TILE_COLS + u32Col;
+
+            psTile->m_au32Dirty[u32Idx / 32] |= (1UL << (u32Idx % 32));
+        }
+    }
+}
+
+// Function to render the dirty tiles into the back buffer, returns the tiles rendered once all are in memory
+int disp_tile_end(S_DISP_TILE *psTile)
+{
+    uint32_t u32Start = nu_cyccnt_get();
+    uint32_t u32Idx, u32Next = 0;
+
+    if (!psTile || !psTile->m_pu16Dst)
+        return -1;
+
+    memset(&psTile->m_sStats, 0, sizeof(psTile->m_sStats));
+    s_sPush.m_pu16Src = NULL;
+
+    for (u32Idx = 0; u32Idx < DISP_TILE_NUM; u32Idx++)
+    {
+        S_DISP_RECT sArea;
+        uint16_t *pu16Dst;
+        int i32Base;
+
+        if (!(psTile->m_au32Dirty[u32Idx / 32] & (1UL << (u32Idx % 32))))
+            continue;
+
+        sArea.m_u16X = (uint16_t)((u32Idx % DISP_TILE_COLS) * CONFIG_DISP_TILE_W);
+        sArea.m_u16Y = (uint16_t)((u32Idx / DISP_TILE_COLS) * CONFIG_DISP_TILE_H);
+        sArea.m_u16W = (uint16_t)(((sArea.m_u16X + CONFIG_DISP_TILE_W) > CONFIG_TIMING_HACT) ? (CONFIG_TIMING_HACT - sArea.m_u16X) : CONFIG_DISP_TILE_W);
+        sArea.m_u16H = (uint16_t)(((sArea.m_u16Y + CONFIG_DISP_TILE_H) > CONFIG_TIMING_VACT) ? (CONFIG_TIMING_VACT - sArea.m_u16Y) : CONFIG_DISP_TILE_H);
+        pu16Dst = &psTile->m_pu16Dst[(uint32_t)sArea.m_u16Y * CONFIG_TIMING_HACT + sArea.m_u16X];
+
+        /* Whatever is below the last opaque command covering the tile never shows. */
+        i32Base = tile_opaque_base(psTile, &sArea);
+
+        if (psTile->m_evMode == evDispTileDirect)
+        {
+            uint32_t y;
+
+            disp_probe_begin(evDispProbeTileReplay);
+            tile_replay(psTile, (i32Base < 0) ? 0 : (uint32_t)i32Base, &sArea, pu16Dst, CONFIG_TIMING_HACT);
+            disp_probe_end(evDispProbeTileReplay);
+
+            for (y = 0; y < sArea.m_u16H; y++)
+                SCB_CleanDCache_by_Addr(&pu16Dst[y * CONFIG_TIMING_HACT], (int32_t)(sArea.m_u16W * sizeof(uint16_t)));
+        }
+        else
+        {
+            /* The other scratch tile may still be in flight. */
+            uint16_t *pu16Scratch = s_au16Scratch[u32Next];
+
+            disp_probe_begin(evDispProbeTileReplay);
+
+            if (i32Base < 0)
+            {
+                tile_load(pu16Dst, pu16Scratch, &sArea);
+                psTile->m_sStats.m_u32Loads++;
+            }
+
+            tile_replay(psTile, (i32Base < 0) ? 0 : (uint32_t)i32Base, &sArea, pu16Scratch, CONFIG_DISP_TILE_W);
+            disp_probe_end(evDispProbeTileReplay);
+            tile_push_wait(psTile);
+            tile_push_start(psTile, pu16Scratch, pu16Dst, sArea.m_u16W, sArea.m_u16H);
+            u32Next ^= 1;
+        }
+
+        psTile->m_sStats.m_u32Tiles++;
+    }
+
+    tile_push_wait(psTile);
+
+    psTile->m_sStats.m_u32Cycles = nu_cyccnt_get() - u32Start;
+
+    return (int)psTile->m_sStats.m_u32Tiles;
+}
@@ -0,0 +1,105 @@
+/**************************************************************************//**
+ * @file     disp_tile.h
+ * @brief    Tile renderer for overdraw-heavy scenes. The draw commands of a
+ *           frame are recorded first, then each dirty tile replays them into
+ *           a scratch tile in DTCM and the finished tile is pushed to the
+ *           back buffer with one rectangle copy of the backend DMA. A tile
+ *           that no opaque command covers whole is first loaded from the
+ *           back buffer, so every mode draws over what is already there.
+ *           The D-cache and the SRAM the scanout reads see every pixel once.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_TILE_H__
+#define __DISP_TILE_H__
+
+#include "disp.h"
+#include "disp_surface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CONFIG_DISP_TILE_W        32   /*!< Tile width in pixels */
+#define CONFIG_DISP_TILE_H        32   /*!< Tile height in pixels, 64 at most for the PDMA rectangle copy */
+#define CONFIG_DISP_TILE_CMDS     32   /*!< Draw commands recorded per frame */
+
+#define DISP_TILE_COLS            ((CONFIG_TIMING_HACT + CONFIG_DISP_TILE_W - 1) / CONFIG_DISP_TILE_W)
+#define DISP_TILE_ROWS            ((CONFIG_TIMING_VACT + CONFIG_DISP_TILE_H - 1) / CONFIG_DISP_TILE_H)
+#define DISP_TILE_NUM             (DISP_TILE_COLS * DISP_TILE_ROWS)
+
+typedef enum
+{
+    evDispTileDirect,      /*!< Replay straight into the back buffer, then clean its cache lines */
+    evDispTileSerial,      /*!< Render a tile in DTCM, push it and wait */
+    evDispTileOverlap,     /*!< Render the next tile in the other DTCM tile while the last one is pushed */
+    evDispTileCNT          /*!< Number of modes */
+} E_DISP_TILE_MODE;
+
+typedef enum
+{
+    evDispTileCmdFill,     /*!< Opaque color */
+    evDispTileCmdBlend,    /*!< Color over the pixels below, 0 to 255 alpha */
+    evDispTileCmdBlit      /*!< Opaque RGB565 pixels */
+} E_DISP_TILE_CMD;
+
+// Draw command, clipped to the panel
+typedef struct
+{
+    E_DISP_TILE_CMD  m_evCmd;
+    S_DISP_RECT      m_sRect;
+    uint16_t         m_u16Color;
+    uint16_t         m_u16Alpha;
+    const uint16_t  *m_pu16Src;       /*!< Pixel of the blit at the rectangle origin */
+    uint32_t         m_u32SrcPitch;   /*!< Pixels between blit source rows */
+} S_DISP_TILE_CMD;
+
+// Statistics of the last frame
+typedef struct
+{
+    uint32_t m_u32Tiles;         /*!< Tiles rendered */
+    uint32_t m_u32Loads;         /*!< Tiles loaded from the back buffer because no opaque command covers them */
+    uint32_t m_u32DmaPushes;     /*!< Tiles pushed by the DMA */
+    uint32_t m_u32CpuPushes;     /*!< Tiles copied by the CPU because the DMA was refused or failed */
+    uint32_t m_u32WaitCycles;    /*!< Cycles the CPU waited for pushes */
+    uint32_t m_u32Cycles;        /*!< Cycles of disp_tile_end() */
+} S_DISP_TILE_STATS;
+
+// Tile renderer over a full-panel back buffer
+typedef struct
+{
+    E_DISP_TILE_MODE  m_evMode;
+    uint16_t         *m_pu16Dst;      /*!< Back buffer */
+    uint32_t          m_u32CmdNum;
+    S_DISP_TILE_CMD   m_asCmd[CONFIG_DISP_TILE_CMDS];
+    uint32_t          m_au32Dirty[(DISP_TILE_NUM + 31) / 32];
+    S_DISP_TILE_STATS m_sStats;
+} S_DISP_TILE;
+
+// Function to initialize a renderer
+int disp_tile_init(S_DISP_TILE *psTile, E_DISP_TILE_MODE evMode);
+
+// Function to start recording a frame into a back buffer, no command and no dirty tile
+int disp_tile_begin(S_DISP_TILE *psTile, void *pvBack);
+
+// Function to record an opaque fill, returns negative if the command table is full
+int disp_tile_fill(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H, uint16_t u16Color);
+
+// Function to record a color blended over what is below, returns negative if the command table is full
+int disp_tile_blend(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H, uint16_t u16Color, uint8_t u8Alpha);
+
+// Function to record an opaque copy of RGB565 pixels, the source must stay valid until disp_tile_end()
+int disp_tile_blit(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H, const void *pvSrc, uint32_t u32SrcPitch);
+
+// Function to mark the tiles under a rectangle for redraw, commands do not mark what they cover
+void disp_tile_mark_dirty(S_DISP_TILE *psTile, int i32X, int i32Y, int i32W, int i32H);
+
+// Function to render the dirty tiles into the back buffer, returns the tiles rendered once all are in memory
+int disp_tile_end(S_DISP_TILE *psTile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_TILE_H__ */
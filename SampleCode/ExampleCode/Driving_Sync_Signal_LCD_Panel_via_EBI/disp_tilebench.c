@@ -0,0 +1,194 @@
+/**************************************************************************//**
+ * @file     disp_tilebench.c
+ * @brief    Report the render cost of an overdraw-heavy scene for each mode
+ *           of the tile renderer over the UART console. Enable
+ *           CONFIG_DISP_TILEBENCH in disp.h. The scene is a background, a
+ *           stack of translucent panels, a few opaque buttons and a blit of
+ *           the buffer on screen, drawn into the other VRAM buffer. A full
+ *           redraw and a small dirty region are timed. A second scene has no
+ *           opaque background and draws over a pattern in the back buffer,
+ *           every mode must leave the same pixels. The VRAM content is
+ *           overwritten.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "disp.h"
+#include "disp_tile.h"
+#include "nu_cyccnt.h"
+
+#if defined(CONFIG_DISP_TILEBENCH)
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_TILEBENCH_FRAMES     8     /*!< Frames timed per mode and region */
+#define DEF_TILEBENCH_PANELS     12    /*!< Translucent panels stacked over the background */
+#define DEF_TILEBENCH_FNV_BASIS  0x811C9DC5UL
+#define DEF_TILEBENCH_FNV_PRIME  0x01000193UL
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static S_DISP_TILE s_sTile;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to record the scene of one frame
+static void tilebench_scene(S_DISP_TILE *psTile, const void *pvFront, uint32_t u32Frame)
+{
+    int i;
+
+    disp_tile_fill(psTile, 0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT, 0x10A2);
+
+    for (i = 0; i < DEF_TILEBENCH_PANELS; i++)
+    {
+        int i32X = (int)(((uint32_t)i * 37 + u32Frame * 4) % (CONFIG_TIMING_HACT - 160));
+        int i32Y = (int)(((uint32_t)i * 23) % (CONFIG_TIMING_VACT - 96));
+
+        disp_tile_blend(psTile, i32X, i32Y, 160, 96, (uint16_t)(0x001F << ((i % 3) * 5)), 96);
+    }
+
+    for (i = 0; i < 4; i++)
+        disp_tile_fill(psTile, 16 + i * 112, CONFIG_TIMING_VACT - 40, 96, 28, 0xFFE0);
+
+    if (pvFront)
+        disp_tile_blit(psTile, CONFIG_TIMING_HACT - 136, 8, 128, 128, pvFront, CONFIG_TIMING_HACT);
+}
+
+// Function to record a scene without background, the back buffer shows through everywhere nothing opaque is drawn
+static void tilebench_overlay_scene(S_DISP_TILE *psTile)
+{
+    int i;
+
+    /* Covers whole tiles in its middle and parts of tiles at its edges. */
+    disp_tile_fill(psTile, 45, 27, 150, 110, 0x07E0);
+
+    for (i = 0; i < 6; i++)
+        disp_tile_blend(psTile, 13 + i * 61, 9 + i * 31, 140, 90, (uint16_t)(0xF800 >> ((i % 3) * 5)), (uint8_t)(64 + i * 32));
+
+    disp_tile_fill(psTile, CONFIG_TIMING_HACT - 70, CONFIG_TIMING_VACT - 50, 50, 30, 0xFFFF);
+}
+
+// Function to fill the back buffer with a pattern for the overlay scene to draw over
+static void tilebench_overlay_seed(uint16_t *pu16Back)
+{
+    uint32_t x, y;
+
+    for (y = 0; y < CONFIG_TIMING_VACT; y++)
+    {
+        for (x = 0; x < CONFIG_TIMING_HACT; x++)
+            pu16Back[y * CONFIG_TIMING_HACT + x] = (uint16_t)((x * 0x0841) ^ (y * 0x1863));
+    }
+
+    /* The DMA pushes write behind the D-cache. */
+    SCB_CleanInvalidateDCache_by_Addr(pu16Back, CONFIG_VRAM_BUF_SIZE);
+}
+
+// Function to get the FNV-1a hash of the back buffer
+static uint32_t tilebench_hash(const uint16_t *pu16Back)
+{
+    uint32_t u32Hash = DEF_TILEBENCH_FNV_BASIS;
+    uint32_t i;
+
+    for (i = 0; i < (CONFIG_TIMING_HACT * CONFIG_TIMING_VACT); i++)
+    {
+        u32Hash = (u32Hash ^ (pu16Back[i] & 0xFF)) * DEF_TILEBENCH_FNV_PRIME;
+        u32Hash = (u32Hash ^ (pu16Back[i] >> 8)) * DEF_TILEBENCH_FNV_PRIME;
+    }
+
+    return u32Hash;
+}
+
+// Function to render the overlay scene in every mode over the same pattern, returns negative if the modes disagree
+static int tilebench_overlay_check(void *pvBack, const char *const *pszMode)
+{
+    uint32_t au32Hash[evDispTileCNT];
+    int i32Mode, i32Ret = 0;
+
+    for (i32Mode = 0; i32Mode < evDispTileCNT; i32Mode++)
+    {
+        tilebench_overlay_seed((uint16_t *)pvBack);
+        disp_tile_init(&s_sTile, (E_DISP_TILE_MODE)i32Mode);
+        disp_tile_begin(&s_sTile, pvBack);
+        tilebench_overlay_scene(&s_sTile);
+        disp_tile_mark_dirty(&s_sTile, 0, 0, CONFIG_TIMING_HACT, CONFIG_TIMING_VACT);
+        disp_tile_end(&s_sTile);
+        au32Hash[i32Mode] = tilebench_hash((const uint16_t *)pvBack);
+
+        if (au32Hash[i32Mode] != au32Hash[evDispTileDirect])
+            i32Ret = -1;
+
+        printf("Overlay %-8s hash %08X, %u of %u tiles loaded from the back buffer.\n", pszMode[i32Mode],
+               au32Hash[i32Mode], s_sTile.m_sStats.m_u32Loads, s_sTile.m_sStats.m_u32Tiles);
+    }
+
+    printf("Overlay scene: %s.\n", i32Ret ? "modes differ" : "every mode matches");
+
+    return i32Ret;
+}
+
+// Function to time one mode over a dirty region, returns the average cycles per frame
+static uint32_t tilebench_run(E_DISP_TILE_MODE evMode, void *pvBack, const void *pvFront, int i32W, int i32H, S_DISP_TILE_STATS *psStats)
+{
+    uint32_t u32Frame, u32Total = 0;
+
+    disp_tile_init(&s_sTile, evMode);
+
+    for (u32Frame = 0; u32Frame < DEF_TILEBENCH_FRAMES; u32Frame++)
+    {
+        disp_tile_begin(&s_sTile, pvBack);
+        tilebench_scene(&s_sTile, pvFront, u32Frame);
+        disp_tile_mark_dirty(&s_sTile, 0, 0, i32W, i32H);
+        disp_tile_end(&s_sTile);
+        u32Total += s_sTile.m_sStats.m_u32Cycles;
+    }
+
+    *psStats = s_sTile.m_sStats;
+
+    return u32Total / DEF_TILEBENCH_FRAMES;
+}
+
+// Function to report the tile renderer benchmark
+static int disp_tilebench_init(void)
+{
+    static const char *const s_aszMode[evDispTileCNT] = { "Direct", "Serial", "Overlap" };
+    static const int s_ai32Region[2][2] = { { CONFIG_TIMING_HACT, CONFIG_TIMING_VACT }, { 96, 96 } };
+    const void *pvFront = disp_get_vrambufaddr();
+    void *pvBack = (pvFront == disp_get_vrambuf(0)) ? disp_get_vrambuf(1) : disp_get_vrambuf(0);
+    int i32Mode, i32Region, i32Ret;
+
+    nu_cyccnt_init();
+
+    printf("Tile renderer benchmark: %dx%d tiles, %d frames per mode.\n", CONFIG_DISP_TILE_W, CONFIG_DISP_TILE_H, DEF_TILEBENCH_FRAMES);
+    printf("%-8s %-8s %6s %9s %9s %10s %10s\n", "Mode", "Region", "Tiles", "DmaPush", "CpuPush", "Wait(us)", "Frame(us)");
+
+    for (i32Region = 0; i32Region < 2; i32Region++)
+    {
+        for (i32Mode = 0; i32Mode < evDispTileCNT; i32Mode++)
+        {
+            S_DISP_TILE_STATS sStats;
+            uint32_t u32Cycles = tilebench_run((E_DISP_TILE_MODE)i32Mode, pvBack, pvFront,
+                                               s_ai32Region[i32Region][0], s_ai32Region[i32Region][1], &sStats);
+
+            printf("%-8s %3dx%-4d %6u %9u %9u %10u %10u\n", s_aszMode[i32Mode],
+                   s_ai32Region[i32Region][0], s_ai32Region[i32Region][1],
+                   sStats.m_u32Tiles, sStats.m_u32DmaPushes, sStats.m_u32CpuPushes,
+                   sStats.m_u32WaitCycles / (nu_cyccnt_freq() / 1000000),
+                   u32Cycles / (nu_cyccnt_freq() / 1000000));
+        }
+    }
+
+    i32Ret = tilebench_overlay_check(pvBack, s_aszMode);
+
+    /* Show the last frame. */
+    disp_set_vrambufaddr(pvBack);
+
+    return i32Ret;
+}
+
+COMPONENT_EXPORT_DEFERRED("DISP_TILEBENCH", disp_tilebench_init, NULL);
+
+#endif /* defined(CONFIG_DISP_TILEBENCH) */
@@ -0,0 +1,123 @@
+/**************************************************************************//**
+ * @file     disp_vsync.c
+ * @brief    Vertical blank wait and frame pacing over the blank interrupt of
+ *           the backend. WFE is used rather than WFI: a blank taken between
+ *           the frame check and the sleep leaves the event register set, so
+ *           the WFE falls through instead of sleeping a whole frame.
+ *           Not for buffers owned by disp_swapchain.h.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include "disp.h"
+#include "disp_vsync.h"
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static S_DISP_VSYNC_STATS s_sStats;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to read the blank count and stamp in one go, the blank interrupt updates both
+static uint32_t vsync_read(uint32_t *pu32Stamp, uint32_t *pu32Built)
+{
+    S_DISP_RINGINFO sInfo;
+    uint32_t u32PriMask = __get_PRIMASK();
+
+    __disable_irq();
+    disp_get_ringinfo(&sInfo);
+    __set_PRIMASK(u32PriMask);
+
+    if (pu32Stamp)
+        *pu32Stamp = sInfo.m_u32BlankStamp;
+
+    if (pu32Built)
+        *pu32Built = sInfo.m_u32BuildCycles;
+
+    return sInfo.m_u32BlankCount;
+}
+
+// Function to sleep until the frame number is reached, returns the frame number
+static uint32_t vsync_wait_until(uint32_t u32Frame, uint32_t *pu32Stamp)
+{
+    uint32_t u32Now;
+
+    while ((int32_t)(u32Frame - (u32Now = vsync_read(pu32Stamp, NULL))) > 0)
+        __WFE();
+
+    return u32Now;
+}
+
+// Function to get the current frame number and the cycle count of its blank
+uint32_t disp_get_frame(uint32_t *pu32Stamp)
+{
+    return vsync_read(pu32Stamp, NULL);
+}
+
+// Function to sleep until the next blank, returns negative if the scanout is not running
+int disp_wait_vblank(uint32_t *pu32Frame)
+{
+    uint32_t u32Built;
+    uint32_t u32Now = vsync_read(NULL, &u32Built);
+
+    if (!u32Built)
+        return -1;
+
+    u32Now = vsync_wait_until(u32Now + 1, NULL);
+
+    if (pu32Frame)
+        *pu32Frame = u32Now;
+
+    return 0;
+}
+
+// Function to show a buffer from the blank of a frame number, sleeps until it is on screen. Returns 1 if the frame had passed, negative on failure
+int disp_present_at(void *pvBuf, uint32_t u32Frame, S_DISP_PRESENT_TIME *psTime)
+{
+    uint32_t u32Built, u32PriMask, u32Target, u32Stamp, u32Now;
+
+    if (!pvBuf || (vsync_read(NULL, &u32Built), !u32Built))
+        return -1;
+
+    /* The ring takes a new address at the first blank after it is set. */
+    vsync_wait_until(u32Frame - 1, NULL);
+
+    u32PriMask = __get_PRIMASK();
+    __disable_irq();
+    disp_set_vrambufaddr(pvBuf);
+    u32Target = vsync_read(NULL, NULL) + 1;
+    __set_PRIMASK(u32PriMask);
+
+    u32Now = vsync_wait_until(u32Target, &u32Stamp);
+
+    s_sStats.m_u32Presents++;
+
+    if (psTime)
+    {
+        psTime->m_u32Frame = u32Target;
+        psTime->m_u32Stamp = u32Stamp;
+        psTime->m_u32Late = ((int32_t)(u32Target - u32Frame) > 0) ? (u32Target - u32Frame) : 0;
+
+        /* Woken late, the stamp belongs to a later blank. */
+        if (u32Now != u32Target)
+            psTime->m_u32Stamp = 0;
+    }
+
+    if ((int32_t)(u32Target - u32Frame) > 0)
+    {
+        s_sStats.m_u32Missed++;
+        s_sStats.m_u32LateFrames += u32Target - u32Frame;
+
+        return 1;
+    }
+
+    return 0;
+}
+
+// Function to get the frame pacing statistics
+void disp_vsync_get_stats(S_DISP_VSYNC_STATS *psStats)
+{
+    *psStats = s_sStats;
+}
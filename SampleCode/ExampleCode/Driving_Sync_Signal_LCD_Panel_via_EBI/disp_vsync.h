@@ -0,0 +1,52 @@
+/**************************************************************************//**
+ * @file     disp_vsync.h
+ * @brief    Vertical blank wait and frame pacing. The CPU sleeps in WFE until
+ *           the blank interrupt of the scanout ring, frames are numbered by
+ *           the blank count of disp_get_ringinfo() and stamped with its
+ *           cycle count.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __DISP_VSYNC_H__
+#define __DISP_VSYNC_H__
+
+#include "NuMicro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// When a buffer given to disp_present_at() reached the panel
+typedef struct
+{
+    uint32_t m_u32Frame;        /*!< Blank the scanout switched to the buffer at */
+    uint32_t m_u32Stamp;        /*!< Cycle count of that blank, see nu_cyccnt.h. 0 if the caller woke after a later blank */
+    uint32_t m_u32Late;         /*!< Frames after the one asked for, 0 when on time */
+} S_DISP_PRESENT_TIME;
+
+// Frame pacing statistics
+typedef struct
+{
+    uint32_t m_u32Presents;     /*!< Calls of disp_present_at() */
+    uint32_t m_u32Missed;       /*!< Presents shown after the frame asked for */
+    uint32_t m_u32LateFrames;   /*!< Frames the missed presents were late by in total */
+} S_DISP_VSYNC_STATS;
+
+// Function to get the current frame number and the cycle count of its blank
+uint32_t disp_get_frame(uint32_t *pu32Stamp);
+
+// Function to sleep until the next blank, returns negative if the scanout is not running
+int disp_wait_vblank(uint32_t *pu32Frame);
+
+// Function to show a buffer from the blank of a frame number, sleeps until it is on screen. Returns 1 if the frame had passed, negative on failure
+int disp_present_at(void *pvBuf, uint32_t u32Frame, S_DISP_PRESENT_TIME *psTime);
+
+// Function to get the frame pacing statistics
+void disp_vsync_get_stats(S_DISP_VSYNC_STATS *psStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DISP_VSYNC_H__ */
@@ -20,6 +20,36 @@
 
 #include "NuMicro.h"
 
+#ifndef DMA350_LIB_COPY_CH_NUM
+    #define DMA350_LIB_COPY_CH_NUM      8   /* Channels that can run a split copy */
+#endif
+#define DMA350_LIB_COPY_MAXBURSTLEN     15  /* Beats per burst minus one */
+#define DMA350_LIB_COPY_SEG_NUM         3   /* Head, body and tail */
+#define DMA350_LIB_COPY_LINK_WORDS      8   /* Header plus the registers a linked copy command updates */
+#define DMA350_LIB_MPU_REGION_NUM       16  /* Armv8-M MPU regions per security state */
+#define DMA350_LIB_MPU_ATTR_VALID       0x8000U
+
+/* Piece of a copy moved with one transfer size */
+struct dma350_copy_seg
+{
+    uint32_t offset;   /* Bytes from the start of the copy */
+    uint32_t size;     /* Bytes */
+    uint32_t shift;    /* Log2 of the transfer size in bytes */
+};
+
+/* Memory attribute (bits 7:0), shareability (bits 9:8) and valid flag of
+ * each MPU region, per MPU (secure, non-secure). Filled on first use, one
+ * halfword store per entry so interrupts see either the old or the new one. */
+static volatile uint16_t dma350_mpu_attr_cache[2][DMA350_LIB_MPU_REGION_NUM];
+
+/* Commands following the one started from the channel registers, fetched by
+ * the channel itself, so kept out of the data cache. */
+#if defined(NVT_NONCACHEABLE)
+    NVT_NONCACHEABLE static uint32_t dma350_copy_link[DMA350_LIB_COPY_CH_NUM][DMA350_LIB_COPY_SEG_NUM - 1][DMA350_LIB_COPY_LINK_WORDS];
+#else
+    static uint32_t dma350_copy_link[DMA350_LIB_COPY_CH_NUM][DMA350_LIB_COPY_SEG_NUM - 1][DMA350_LIB_COPY_LINK_WORDS] __ALIGNED(32);
+#endif
+
 /**********************************************/
 /************** Static Functions **************/
 /**********************************************/
@@ -91,6 +121,157 @@ static enum dma350_lib_error_t dma350_runcmd(struct dma350_ch_dev_t *dev,
     return DMA350_LIB_ERR_NONE;
 }
 
+/* Split a copy into an 8-bit head, a body of the widest beats both addresses
+ * reach together, and an 8-bit tail. Returns the number of pieces. */
+static uint32_t dma350_copy_split(uint32_t src, uint32_t des, uint32_t size,
+                                  struct dma350_copy_seg *seg)
+{
+    uint32_t shift = 3; /* 64-bit */
+    uint32_t head, body, num = 0;
+
+    /* Narrow the beat until both addresses share its alignment and the body
+     * still holds one full beat after the head. */
+    while (shift && ((((src ^ des) & ((1UL << shift) - 1)) != 0) ||
+                     (size < (2UL << shift))))
+    {
+        shift--;
+    }
+
+    head = (0 - src) & ((1UL << shift) - 1);
+    body = (size - head) & ~((1UL << shift) - 1);
+
+    if (head)
+    {
+        seg[num].offset = 0;
+        seg[num].size = head;
+        seg[num++].shift = 0;
+    }
+
+    seg[num].offset = head;
+    seg[num].size = body;
+    seg[num++].shift = shift;
+
+    if (size - head - body)
+    {
+        seg[num].offset = head + body;
+        seg[num].size = size - head - body;
+        seg[num++].shift = 0;
+    }
+
+    return num;
+}
+
+/* Run the pieces of a copy, the first from the channel registers and the
+ * others as linked commands. Memory attributes, address increments and
+ * transfer types must already be set, linked commands keep them. */
+static enum dma350_lib_error_t dma350_copy_run(struct dma350_ch_dev_t *dev,
+                                               const void *src, void *des,
+                                               const struct dma350_copy_seg *seg,
+                                               uint32_t num, bool backward,
+                                               enum dma350_lib_exec_type_t exec_type)
+{
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
+    const struct dma350_copy_seg *cur;
+    uint32_t (*link)[DMA350_LIB_COPY_LINK_WORDS] = dma350_copy_link[dev->cfg.channel];
+    uint32_t i, elem, src_addr, des_addr;
+
+    for (i = 0; i < num; i++)
+    {
+        /* A backward copy starts from the last piece and its last beat. */
+        cur = &seg[backward ? (num - 1 - i) : i];
+        elem = cur->size >> cur->shift;
+        src_addr = (uint32_t)src + cur->offset;
+        des_addr = (uint32_t)des + cur->offset;
+
+        if (backward)
+        {
+            src_addr += cur->size - (1UL << cur->shift);
+            des_addr += cur->size - (1UL << cur->shift);
+        }
+
+        if (i == 0)
+        {
+            dma350_ch_set_src(dev, src_addr);
+            dma350_ch_set_des(dev, des_addr);
+            dma350_ch_set_xsize32(dev, elem, elem);
+            dma350_ch_set_transize(dev, (enum dma350_ch_transize_t)(cur->shift << DMA_CH_CTRL_TRANSIZE_Pos));
+            /* Only the last piece reports done. */
+            dma350_ch_set_donetype(dev, (num == 1) ? DMA350_CH_DONETYPE_END_OF_CMD : DMA350_CH_DONETYPE_NONE);
+
+            if (num == 1)
+            {
+                dma350_ch_disable_linkaddr(dev);
+            }
+            else
+            {
+                dma350_ch_set_linkaddr32(dev, (uint32_t)link[0]);
+                dma350_ch_enable_linkaddr(dev);
+            }
+
+            continue;
+        }
+
+        dma350_cmdlink_init(&cmdlink_cfg);
+        cmdlink_cfg.cfg.ctrl = dev->cfg.ch_base->CH_CTRL;
+        dma350_cmdlink_set_transize(&cmdlink_cfg, (enum dma350_ch_transize_t)(cur->shift << DMA_CH_CTRL_TRANSIZE_Pos));
+        dma350_cmdlink_set_donetype(&cmdlink_cfg, (i == num - 1) ? DMA350_CH_DONETYPE_END_OF_CMD : DMA350_CH_DONETYPE_NONE);
+        dma350_cmdlink_set_srcaddr32(&cmdlink_cfg, src_addr);
+        dma350_cmdlink_set_desaddr32(&cmdlink_cfg, des_addr);
+        dma350_cmdlink_set_xsize32(&cmdlink_cfg, elem, elem);
+
+        if (i == num - 1)
+        {
+            dma350_cmdlink_disable_linkaddr(&cmdlink_cfg);
+        }
+        else
+        {
+            dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)link[i]);
+            dma350_cmdlink_enable_linkaddr(&cmdlink_cfg);
+        }
+
+        if (NULL == dma350_cmdlink_generate(&cmdlink_cfg, link[i - 1], &link[i - 1][DMA350_LIB_COPY_LINK_WORDS]))
+        {
+            return DMA350_LIB_ERR_CFG_ERR;
+        }
+    }
+
+    if (num > 1)
+    {
+#if !defined(NVT_NONCACHEABLE)
+        SCB_CleanDCache_by_Addr(link, (int32_t)sizeof(dma350_copy_link[0]));
+#endif
+        /* Commands must be in memory before the channel fetches them. */
+        __DSB();
+    }
+
+    return dma350_runcmd(dev, exec_type);
+}
+
+/* Copy with the widest beats the alignment allows, byte beats in one command
+ * on a channel without room for linked commands. */
+static enum dma350_lib_error_t dma350_copy_run_split(struct dma350_ch_dev_t *dev,
+                                                     const void *src, void *des,
+                                                     uint32_t size, bool backward,
+                                                     enum dma350_lib_exec_type_t exec_type)
+{
+    struct dma350_copy_seg seg[DMA350_LIB_COPY_SEG_NUM];
+    uint32_t num;
+
+    if (dev->cfg.channel < DMA350_LIB_COPY_CH_NUM)
+    {
+        num = dma350_copy_split((uint32_t)src, (uint32_t)des, size, seg);
+    }
+    else
+    {
+        seg[0].offset = 0;
+        seg[0].size = size;
+        seg[0].shift = 0;
+        num = 1;
+    }
+
+    return dma350_copy_run(dev, src, des, seg, num, backward, exec_type);
+}
+
 static uint8_t get_default_memattr(uint32_t address)
 {
     uint8_t mpu_attribute;
@@ -246,7 +427,17 @@ static enum dma350_lib_error_t dma350_get_memattr(void *address,
 #endif
 
     if ((Selected_MPU->CTRL & MPU_CTRL_ENABLE_Msk) &&
-            address_info.flags.mpu_region_valid)
+            address_info.flags.mpu_region_valid &&
+            (address_info.flags.mpu_region < DMA350_LIB_MPU_REGION_NUM) &&
+            (dma350_mpu_attr_cache[Selected_MPU != MPU][address_info.flags.mpu_region] & DMA350_LIB_MPU_ATTR_VALID))
+    {
+        /* Region seen before, skip the RNR/RLAR/RBAR/MAIR accesses */
+        mpu_attri_raw = dma350_mpu_attr_cache[Selected_MPU != MPU][address_info.flags.mpu_region];
+        memattr->mpu_attribute = mpu_attri_raw & 0xFFUL;
+        memattr->mpu_shareability = (mpu_attri_raw >> 8) & 0x3UL;
+    }
+    else if ((Selected_MPU->CTRL & MPU_CTRL_ENABLE_Msk) &&
+             address_info.flags.mpu_region_valid)
     {
         /* MPU is enabled, lookup attributes */
         saved_MPU_RNR = Selected_MPU->RNR;                 /* Save MPU_RNR */
@@ -268,6 +459,12 @@ static enum dma350_lib_error_t dma350_get_memattr(void *address,
         Selected_MPU->RNR = saved_MPU_RNR;                 /* Restore MPU_RNR */
         /* Extract 8-bit attribute */
         memattr->mpu_attribute = (mpu_attri_raw >> ((mpu_attr_idx & 0x3) << 3)) & 0xFFUL;
+
+        if (address_info.flags.mpu_region < DMA350_LIB_MPU_REGION_NUM)
+        {
+            dma350_mpu_attr_cache[Selected_MPU != MPU][address_info.flags.mpu_region] =
+                (uint16_t)(DMA350_LIB_MPU_ATTR_VALID | ((uint32_t)memattr->mpu_shareability << 8) | memattr->mpu_attribute);
+        }
     }
     else
     {
@@ -285,6 +482,17 @@ static enum dma350_lib_error_t dma350_get_memattr(void *address,
 /************** Public Functions **************/
 /**********************************************/
 
+void dma350_lib_memattr_flush(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < DMA350_LIB_MPU_REGION_NUM; i++)
+    {
+        dma350_mpu_attr_cache[0][i] = 0;
+        dma350_mpu_attr_cache[1][i] = 0;
+    }
+}
+
 enum dma350_lib_error_t dma350_lib_set_src(struct dma350_ch_dev_t *dev,
                                            const void *src)
 {
@@ -546,21 +754,12 @@ enum dma350_lib_error_t dma350_memcpy(struct dma350_ch_dev_t *dev,
     }
 
     dma350_ch_set_xaddr_inc(dev, 1, 1);
-
-    if (size > 0xFFFF)
-    {
-        dma350_ch_set_xsize32(dev, size, size);
-    }
-    else
-    {
-        dma350_ch_set_xsize16(dev, (uint16_t)size, (uint16_t)size);
-    }
-
-    dma350_ch_set_transize(dev, DMA350_CH_TRANSIZE_8BITS);
     dma350_ch_set_xtype(dev, DMA350_CH_XTYPE_CONTINUE);
     dma350_ch_set_ytype(dev, DMA350_CH_YTYPE_DISABLE);
+    dma350_ch_set_srcmaxburstlen(dev, DMA350_LIB_COPY_MAXBURSTLEN);
+    dma350_ch_set_desmaxburstlen(dev, DMA350_LIB_COPY_MAXBURSTLEN);
 
-    return dma350_runcmd(dev, exec_type);
+    return dma350_copy_run_split(dev, src, des, size, false, exec_type);
 }
 
 enum dma350_lib_error_t dma350_memmove(struct dma350_ch_dev_t *dev,
@@ -568,6 +767,7 @@ enum dma350_lib_error_t dma350_memmove(struct dma350_ch_dev_t *dev,
                                        enum dma350_lib_exec_type_t exec_type)
 {
     enum dma350_lib_error_t lib_err;
+    bool backward = false;
 
     lib_err = verify_dma350_ch_dev_ready(dev);
 
@@ -580,8 +780,7 @@ enum dma350_lib_error_t dma350_memmove(struct dma350_ch_dev_t *dev,
     {
         /* Start from the end if the end of the source overlaps with
            the start of the destination */
-        src = (const uint8_t *)(((const uint8_t *)src) + size - 1);
-        des = (uint8_t *)(((uint8_t *)des) + size - 1);
+        backward = true;
         dma350_ch_set_xaddr_inc(dev, -1, -1);
     }
     else
@@ -603,12 +802,12 @@ enum dma350_lib_error_t dma350_memmove(struct dma350_ch_dev_t *dev,
         return lib_err;
     }
 
-    dma350_ch_set_xsize32(dev, size, size);
-    dma350_ch_set_transize(dev, DMA350_CH_TRANSIZE_8BITS);
     dma350_ch_set_xtype(dev, DMA350_CH_XTYPE_CONTINUE);
     dma350_ch_set_ytype(dev, DMA350_CH_YTYPE_DISABLE);
+    dma350_ch_set_srcmaxburstlen(dev, DMA350_LIB_COPY_MAXBURSTLEN);
+    dma350_ch_set_desmaxburstlen(dev, DMA350_LIB_COPY_MAXBURSTLEN);
 
-    return dma350_runcmd(dev, exec_type);
+    return dma350_copy_run_split(dev, src, des, size, backward, exec_type);
 }
 
 enum dma350_lib_error_t dma350_endian_swap(struct dma350_ch_dev_t *dev,
@@ -685,21 +884,24 @@ enum dma350_lib_error_t dma350_endian_swap(struct dma350_ch_dev_t *dev,
     return DMA350_LIB_ERR_NONE;
 }
 
-enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
-                                                const void *src, void *des,
-                                                uint32_t src_width, uint16_t src_height,
-                                                uint16_t src_line_width,
-                                                uint32_t des_width, uint16_t des_height,
-                                                uint16_t des_line_width,
-                                                enum dma350_ch_transize_t pixelsize,
-                                                enum dma350_lib_transform_t transform,
-                                                enum dma350_lib_exec_type_t exec_type)
+enum dma350_lib_error_t dma350_endian_swap_linked(struct dma350_ch_dev_t *dev,
+                                                  const void *src, void *des,
+                                                  uint8_t size, uint32_t count,
+                                                  uint32_t *cmdbuf, uint32_t cmdbuf_words,
+                                                  enum dma350_lib_exec_type_t exec_type)
 {
-    uint8_t *des_uint8_t;
-    uint32_t des_offset, des_xsize;
-    uint16_t des_ysize, des_yaddrstride;
-    int16_t des_xaddrinc;
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
     enum dma350_lib_error_t lib_err;
+    const uint8_t *ptr8 = (const uint8_t *) src;
+    uint8_t *des8 = (uint8_t *) des;
+    uint32_t *next = cmdbuf;
+    uint32_t done, copy_count;
+
+    if (!size || !count || !cmdbuf ||
+            (cmdbuf_words < DMA350_ENDIAN_SWAP_CMDBUF_WORDS(count)))
+    {
+        return DMA350_LIB_ERR_CFG_ERR;
+    }
 
     lib_err = verify_dma350_ch_dev_ready(dev);
 
@@ -708,32 +910,128 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
         return lib_err;
     }
 
+    lib_err = dma350_lib_set_des(dev, des);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    /* Memory attributes are expected to be constant over the whole affected
+     * memory, the linked commands only update the addresses. */
+    lib_err = dma350_lib_set_src(dev, &ptr8[size - 1]);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    /* The first chunk runs from the channel registers. */
+    copy_count = (count > UINT16_MAX) ? UINT16_MAX : count;
+    dma350_ch_set_xtype(dev, DMA350_CH_XTYPE_CONTINUE);
+    dma350_ch_set_ytype(dev, DMA350_CH_YTYPE_CONTINUE);
+    dma350_ch_set_transize(dev, DMA350_CH_TRANSIZE_8BITS);
+    dma350_ch_set_xaddr_inc(dev, -1, 1);
+    dma350_ch_set_yaddrstride(dev, size, 0);
+    dma350_ch_set_ysize16(dev, (uint16_t)copy_count, 1);
+    dma350_ch_set_xsize32(dev, size, size * copy_count);
+    dma350_ch_set_donetype(dev, (copy_count == count) ? DMA350_CH_DONETYPE_END_OF_CMD : DMA350_CH_DONETYPE_NONE);
+
+    if (copy_count == count)
+    {
+        dma350_ch_disable_linkaddr(dev);
+    }
+    else
+    {
+        dma350_ch_set_linkaddr32(dev, (uint32_t)next);
+        dma350_ch_enable_linkaddr(dev);
+    }
+
+    /* Every further chunk is one linked command, the next one follows it. */
+    for (done = copy_count; done < count; done += copy_count)
+    {
+        copy_count = ((count - done) > UINT16_MAX) ? UINT16_MAX : (count - done);
+
+        dma350_cmdlink_init(&cmdlink_cfg);
+        dma350_cmdlink_set_srcaddr32(&cmdlink_cfg, (uint32_t)&ptr8[(1 + done) * size - 1]);
+        dma350_cmdlink_set_desaddr32(&cmdlink_cfg, (uint32_t)&des8[done * size]);
+        dma350_cmdlink_set_ysize16(&cmdlink_cfg, (uint16_t)copy_count, 1);
+        dma350_cmdlink_set_xsize32(&cmdlink_cfg, size, size * copy_count);
+
+        if ((done + copy_count) == count)
+        {
+            cmdlink_cfg.cfg.ctrl = dev->cfg.ch_base->CH_CTRL;
+            dma350_cmdlink_set_donetype(&cmdlink_cfg, DMA350_CH_DONETYPE_END_OF_CMD);
+            dma350_cmdlink_disable_linkaddr(&cmdlink_cfg);
+        }
+        else
+        {
+            /* Header plus srcaddr, desaddr, xsize, xsizehi, ysize and linkaddr */
+            dma350_cmdlink_set_linkaddr32(&cmdlink_cfg, (uint32_t)(next + 7));
+            dma350_cmdlink_enable_linkaddr(&cmdlink_cfg);
+        }
+
+        next = dma350_cmdlink_generate(&cmdlink_cfg, next, &cmdbuf[cmdbuf_words]);
+
+        if (NULL == next)
+        {
+            return DMA350_LIB_ERR_CFG_ERR;
+        }
+    }
+
+    if (next != cmdbuf)
+    {
+        SCB_CleanDCache_by_Addr(cmdbuf, (int32_t)((uint32_t)next - (uint32_t)cmdbuf));
+        /* Commands must be in memory before the channel fetches them. */
+        __DSB();
+    }
+
+    return dma350_runcmd(dev, exec_type);
+}
+
+/* Destination walk of a canvas draw */
+struct dma350_canvas_walk
+{
+    uint32_t offset;       /* Bytes from des to the first pixel written */
+    uint32_t xsize;
+    uint16_t ysize;
+    int16_t xaddrinc;
+    uint16_t yaddrstride;
+};
+
+/* Find where a transform starts writing the destination and how it walks it. */
+static enum dma350_lib_error_t dma350_canvas_walk(uint32_t des_width, uint16_t des_height,
+                                                  uint16_t des_line_width,
+                                                  enum dma350_ch_transize_t pixelsize,
+                                                  enum dma350_lib_transform_t transform,
+                                                  struct dma350_canvas_walk *walk)
+{
     switch (transform)
     {
         case DMA350_LIB_TRANSFORM_NONE:
-            des_offset = 0;
-            des_xsize = des_width;
-            des_ysize = des_height;
-            des_xaddrinc = 1;
-            des_yaddrstride = des_line_width;
+            walk->offset = 0;
+            walk->xsize = des_width;
+            walk->ysize = des_height;
+            walk->xaddrinc = 1;
+            walk->yaddrstride = des_line_width;
             break;
 
         case DMA350_LIB_TRANSFORM_MIRROR_HOR:
             /* Top right */
-            des_offset = des_width - 1;
-            des_xsize = des_width;
-            des_ysize = des_height;
-            des_xaddrinc = -1;
-            des_yaddrstride = des_line_width;
+            walk->offset = des_width - 1;
+            walk->xsize = des_width;
+            walk->ysize = des_height;
+            walk->xaddrinc = -1;
+            walk->yaddrstride = des_line_width;
             break;
 
         case DMA350_LIB_TRANSFORM_MIRROR_VER:
             /* Bottom left */
-            des_offset = (des_height - 1) * des_line_width;
-            des_xsize = des_width;
-            des_ysize = des_height;
-            des_xaddrinc = 1;
-            des_yaddrstride = -des_line_width;
+            walk->offset = (des_height - 1) * des_line_width;
+            walk->xsize = des_width;
+            walk->ysize = des_height;
+            walk->xaddrinc = 1;
+            walk->yaddrstride = -des_line_width;
             break;
 
         case DMA350_LIB_TRANSFORM_MIRROR_TLBR:
@@ -743,11 +1041,11 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
             }
 
             /* Bottom right */
-            des_offset = (des_height - 1) * des_line_width + des_width - 1;
-            des_xsize = des_height;
-            des_ysize = (uint16_t)des_width;
-            des_xaddrinc = (int16_t)(-des_line_width);
-            des_yaddrstride = (uint16_t) -1;
+            walk->offset = (des_height - 1) * des_line_width + des_width - 1;
+            walk->xsize = des_height;
+            walk->ysize = (uint16_t)des_width;
+            walk->xaddrinc = (int16_t)(-des_line_width);
+            walk->yaddrstride = (uint16_t) -1;
             break;
 
         case DMA350_LIB_TRANSFORM_MIRROR_TRBL:
@@ -756,11 +1054,11 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
                 return DMA350_LIB_ERR_CFG_ERR;
             }
 
-            des_offset = 0;
-            des_xsize = des_height;
-            des_ysize = (uint16_t)des_width;
-            des_xaddrinc = (int16_t)des_line_width;
-            des_yaddrstride = 1;
+            walk->offset = 0;
+            walk->xsize = des_height;
+            walk->ysize = (uint16_t)des_width;
+            walk->xaddrinc = (int16_t)des_line_width;
+            walk->yaddrstride = 1;
             break;
 
         case DMA350_LIB_TRANSFORM_ROTATE_90:
@@ -770,20 +1068,20 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
             }
 
             /* Top right */
-            des_offset = des_width - 1;
-            des_xsize = des_height;
-            des_ysize = (uint16_t)des_width;
-            des_xaddrinc = (int16_t)des_line_width;
-            des_yaddrstride = (uint16_t) -1;
+            walk->offset = des_width - 1;
+            walk->xsize = des_height;
+            walk->ysize = (uint16_t)des_width;
+            walk->xaddrinc = (int16_t)des_line_width;
+            walk->yaddrstride = (uint16_t) -1;
             break;
 
         case DMA350_LIB_TRANSFORM_ROTATE_180:
             /* Bottom right */
-            des_offset = (des_height - 1) * des_line_width + des_width - 1;
-            des_xsize = des_width;
-            des_ysize = des_height;
-            des_xaddrinc = -1;
-            des_yaddrstride = -des_line_width;
+            walk->offset = (des_height - 1) * des_line_width + des_width - 1;
+            walk->xsize = des_width;
+            walk->ysize = des_height;
+            walk->xaddrinc = -1;
+            walk->yaddrstride = -des_line_width;
             break;
 
         case DMA350_LIB_TRANSFORM_ROTATE_270:
@@ -793,11 +1091,11 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
             }
 
             /* Bottom left */
-            des_offset = (des_height - 1) * des_line_width;
-            des_xsize = des_height;
-            des_ysize = (uint16_t)des_width;
-            des_xaddrinc = (int16_t)(-des_line_width);
-            des_yaddrstride = 1;
+            walk->offset = (des_height - 1) * des_line_width;
+            walk->xsize = des_height;
+            walk->ysize = (uint16_t)des_width;
+            walk->xaddrinc = (int16_t)(-des_line_width);
+            walk->yaddrstride = 1;
             break;
 
         default:
@@ -808,7 +1106,39 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
        multiplied by the size of the pixel to get the byte address offset.
        Pixel size is based on dma350_ch_transize_t which is calculated by
        2^transize, so the multiplication can be reduced to a bitshift. */
-    des_offset <<= pixelsize;
+    walk->offset <<= pixelsize;
+
+    return DMA350_LIB_ERR_NONE;
+}
+
+enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
+                                                const void *src, void *des,
+                                                uint32_t src_width, uint16_t src_height,
+                                                uint16_t src_line_width,
+                                                uint32_t des_width, uint16_t des_height,
+                                                uint16_t des_line_width,
+                                                enum dma350_ch_transize_t pixelsize,
+                                                enum dma350_lib_transform_t transform,
+                                                enum dma350_lib_exec_type_t exec_type)
+{
+    uint8_t *des_uint8_t;
+    struct dma350_canvas_walk walk;
+    enum dma350_lib_error_t lib_err;
+
+    lib_err = verify_dma350_ch_dev_ready(dev);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    lib_err = dma350_canvas_walk(des_width, des_height, des_line_width, pixelsize, transform, &walk);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
     des_uint8_t = (uint8_t *) des;
     lib_err = dma350_lib_set_src(dev, src);
 
@@ -817,17 +1147,17 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
         return lib_err;
     }
 
-    lib_err = dma350_lib_set_des(dev, &des_uint8_t[des_offset]);
+    lib_err = dma350_lib_set_des(dev, &des_uint8_t[walk.offset]);
 
     if (lib_err != DMA350_LIB_ERR_NONE)
     {
         return lib_err;
     }
 
-    dma350_ch_set_xaddr_inc(dev, 1, des_xaddrinc);
-    dma350_ch_set_xsize32(dev, src_width, des_xsize);
-    dma350_ch_set_ysize16(dev, src_height, des_ysize);
-    dma350_ch_set_yaddrstride(dev, src_line_width, des_yaddrstride);
+    dma350_ch_set_xaddr_inc(dev, 1, walk.xaddrinc);
+    dma350_ch_set_xsize32(dev, src_width, walk.xsize);
+    dma350_ch_set_ysize16(dev, src_height, walk.ysize);
+    dma350_ch_set_yaddrstride(dev, src_line_width, walk.yaddrstride);
 
     dma350_ch_set_transize(dev, pixelsize);
     dma350_ch_set_xtype(dev, DMA350_CH_XTYPE_WRAP);
@@ -835,3 +1165,290 @@ enum dma350_lib_error_t dma350_draw_from_canvas(struct dma350_ch_dev_t *dev,
 
     return dma350_runcmd(dev, exec_type);
 }
+
+/* LINKADDR word of a recorded command, its last word as LINKADDRHI is never set */
+static uint32_t *dma350_cmdlist_linkaddr(uint32_t *cmd)
+{
+    return &cmd[__builtin_popcount(cmd[0] & 0xFFFFFFFCUL)];
+}
+
+/* Record one command at the end of a list and link the last one to it. The
+ * command clears the channel registers before loading its own, reports
+ * nothing and ends the chain until another one is recorded. */
+static enum dma350_lib_error_t dma350_cmdlist_add(struct dma350_cmdlist_t *list,
+                                                  struct dma350_cmdlink_gencfg_t *cmdlink_cfg)
+{
+    uint32_t *end;
+
+    dma350_cmdlink_set_regclear(cmdlink_cfg);
+    /* INTREN and CTRL are always the first two registers, dma350_cmdlist_submit updates them. */
+    dma350_cmdlink_disable_intr(cmdlink_cfg, DMA350_CH_INTREN_DONE);
+    dma350_cmdlink_set_donetype(cmdlink_cfg, DMA350_CH_DONETYPE_NONE);
+    dma350_cmdlink_disable_linkaddr(cmdlink_cfg);
+
+    end = dma350_cmdlink_generate(cmdlink_cfg, list->next, list->end);
+
+    if (NULL == end)
+    {
+        return DMA350_LIB_ERR_CFG_ERR;
+    }
+
+    if (list->last)
+    {
+        *dma350_cmdlist_linkaddr(list->last) = (uint32_t)list->next | DMA_CH_LINKADDR_LINKADDREN_Msk;
+    }
+
+    list->last = list->next;
+    list->next = end;
+    list->count++;
+
+    return DMA350_LIB_ERR_NONE;
+}
+
+/* Drop the commands recorded after a copy of the list was taken */
+static void dma350_cmdlist_rollback(struct dma350_cmdlist_t *list,
+                                    const struct dma350_cmdlist_t *saved)
+{
+    if (saved->last)
+    {
+        *dma350_cmdlist_linkaddr(saved->last) = 0;
+    }
+
+    *list = *saved;
+}
+
+enum dma350_lib_error_t dma350_cmdlist_init(struct dma350_cmdlist_t *list,
+                                            uint32_t *buf, uint32_t words)
+{
+    if ((NULL == list) || (NULL == buf) || (words < DMA350_CMDLIST_WORDS(1)))
+    {
+        return DMA350_LIB_ERR_CFG_ERR;
+    }
+
+    list->buf = buf;
+    list->end = &buf[words];
+    list->next = buf;
+    list->last = NULL;
+    list->count = 0;
+
+    return DMA350_LIB_ERR_NONE;
+}
+
+enum dma350_lib_error_t dma350_cmdlist_memcpy(struct dma350_cmdlist_t *list,
+                                              const void *src, void *des, uint32_t size)
+{
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
+    struct dma350_copy_seg seg[DMA350_LIB_COPY_SEG_NUM];
+    struct dma350_cmdlist_t saved = *list;
+    uint32_t i, num, elem;
+    enum dma350_lib_error_t lib_err;
+
+    if (!size)
+    {
+        return DMA350_LIB_ERR_CFG_ERR;
+    }
+
+    dma350_cmdlink_init(&cmdlink_cfg);
+    lib_err = dma350_cmdlink_set_src_des(&cmdlink_cfg, src, des, size, size);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    dma350_cmdlink_set_xaddrinc(&cmdlink_cfg, 1, 1);
+    dma350_cmdlink_set_xtype(&cmdlink_cfg, DMA350_CH_XTYPE_CONTINUE);
+    dma350_cmdlink_set_ytype(&cmdlink_cfg, DMA350_CH_YTYPE_DISABLE);
+    dma350_cmdlink_set_srcmaxburstlen(&cmdlink_cfg, DMA350_LIB_COPY_MAXBURSTLEN);
+    dma350_cmdlink_set_desmaxburstlen(&cmdlink_cfg, DMA350_LIB_COPY_MAXBURSTLEN);
+
+    num = dma350_copy_split((uint32_t)src, (uint32_t)des, size, seg);
+
+    for (i = 0; i < num; i++)
+    {
+        elem = seg[i].size >> seg[i].shift;
+        dma350_cmdlink_set_srcaddr32(&cmdlink_cfg, (uint32_t)src + seg[i].offset);
+        dma350_cmdlink_set_desaddr32(&cmdlink_cfg, (uint32_t)des + seg[i].offset);
+        dma350_cmdlink_set_xsize32(&cmdlink_cfg, elem, elem);
+        dma350_cmdlink_set_transize(&cmdlink_cfg, (enum dma350_ch_transize_t)(seg[i].shift << DMA_CH_CTRL_TRANSIZE_Pos));
+
+        lib_err = dma350_cmdlist_add(list, &cmdlink_cfg);
+
+        if (lib_err != DMA350_LIB_ERR_NONE)
+        {
+            dma350_cmdlist_rollback(list, &saved);
+            return lib_err;
+        }
+    }
+
+    return DMA350_LIB_ERR_NONE;
+}
+
+enum dma350_lib_error_t dma350_cmdlist_endian_swap(struct dma350_cmdlist_t *list,
+                                                   const void *src, void *des,
+                                                   uint8_t size, uint32_t count)
+{
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
+    struct dma350_cmdlist_t saved = *list;
+    const uint8_t *ptr8 = (const uint8_t *) src;
+    uint8_t *des8 = (uint8_t *) des;
+    uint32_t done;
+    uint16_t copy_count;
+    enum dma350_lib_error_t lib_err;
+
+    if (!size || !count)
+    {
+        return DMA350_LIB_ERR_CFG_ERR;
+    }
+
+    /* Memory attributes are expected to be constant over the whole affected
+     * memory, each chunk only moves the addresses. */
+    dma350_cmdlink_init(&cmdlink_cfg);
+    lib_err = dma350_cmdlink_set_src_des(&cmdlink_cfg, src, des, size * count, size * count);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    dma350_cmdlink_set_xtype(&cmdlink_cfg, DMA350_CH_XTYPE_CONTINUE);
+    dma350_cmdlink_set_ytype(&cmdlink_cfg, DMA350_CH_YTYPE_CONTINUE);
+    dma350_cmdlink_set_transize(&cmdlink_cfg, DMA350_CH_TRANSIZE_8BITS);
+    dma350_cmdlink_set_xaddrinc(&cmdlink_cfg, -1, 1);
+    dma350_cmdlink_set_yaddrstride(&cmdlink_cfg, size, 0);
+
+    for (done = 0; done < count; done += copy_count)
+    {
+        copy_count = ((count - done) > UINT16_MAX) ? UINT16_MAX : (uint16_t)(count - done);
+
+        /* Each element is read from its last byte. */
+        dma350_cmdlink_set_srcaddr32(&cmdlink_cfg, (uint32_t)&ptr8[(1 + done) * size - 1]);
+        dma350_cmdlink_set_desaddr32(&cmdlink_cfg, (uint32_t)&des8[done * size]);
+        dma350_cmdlink_set_ysize16(&cmdlink_cfg, copy_count, 1);
+        dma350_cmdlink_set_xsize32(&cmdlink_cfg, size, size * copy_count);
+
+        lib_err = dma350_cmdlist_add(list, &cmdlink_cfg);
+
+        if (lib_err != DMA350_LIB_ERR_NONE)
+        {
+            dma350_cmdlist_rollback(list, &saved);
+            return lib_err;
+        }
+    }
+
+    return DMA350_LIB_ERR_NONE;
+}
+
+enum dma350_lib_error_t dma350_cmdlist_draw_from_canvas(struct dma350_cmdlist_t *list,
+                                                        const void *src, void *des,
+                                                        uint32_t src_width, uint16_t src_height,
+                                                        uint16_t src_line_width,
+                                                        uint32_t des_width, uint16_t des_height,
+                                                        uint16_t des_line_width,
+                                                        enum dma350_ch_transize_t pixelsize,
+                                                        enum dma350_lib_transform_t transform)
+{
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
+    struct dma350_canvas_walk walk;
+    uint8_t *des_uint8_t = (uint8_t *) des;
+    enum dma350_lib_error_t lib_err;
+
+    lib_err = dma350_canvas_walk(des_width, des_height, des_line_width, pixelsize, transform, &walk);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    dma350_cmdlink_init(&cmdlink_cfg);
+    lib_err = dma350_cmdlink_set_src(&cmdlink_cfg, src);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    lib_err = dma350_cmdlink_set_des(&cmdlink_cfg, &des_uint8_t[walk.offset]);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    dma350_cmdlink_set_xaddrinc(&cmdlink_cfg, 1, walk.xaddrinc);
+    dma350_cmdlink_set_xsize32(&cmdlink_cfg, src_width, walk.xsize);
+    dma350_cmdlink_set_ysize16(&cmdlink_cfg, src_height, walk.ysize);
+    dma350_cmdlink_set_yaddrstride(&cmdlink_cfg, src_line_width, walk.yaddrstride);
+
+    dma350_cmdlink_set_transize(&cmdlink_cfg, pixelsize);
+    dma350_cmdlink_set_xtype(&cmdlink_cfg, DMA350_CH_XTYPE_WRAP);
+    dma350_cmdlink_set_ytype(&cmdlink_cfg, DMA350_CH_YTYPE_WRAP);
+
+    return dma350_cmdlist_add(list, &cmdlink_cfg);
+}
+
+enum dma350_lib_error_t dma350_cmdlist_submit(struct dma350_ch_dev_t *dev,
+                                              struct dma350_cmdlist_t *list,
+                                              enum dma350_lib_exec_type_t exec_type)
+{
+    volatile uint32_t *ch_reg;
+    uint32_t *cmd;
+    uint32_t intren, header, i, w;
+    enum dma350_lib_error_t lib_err;
+
+    lib_err = verify_dma350_ch_dev_ready(dev);
+
+    if (lib_err != DMA350_LIB_ERR_NONE)
+    {
+        return lib_err;
+    }
+
+    if ((NULL == list) || !list->count)
+    {
+        return DMA350_LIB_ERR_CFG_ERR;
+    }
+
+    /* Every command loads the interrupt enables, only the last reports done. */
+    intren = dev->cfg.ch_base->CH_INTREN;
+
+    if (exec_type == DMA350_LIB_EXEC_IRQ)
+    {
+        intren |= DMA350_CH_INTREN_DONE;
+    }
+    else
+    {
+        intren &= ~DMA350_CH_INTREN_DONE;
+    }
+
+    for (cmd = list->buf; cmd != list->next; cmd = dma350_cmdlist_linkaddr(cmd) + 1)
+    {
+        cmd[1] = intren;
+        cmd[2] = (cmd[2] & ~DMA_CH_CTRL_DONETYPE_Msk) |
+                 ((cmd == list->last) ? DMA350_CH_DONETYPE_END_OF_CMD : DMA350_CH_DONETYPE_NONE);
+    }
+
+    /* Commands must be in memory before the channel fetches them. */
+    SCB_CleanDCache_by_Addr(list->buf, (int32_t)((uint32_t)list->next - (uint32_t)list->buf));
+    __DSB();
+
+    /* Load the first command the way the channel loads the linked ones,
+     * header bit n selects the register at word n of the channel. */
+    dma350_ch_cmd(dev, DMA350_CH_CMD_CLEARCMD);
+
+    while (dma350_ch_get_cmd(dev) & DMA350_CH_CMD_CLEARCMD)
+    {
+    }
+
+    ch_reg = (volatile uint32_t *)dev->cfg.ch_base;
+    header = list->buf[0];
+
+    for (i = 2, w = 1; i < 32; i++)
+    {
+        if (header & (0x1UL << i))
+        {
+            ch_reg[i] = list->buf[w++];
+        }
+    }
+
+    return dma350_runcmd(dev, exec_type);
+}
@@ -72,6 +72,16 @@ struct dma350_remap_list_t
 /* DMA350 lib needs an externally defined, device specific remap struct */
 extern const struct dma350_remap_list_t dma350_address_remap;
 
+/**
+ * \brief Forget the memory attributes looked up per MPU region
+ *
+ * \return void
+ *
+ * \note Call it after an MPU region is changed or the MPU is enabled or
+ *       disabled, src and des setup reuse what they read from a region.
+ */
+void dma350_lib_memattr_flush(void);
+
 /**
  * \brief Set src address with memory attributes based on MPU
  *
@@ -171,6 +181,9 @@ enum dma350_lib_error_t dma350_cmdlink_set_src_des(struct dma350_cmdlink_gencfg_
  * \return Result of the operation \ref dma350_lib_error_t
  *
  * \note This function should only be called from privileged level.
+ * \note The bulk moves in the widest beats up to 64 bits that src and des
+ *       reach with the same alignment, an unaligned head and tail run as
+ *       linked byte commands. Only the last command reports done.
  */
 enum dma350_lib_error_t dma350_memcpy(struct dma350_ch_dev_t *dev,
                                       const void *src, void *des, uint32_t size,
@@ -189,6 +202,7 @@ enum dma350_lib_error_t dma350_memcpy(struct dma350_ch_dev_t *dev,
  * \return Result of the operation \ref dma350_lib_error_t
  *
  * \note This function should only be called from privileged level.
+ * \note Splits the move like \ref dma350_memcpy.
  */
 enum dma350_lib_error_t dma350_memmove(struct dma350_ch_dev_t *dev,
                                        const void *src, void *des, uint32_t size,
@@ -210,6 +224,36 @@ enum dma350_lib_error_t dma350_endian_swap(struct dma350_ch_dev_t *dev,
                                            const void *src, void *des,
                                            uint8_t size, uint32_t count);
 
+/* Words of command buffer \ref dma350_endian_swap_linked needs for count elements */
+#define DMA350_ENDIAN_SWAP_CMDBUF_WORDS(count)  (((((uint32_t)(count)) + UINT16_MAX - 1UL) / UINT16_MAX) * 8UL)
+
+/**
+ * \brief Copy a specified number of elements from one memory to another, while
+ *        reversing the byte order, as one chain of linked commands.
+ *
+ * \param[in] dev          DMA350 channel device struct \ref dma350_ch_dev_t
+ * \param[in] src          Source address, where to copy from
+ * \param[in] des          Destination address, where to copy to
+ * \param[in] size         Number of bytes in element
+ * \param[in] count        Number of elements to copy
+ * \param[in] cmdbuf       Buffer for the linked commands, word aligned
+ * \param[in] cmdbuf_words Words at cmdbuf, see \ref DMA350_ENDIAN_SWAP_CMDBUF_WORDS
+ * \param[in] exec_type    Execution type as in \ref dma350_lib_exec_type_t
+ *
+ * \return Result of the operation \ref dma350_lib_error_t
+ *
+ * \note This function should only be called from privileged level.
+ * \note Every chunk of up to 65535 elements sets its own src and des, so the
+ *       chain does not depend on the address registers a command leaves
+ *       behind. Only the last command reports done. cmdbuf is cleaned from
+ *       the data cache and must stay untouched until the channel is done.
+ */
+enum dma350_lib_error_t dma350_endian_swap_linked(struct dma350_ch_dev_t *dev,
+                                                  const void *src, void *des,
+                                                  uint8_t size, uint32_t count,
+                                                  uint32_t *cmdbuf, uint32_t cmdbuf_words,
+                                                  enum dma350_lib_exec_type_t exec_type);
+
 /**
  * \brief 2D Copy from canvas (area within a source bitmap) to within a
  *        destination bitmap, while applying various possible transformations.
@@ -306,6 +350,117 @@ enum dma350_lib_error_t dma350_2d_copy(
     enum dma350_lib_transform_t transform,
     enum dma350_lib_exec_type_t exec_type);
 
+/* Most words a recorded command takes in a command list */
+#define DMA350_CMDLIST_CMD_WORDS      13UL
+
+/* Words of command list buffer for cmds recorded commands. A copy records up
+ * to 3 commands, an endian swap one per 65535 elements, a draw one. */
+#define DMA350_CMDLIST_WORDS(cmds)    ((((uint32_t)(cmds)) * DMA350_CMDLIST_CMD_WORDS) + 1UL)
+
+/* DMA350 DMA command list, operations recorded as linked commands */
+struct dma350_cmdlist_t
+{
+    uint32_t *buf;    /*!< First command */
+    uint32_t *end;    /*!< End of the buffer */
+    uint32_t *next;   /*!< Where the next command is recorded */
+    uint32_t *last;   /*!< Last command recorded, NULL if none */
+    uint32_t count;   /*!< Number of commands recorded */
+};
+
+/**
+ * \brief Start recording a command list into a caller buffer.
+ *
+ * \param[out] list   Command list \ref dma350_cmdlist_t
+ * \param[in]  buf    Buffer for the commands, word aligned
+ * \param[in]  words  Words at buf, see \ref DMA350_CMDLIST_WORDS
+ *
+ * \return Result of the operation \ref dma350_lib_error_t
+ *
+ * \note The recording functions only write the buffer, no channel is touched
+ *       until \ref dma350_cmdlist_submit. Every command clears the channel
+ *       registers and sets its own, so operations of any kind can be mixed.
+ */
+enum dma350_lib_error_t dma350_cmdlist_init(struct dma350_cmdlist_t *list,
+                                            uint32_t *buf, uint32_t words);
+
+/**
+ * \brief Record a copy of a specified number of bytes, split like
+ *        \ref dma350_memcpy.
+ *
+ * \param[in] list  Command list \ref dma350_cmdlist_t
+ * \param[in] src   Source address, where to copy from
+ * \param[in] des   Destination address, where to copy to
+ * \param[in] size  Number of bytes to copy
+ *
+ * \return Result of the operation \ref dma350_lib_error_t, the list is left
+ *         as it was on failure
+ */
+enum dma350_lib_error_t dma350_cmdlist_memcpy(struct dma350_cmdlist_t *list,
+                                              const void *src, void *des, uint32_t size);
+
+/**
+ * \brief Record a copy of a specified number of elements, while reversing
+ *        the byte order.
+ *
+ * \param[in] list   Command list \ref dma350_cmdlist_t
+ * \param[in] src    Source address, where to copy from
+ * \param[in] des    Destination address, where to copy to
+ * \param[in] size   Number of bytes in element
+ * \param[in] count  Number of elements to copy
+ *
+ * \return Result of the operation \ref dma350_lib_error_t, the list is left
+ *         as it was on failure
+ */
+enum dma350_lib_error_t dma350_cmdlist_endian_swap(struct dma350_cmdlist_t *list,
+                                                   const void *src, void *des,
+                                                   uint8_t size, uint32_t count);
+
+/**
+ * \brief Record a 2D copy from canvas like \ref dma350_draw_from_canvas.
+ *
+ * \param[in] list            Command list \ref dma350_cmdlist_t
+ * \param[in] src             Source address, top left corner
+ * \param[in] des             Destination address, top left corner
+ * \param[in] src_width       Source width
+ * \param[in] src_height      Source height
+ * \param[in] src_line_width  Source line width
+ * \param[in] des_width       Destination width
+ * \param[in] des_height      Destination height
+ * \param[in] des_line_width  Destination line width
+ * \param[in] pixelsize       Size of a pixel as in \ref dma350_ch_transize_t
+ * \param[in] transform       Transform type as in \ref dma350_lib_transform_t
+ *
+ * \return Result of the operation \ref dma350_lib_error_t, the list is left
+ *         as it was on failure
+ */
+enum dma350_lib_error_t dma350_cmdlist_draw_from_canvas(struct dma350_cmdlist_t *list,
+                                                        const void *src, void *des,
+                                                        uint32_t src_width, uint16_t src_height,
+                                                        uint16_t src_line_width,
+                                                        uint32_t des_width, uint16_t des_height,
+                                                        uint16_t des_line_width,
+                                                        enum dma350_ch_transize_t pixelsize,
+                                                        enum dma350_lib_transform_t transform);
+
+/**
+ * \brief Run a recorded command list as one chain on a channel.
+ *
+ * \param[in] dev        DMA350 channel device struct \ref dma350_ch_dev_t
+ * \param[in] list       Command list \ref dma350_cmdlist_t
+ * \param[in] exec_type  Execution type as in \ref dma350_lib_exec_type_t
+ *
+ * \return Result of the operation \ref dma350_lib_error_t
+ *
+ * \note This function should only be called from privileged level.
+ * \note Only the last command reports done, so the whole list takes one
+ *       interrupt. The buffer is cleaned from the data cache and must stay
+ *       untouched until the channel is done. A list can be submitted again
+ *       as long as its operations still apply.
+ */
+enum dma350_lib_error_t dma350_cmdlist_submit(struct dma350_ch_dev_t *dev,
+                                              struct dma350_cmdlist_t *list,
+                                              enum dma350_lib_exec_type_t exec_type);
+
 /**
  * \brief Clear a status bit of the dma channel
  *
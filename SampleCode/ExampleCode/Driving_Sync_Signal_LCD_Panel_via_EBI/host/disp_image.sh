@@ -0,0 +1,25 @@
+#!/bin/sh
+#
+# Build host/disp_imgenc.c, compress WQVGA1.bin and WQVGA2.bin into the
+# WQVGAn.q565 files CONFIG_DISP_IMAGE_COMPRESSED embeds, and check that the
+# target decoder gives the raw images back.
+#
+# Usage: host/disp_image.sh [disp_imgenc options, e.g. -g 8]
+#
+# SPDX-License-Identifier: Apache-2.0
+# @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+#
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+CC=${CC:-gcc}
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+$CC -O2 -Wall -I. host/disp_imgenc.c disp_image.c -o "$OUT/disp_imgenc"
+
+for IMAGE in WQVGA1 WQVGA2; do
+    "$OUT/disp_imgenc" -v "$@" $IMAGE.bin $IMAGE.q565
+done
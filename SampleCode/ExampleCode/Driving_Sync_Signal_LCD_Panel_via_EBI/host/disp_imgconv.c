@@ -0,0 +1,573 @@
+/**************************************************************************//**
+ * @file     disp_imgconv.c
+ * @brief    Linux host asset converter for the display stack. Reads a PNG
+ *           or a raw RGB565 dump, optionally rotates it for a panel mounted
+ *           sideways, quantizes it with ordered or error-diffusion
+ *           dithering and writes one of the E_DISP_IMAGE_FORMAT layouts:
+ *
+ *           rgb565  raw little-endian RGB565 rows, as WQVGA1.bin
+ *           clut8   RGB565 palette, then rows of 8-bit indices. Images with
+ *                   more than 256 colours are quantized to the RGB332 cube
+ *           q565    compressed container of disp_image.h
+ *
+ *           Next to the binary a C header describes it, so INCBIN users
+ *           take the size, stride and format from there instead of
+ *           assuming CONFIG_VRAM_BUF_SIZE. -p writes the quantized result
+ *           as PNG to judge the dithering.
+ *
+ *           Build from the example folder, needs libpng:
+ *
+ *           gcc -O2 -I. host/disp_imgconv.c disp_image.c -lpng -o disp_imgconv
+ *
+ *           ./disp_imgconv -f clut8 -d fs -r 90 logo.png logo.bin
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+
+#include <ctype.h>
+#include <png.h>
+
+/* Reuse the q565 encoder. */
+#define DISP_IMGENC_LIB
+#include "disp_imgenc.c"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_IMGCONV_ALIGN        4      /*!< Default row alignment in bytes of rgb565 and clut8 */
+#define DEF_IMGCONV_CLUT_MAX     256
+#define DEF_IMGCONV_ALIGN_UP(size, align)    (((size) + (align) - 1) & ~((align) - 1))
+
+typedef enum
+{
+    evImgConvDitherNone,       /*!< Round to the nearest level */
+    evImgConvDitherOrdered,    /*!< 4x4 Bayer threshold matrix */
+    evImgConvDitherFS,         /*!< Floyd-Steinberg error diffusion */
+    evImgConvDitherCNT
+} E_IMGCONV_DITHER;
+
+// Image being converted, 8-bit RGB
+typedef struct
+{
+    int      m_i32Width;
+    int      m_i32Height;
+    uint8_t *m_pu8RGB;
+} S_IMGCONV_IMAGE;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static const char *s_aszFormat[evDispImageCNT] = { "rgb565", "clut8", "q565" };
+static const char *s_aszFormatEnum[evDispImageCNT] = { "evDispImageRGB565", "evDispImageCLUT8", "evDispImageQ565" };
+static const char *s_aszDither[evImgConvDitherCNT] = { "none", "ordered", "fs" };
+
+static const uint8_t s_au8Bayer4[4][4] =
+{
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 },
+};
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to expand a level of an n-bit channel to 8 bits
+static uint32_t imgconv_expand(uint32_t u32Level, int i32Bits)
+{
+    return (u32Level * 255 + ((1u << i32Bits) - 1) / 2) / ((1u << i32Bits) - 1);
+}
+
+// Function to pack 8-bit RGB into RGB565, the 8-bit values are exact levels or rounded
+static uint16_t imgconv_rgb565(uint32_t u32R, uint32_t u32G, uint32_t u32B)
+{
+    return (uint16_t)((((u32R * 31 + 127) / 255) << 11) | (((u32G * 63 + 127) / 255) << 5) | ((u32B * 31 + 127) / 255));
+}
+
+// Function to read a PNG, transparent pixels are blended over the background colour
+static int imgconv_load_png(S_IMGCONV_IMAGE *psImg, const char *szFile, uint32_t u32Background)
+{
+    png_image sPng;
+    png_color sBack;
+
+    memset(&sPng, 0, sizeof(sPng));
+    sPng.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_file(&sPng, szFile))
+    {
+        fprintf(stderr, "%s: %s\n", szFile, sPng.message);
+        return -1;
+    }
+
+    sPng.format = PNG_FORMAT_RGB;
+    sBack.red = (png_byte)(u32Background >> 16);
+    sBack.green = (png_byte)(u32Background >> 8);
+    sBack.blue = (png_byte)u32Background;
+
+    psImg->m_i32Width = sPng.width;
+    psImg->m_i32Height = sPng.height;
+    psImg->m_pu8RGB = malloc(PNG_IMAGE_SIZE(sPng));
+
+    if (!psImg->m_pu8RGB || !png_image_finish_read(&sPng, &sBack, psImg->m_pu8RGB, 0, NULL))
+    {
+        fprintf(stderr, "%s: %s\n", szFile, sPng.message);
+        png_image_free(&sPng);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to read a raw little-endian RGB565 dump of a known size
+static int imgconv_load_raw(S_IMGCONV_IMAGE *psImg, const char *szFile, int i32Width, int i32Height)
+{
+    uint32_t u32Num = (uint32_t)i32Width * i32Height, i;
+    uint16_t *pu16Px = malloc(u32Num * sizeof(uint16_t));
+    FILE *fp = fopen(szFile, "rb");
+
+    if (!fp || !pu16Px || (fread(pu16Px, sizeof(uint16_t), u32Num, fp) != u32Num))
+    {
+        fprintf(stderr, "Cannot read %ux%u RGB565 pixels from %s.\n", i32Width, i32Height, szFile);
+        return -1;
+    }
+
+    fclose(fp);
+
+    psImg->m_i32Width = i32Width;
+    psImg->m_i32Height = i32Height;
+    psImg->m_pu8RGB = malloc(u32Num * 3);
+
+    for (i = 0; i < u32Num; i++)
+    {
+        psImg->m_pu8RGB[i * 3 + 0] = (uint8_t)imgconv_expand(pu16Px[i] >> 11, 5);
+        psImg->m_pu8RGB[i * 3 + 1] = (uint8_t)imgconv_expand((pu16Px[i] >> 5) & 0x3F, 6);
+        psImg->m_pu8RGB[i * 3 + 2] = (uint8_t)imgconv_expand(pu16Px[i] & 0x1F, 5);
+    }
+
+    free(pu16Px);
+
+    return 0;
+}
+
+// Function to rotate an image clockwise by 90, 180 or 270 degrees
+static void imgconv_rotate(S_IMGCONV_IMAGE *psImg, int i32Degree)
+{
+    int i32W = psImg->m_i32Width, i32H = psImg->m_i32Height;
+    int i32OutW = (i32Degree == 180) ? i32W : i32H;
+    uint8_t *pu8Out;
+    int x, y;
+
+    if (!i32Degree)
+        return;
+
+    pu8Out = malloc((size_t)i32W * i32H * 3);
+
+    for (y = 0; y < i32H; y++)
+    {
+        for (x = 0; x < i32W; x++)
+        {
+            int i32OX, i32OY;
+
+            if (i32Degree == 90)
+            {
+                i32OX = i32H - 1 - y;
+                i32OY = x;
+            }
+            else if (i32Degree == 180)
+            {
+                i32OX = i32W - 1 - x;
+                i32OY = i32H - 1 - y;
+            }
+            else
+            {
+                i32OX = y;
+                i32OY = i32W - 1 - x;
+            }
+
+            memcpy(&pu8Out[((size_t)i32OY * i32OutW + i32OX) * 3], &psImg->m_pu8RGB[((size_t)y * i32W + x) * 3], 3);
+        }
+    }
+
+    free(psImg->m_pu8RGB);
+    psImg->m_pu8RGB = pu8Out;
+    psImg->m_i32Width = i32OutW;
+    psImg->m_i32Height = (i32Degree == 180) ? i32H : i32W;
+}
+
+// Function to quantize the image in place to the levels of r/g/b bit widths, every channel ends up an exact level
+static void imgconv_quantize(S_IMGCONV_IMAGE *psImg, const int ai32Bits[3], E_IMGCONV_DITHER evDither)
+{
+    int i32W = psImg->m_i32Width, i32H = psImg->m_i32Height;
+    int *pi32Err = calloc((size_t)(i32W + 2) * 2 * 3, sizeof(int));   /* Two rows of errors in 1/16 units */
+    int x, y, c;
+
+    for (y = 0; y < i32H; y++)
+    {
+        int *pi32Cur = &pi32Err[((y & 1) * (i32W + 2) + 1) * 3];
+        int *pi32Next = &pi32Err[((!(y & 1)) * (i32W + 2) + 1) * 3];
+
+        memset(pi32Next - 3, 0, (size_t)(i32W + 2) * 3 * sizeof(int));
+
+        for (x = 0; x < i32W; x++)
+        {
+            uint8_t *pu8Px = &psImg->m_pu8RGB[((size_t)y * i32W + x) * 3];
+
+            for (c = 0; c < 3; c++)
+            {
+                int i32Max = (1 << ai32Bits[c]) - 1;
+                int i32Val = pu8Px[c] * 16;
+                int i32Level, i32Out;
+
+                if (evDither == evImgConvDitherOrdered)
+                    i32Val += ((s_au8Bayer4[y & 3][x & 3] * 2 + 1 - 16) * 255) / (2 * i32Max);   /* +-0.5 level step */
+                else if (evDither == evImgConvDitherFS)
+                    i32Val += pi32Cur[x * 3 + c];
+
+                i32Level = (i32Val * i32Max + 255 * 8) / (255 * 16);
+                i32Level = (i32Level < 0) ? 0 : ((i32Level > i32Max) ? i32Max : i32Level);
+                i32Out = (int)imgconv_expand(i32Level, ai32Bits[c]);
+
+                if (evDither == evImgConvDitherFS)
+                {
+                    int i32E = i32Val - i32Out * 16;
+
+                    pi32Cur[(x + 1) * 3 + c] += (i32E * 7) / 16;
+                    pi32Next[(x - 1) * 3 + c] += (i32E * 3) / 16;
+                    pi32Next[x * 3 + c] += (i32E * 5) / 16;
+                    pi32Next[(x + 1) * 3 + c] += i32E / 16;
+                }
+
+                pu8Px[c] = (uint8_t)i32Out;
+            }
+        }
+    }
+
+    free(pi32Err);
+}
+
+// Function to get the RGB565 pixels of a quantized image
+static uint16_t *imgconv_to_rgb565(const S_IMGCONV_IMAGE *psImg)
+{
+    size_t i, u32Num = (size_t)psImg->m_i32Width * psImg->m_i32Height;
+    uint16_t *pu16Px = malloc(u32Num * sizeof(uint16_t));
+
+    for (i = 0; i < u32Num; i++)
+        pu16Px[i] = imgconv_rgb565(psImg->m_pu8RGB[i * 3], psImg->m_pu8RGB[i * 3 + 1], psImg->m_pu8RGB[i * 3 + 2]);
+
+    return pu16Px;
+}
+
+// Function to build the palette of an RGB565 image, returns the colours or 0 if there are more than 256
+static int imgconv_palette(const uint16_t *pu16Px, size_t u32Num, uint16_t *pu16Clut, uint8_t *pu8Idx)
+{
+    static int16_t ai16Slot[0x10000];
+    int i32Colors = 0;
+    size_t i;
+
+    memset(ai16Slot, 0xFF, sizeof(ai16Slot));
+
+    for (i = 0; i < u32Num; i++)
+    {
+        if (ai16Slot[pu16Px[i]] < 0)
+        {
+            if (i32Colors == DEF_IMGCONV_CLUT_MAX)
+                return 0;
+
+            pu16Clut[i32Colors] = pu16Px[i];
+            ai16Slot[pu16Px[i]] = (int16_t)i32Colors++;
+        }
+
+        pu8Idx[i] = (uint8_t)ai16Slot[pu16Px[i]];
+    }
+
+    return i32Colors;
+}
+
+// Function to write the preview PNG of the quantized image
+static int imgconv_write_png(const S_IMGCONV_IMAGE *psImg, const char *szFile)
+{
+    png_image sPng;
+
+    memset(&sPng, 0, sizeof(sPng));
+    sPng.version = PNG_IMAGE_VERSION;
+    sPng.width = psImg->m_i32Width;
+    sPng.height = psImg->m_i32Height;
+    sPng.format = PNG_FORMAT_RGB;
+
+    if (!png_image_write_to_file(&sPng, szFile, 0, psImg->m_pu8RGB, 0, NULL))
+    {
+        fprintf(stderr, "%s: %s\n", szFile, sPng.message);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to write the C header describing the asset
+static int imgconv_write_header(const char *szFile, const char *szName, const char *szSource, E_DISP_IMAGE_FORMAT evFormat,
+                                int i32Width, int i32Height, int i32Stride, int i32Colors, int i32Rotation, uint32_t u32Size)
+{
+    FILE *fp = fopen(szFile, "w");
+
+    if (!fp)
+    {
+        fprintf(stderr, "Cannot write %s.\n", szFile);
+        return -1;
+    }
+
+    fprintf(fp, "/* Generated by host/disp_imgconv.c from %s, do not edit. */\n", szSource);
+    fprintf(fp, "#ifndef __%s_H__\n#define __%s_H__\n\n", szName, szName);
+    fprintf(fp, "#define %s_WIDTH       %d   /*!< Width in pixels */\n", szName, i32Width);
+    fprintf(fp, "#define %s_HEIGHT      %d   /*!< Height in pixels */\n", szName, i32Height);
+    fprintf(fp, "#define %s_STRIDE      %d   /*!< Bytes per row, 0 for q565 */\n", szName, i32Stride);
+    fprintf(fp, "#define %s_FORMAT      %s   /*!< E_DISP_IMAGE_FORMAT */\n", szName, s_aszFormatEnum[evFormat]);
+    fprintf(fp, "#define %s_CLUT_NUM    %d   /*!< Palette entries ahead of the rows */\n", szName, i32Colors);
+    fprintf(fp, "#define %s_ROTATION    %d   /*!< Clockwise rotation applied */\n", szName, i32Rotation);
+    fprintf(fp, "#define %s_SIZE        %u   /*!< Bytes of the binary */\n", szName, u32Size);
+    fprintf(fp, "\n#endif /* __%s_H__ */\n", szName);
+    fclose(fp);
+
+    return 0;
+}
+
+// Function to derive the macro prefix from the output file name
+static void imgconv_name(char *szName, int i32Size, const char *szFile)
+{
+    const char *szBase = strrchr(szFile, '/');
+    int i;
+
+    szBase = szBase ? (szBase + 1) : szFile;
+
+    for (i = 0; (i < (i32Size - 1)) && szBase[i] && (szBase[i] != '.'); i++)
+        szName[i] = isalnum((unsigned char)szBase[i]) ? (char)toupper((unsigned char)szBase[i]) : '_';
+
+    szName[i] = '\0';
+}
+
+// Function to print the usage
+static void imgconv_usage(const char *szName)
+{
+    printf("Usage: %s [options] in.png|in.bin out.bin\n", szName);
+    printf("  -f  rgb565|clut8|q565 output format (default rgb565)\n");
+    printf("  -d  none|ordered|fs dithering (default none)\n");
+    printf("  -r  0|90|180|270 clockwise rotation (default 0)\n");
+    printf("  -s  WxH, the input is a raw RGB565 dump of this size\n");
+    printf("  -a  row alignment in bytes of rgb565 and clut8 (default %d)\n", DEF_IMGCONV_ALIGN);
+    printf("  -g  rows per restart group of q565 (default %d)\n", DEF_IMGENC_GROUP_ROWS);
+    printf("  -b  RRGGBB background under transparent pixels (default 000000)\n");
+    printf("  -H  header file (default out.bin with .h)\n");
+    printf("  -n  macro prefix of the header (default from out.bin)\n");
+    printf("  -p  preview PNG of the quantized image\n");
+}
+
+// Function to look up a name in a table, -1 if it is not there
+static int imgconv_lookup(const char *const *pszTable, int i32Num, const char *szName)
+{
+    int i;
+
+    for (i = 0; i < i32Num; i++)
+    {
+        if (!strcmp(pszTable[i], szName))
+            return i;
+    }
+
+    return -1;
+}
+
+int main(int argc, char *argv[])
+{
+    S_IMGCONV_IMAGE sImg;
+    int i32Format = evDispImageRGB565, i32Dither = evImgConvDitherNone;
+    int i32Rotation = 0, i32Align = DEF_IMGCONV_ALIGN, i32GroupRows = DEF_IMGENC_GROUP_ROWS;
+    int i32RawW = 0, i32RawH = 0, i32Opt, i32Stride = 0, i32Colors = 0, y;
+    int ai32Bits[3] = { 5, 6, 5 };
+    uint32_t u32Background = 0, u32Size;
+    const char *szHeader = NULL, *szPreview = NULL, *szPrefix = NULL;
+    char szHeaderBuf[512], szName[64];
+    uint16_t *pu16Px;
+    uint8_t *pu8Out;
+    FILE *fp;
+
+    while ((i32Opt = getopt(argc, argv, "f:d:r:s:a:g:b:H:n:p:")) != -1)
+    {
+        switch (i32Opt)
+        {
+        case 'f':
+            i32Format = imgconv_lookup(s_aszFormat, evDispImageCNT, optarg);
+            break;
+
+        case 'd':
+            i32Dither = imgconv_lookup(s_aszDither, evImgConvDitherCNT, optarg);
+            break;
+
+        case 'r':
+            i32Rotation = atoi(optarg);
+            break;
+
+        case 's':
+            if (sscanf(optarg, "%dx%d", &i32RawW, &i32RawH) != 2)
+                i32RawW = -1;
+
+            break;
+
+        case 'a':
+            i32Align = atoi(optarg);
+            break;
+
+        case 'g':
+            i32GroupRows = atoi(optarg);
+            break;
+
+        case 'b':
+            u32Background = (uint32_t)strtoul(optarg, NULL, 16);
+            break;
+
+        case 'H':
+            szHeader = optarg;
+            break;
+
+        case 'n':
+            szPrefix = optarg;
+            break;
+
+        case 'p':
+            szPreview = optarg;
+            break;
+
+        default:
+            imgconv_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (((argc - optind) != 2) || (i32Format < 0) || (i32Dither < 0) || (i32RawW < 0) || (i32RawH < 0) ||
+            ((i32Rotation != 0) && (i32Rotation != 90) && (i32Rotation != 180) && (i32Rotation != 270)) ||
+            (i32Align <= 0) || (i32Align & (i32Align - 1)) || (i32GroupRows <= 0))
+    {
+        imgconv_usage(argv[0]);
+        return 1;
+    }
+
+    if ((i32RawW ? imgconv_load_raw(&sImg, argv[optind], i32RawW, i32RawH) :
+            imgconv_load_png(&sImg, argv[optind], u32Background)) < 0)
+        return 1;
+
+    imgconv_rotate(&sImg, i32Rotation);
+
+    if ((sImg.m_i32Width > 0xFFFF) || (sImg.m_i32Height > 0xFFFF) || (i32GroupRows > sImg.m_i32Height))
+    {
+        fprintf(stderr, "%dx%d does not fit the asset formats.\n", sImg.m_i32Width, sImg.m_i32Height);
+        return 1;
+    }
+
+    if (i32Format == evDispImageCLUT8)
+    {
+        S_IMGCONV_IMAGE sCopy = sImg;
+        size_t u32Num = (size_t)sImg.m_i32Width * sImg.m_i32Height;
+        uint16_t au16Clut[DEF_IMGCONV_CLUT_MAX];
+        uint8_t *pu8Idx = malloc(u32Num);
+
+        /* Keep every RGB565 colour if they fit the palette, else fall back to the RGB332 cube. */
+        sCopy.m_pu8RGB = malloc(u32Num * 3);
+        memcpy(sCopy.m_pu8RGB, sImg.m_pu8RGB, u32Num * 3);
+        imgconv_quantize(&sCopy, ai32Bits, (E_IMGCONV_DITHER)i32Dither);
+        pu16Px = imgconv_to_rgb565(&sCopy);
+        i32Colors = imgconv_palette(pu16Px, u32Num, au16Clut, pu8Idx);
+
+        if (!i32Colors)
+        {
+            ai32Bits[0] = 3;
+            ai32Bits[1] = 3;
+            ai32Bits[2] = 2;
+            free(sCopy.m_pu8RGB);
+            free(pu16Px);
+            imgconv_quantize(&sImg, ai32Bits, (E_IMGCONV_DITHER)i32Dither);
+            pu16Px = imgconv_to_rgb565(&sImg);
+            i32Colors = imgconv_palette(pu16Px, u32Num, au16Clut, pu8Idx);
+            printf("More than %d colours, quantized to RGB332.\n", DEF_IMGCONV_CLUT_MAX);
+        }
+        else
+        {
+            free(sImg.m_pu8RGB);
+            sImg = sCopy;
+        }
+
+        i32Stride = DEF_IMGCONV_ALIGN_UP(sImg.m_i32Width, i32Align);
+        u32Size = DEF_IMGCONV_ALIGN_UP(i32Colors * sizeof(uint16_t), i32Align) + i32Stride * sImg.m_i32Height;
+        pu8Out = calloc(1, u32Size);
+        memcpy(pu8Out, au16Clut, i32Colors * sizeof(uint16_t));
+
+        for (y = 0; y < sImg.m_i32Height; y++)
+        {
+            memcpy(&pu8Out[DEF_IMGCONV_ALIGN_UP(i32Colors * sizeof(uint16_t), i32Align) + (size_t)y * i32Stride],
+                   &pu8Idx[(size_t)y * sImg.m_i32Width], sImg.m_i32Width);
+        }
+
+        free(pu8Idx);
+    }
+    else
+    {
+        imgconv_quantize(&sImg, ai32Bits, (E_IMGCONV_DITHER)i32Dither);
+        pu16Px = imgconv_to_rgb565(&sImg);
+
+        if (i32Format == evDispImageQ565)
+        {
+            u32Size = imgenc_encode(&pu8Out, pu16Px, sImg.m_i32Width, sImg.m_i32Height, i32GroupRows);
+        }
+        else
+        {
+            i32Stride = DEF_IMGCONV_ALIGN_UP(sImg.m_i32Width * (int)sizeof(uint16_t), i32Align);
+            u32Size = i32Stride * sImg.m_i32Height;
+            pu8Out = calloc(1, u32Size);
+
+            for (y = 0; y < sImg.m_i32Height; y++)
+                memcpy(&pu8Out[(size_t)y * i32Stride], &pu16Px[(size_t)y * sImg.m_i32Width], sImg.m_i32Width * sizeof(uint16_t));
+        }
+    }
+
+    if (!(fp = fopen(argv[optind + 1], "wb")) || (fwrite(pu8Out, 1, u32Size, fp) != u32Size))
+    {
+        fprintf(stderr, "Cannot write %s.\n", argv[optind + 1]);
+        return 1;
+    }
+
+    fclose(fp);
+
+    if (!szHeader)
+    {
+        char *szDot;
+
+        snprintf(szHeaderBuf, sizeof(szHeaderBuf) - 2, "%s", argv[optind + 1]);
+        szDot = strrchr(szHeaderBuf, '.');
+
+        if (!szDot || strchr(szDot, '/'))
+            szDot = szHeaderBuf + strlen(szHeaderBuf);
+
+        strcpy(szDot, ".h");
+        szHeader = szHeaderBuf;
+    }
+
+    imgconv_name(szName, sizeof(szName), szPrefix ? szPrefix : argv[optind + 1]);
+
+    if (imgconv_write_header(szHeader, szName, argv[optind], (E_DISP_IMAGE_FORMAT)i32Format, sImg.m_i32Width, sImg.m_i32Height,
+                             i32Stride, i32Colors, i32Rotation, u32Size) < 0)
+        return 1;
+
+    if (szPreview && (imgconv_write_png(&sImg, szPreview) < 0))
+        return 1;
+
+    printf("%s: %dx%d %s, dither %s, %u bytes", argv[optind + 1], sImg.m_i32Width, sImg.m_i32Height,
+           s_aszFormat[i32Format], s_aszDither[i32Dither], u32Size);
+
+    if (i32Format == evDispImageCLUT8)
+        printf(", %d colours", i32Colors);
+
+    printf("\n");
+
+    free(pu8Out);
+    free(pu16Px);
+    free(sImg.m_pu8RGB);
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#!/bin/sh
+#
+# Build host/disp_imgconv.c, check its conversions round trip on the
+# example images and regenerate WQVGA1.h and WQVGA2.h, the headers
+# disp_example.c takes the raw image layout from. Needs libpng.
+#
+# Usage: host/disp_imgconv.sh
+#
+# SPDX-License-Identifier: Apache-2.0
+# @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+#
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+CC=${CC:-gcc}
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+$CC -O2 -Wall -I. host/disp_imgconv.c disp_image.c -lpng -o "$OUT/disp_imgconv"
+
+check() {
+    if cmp -s "$1" "$2"; then
+        echo "PASS: $3"
+    else
+        echo "FAIL: $3"
+        exit 1
+    fi
+}
+
+CONV="$OUT/disp_imgconv"
+
+# Raw in, raw out and PNG preview back in give the same pixels.
+$CONV -s 480x272 -p "$OUT/a.png" WQVGA1.bin "$OUT/a.bin" > /dev/null
+check WQVGA1.bin "$OUT/a.bin" "rgb565 raw round trip"
+$CONV "$OUT/a.png" "$OUT/b.bin" > /dev/null
+check WQVGA1.bin "$OUT/b.bin" "rgb565 PNG round trip"
+
+# A quarter turn each way and a half turn twice.
+$CONV -r 90 -p "$OUT/r90.png" "$OUT/a.png" "$OUT/r90.bin" > /dev/null
+$CONV -r 270 "$OUT/r90.png" "$OUT/r0.bin" > /dev/null
+check WQVGA1.bin "$OUT/r0.bin" "rotate 90 then 270"
+$CONV -r 180 -p "$OUT/r180.png" "$OUT/a.png" "$OUT/r180.bin" > /dev/null
+$CONV -r 180 "$OUT/r180.png" "$OUT/r360.bin" > /dev/null
+check WQVGA1.bin "$OUT/r360.bin" "rotate 180 twice"
+
+# q565 through the converter equals the encoder output.
+$CC -O2 -I. host/disp_imgenc.c disp_image.c -o "$OUT/disp_imgenc"
+"$OUT/disp_imgenc" WQVGA1.bin "$OUT/enc.q565" > /dev/null
+$CONV -f q565 "$OUT/a.png" "$OUT/conv.q565" > /dev/null
+check "$OUT/enc.q565" "$OUT/conv.q565" "q565"
+
+# clut8 of a quantized preview keeps the exact colours.
+for DITHER in none ordered fs; do
+    $CONV -f clut8 -d $DITHER -p "$OUT/c.png" "$OUT/a.png" "$OUT/c.bin" > /dev/null
+    $CONV -f clut8 -p "$OUT/c2.png" "$OUT/c.png" "$OUT/c2.bin" > /dev/null
+    check "$OUT/c.bin" "$OUT/c2.bin" "clut8 dither $DITHER"
+done
+
+$CONV -s 480x272 -n IMAGE1 WQVGA1.bin "$OUT/WQVGA1.bin"
+$CONV -s 480x272 -n IMAGE2 WQVGA2.bin "$OUT/WQVGA2.bin"
+cp "$OUT/WQVGA1.h" "$OUT/WQVGA2.h" .
@@ -0,0 +1,428 @@
+/**************************************************************************//**
+ * @file     disp_imgenc.c
+ * @brief    Linux host encoder of the compressed RGB565 image container.
+ *           Reads a raw little-endian RGB565 dump such as WQVGA1.bin and
+ *           writes the container disp_image.c decodes. -v decodes the result
+ *           with the target decoder three ways, as a whole, from every group
+ *           and row by row into a two-line ring, and compares each with the
+ *           input.
+ *
+ *           Build from the example folder:
+ *
+ *           gcc -O2 -I. host/disp_imgenc.c disp_image.c -o disp_imgenc
+ *
+ *           ./disp_imgenc -v WQVGA1.bin WQVGA1.q565
+ *
+ *           host/disp_imgconv.c reuses the encoder with DISP_IMGENC_LIB.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "disp_image.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_IMGENC_WIDTH         480
+#define DEF_IMGENC_HEIGHT        272
+#define DEF_IMGENC_GROUP_ROWS    16
+
+// Opcode counters of one encode
+typedef struct
+{
+    uint32_t m_u32Index;
+    uint32_t m_u32Diff;
+    uint32_t m_u32Luma;
+    uint32_t m_u32Run;
+    uint32_t m_u32RunPixels;
+    uint32_t m_u32Copy;
+    uint32_t m_u32CopyPixels;
+    uint32_t m_u32Literal;
+    uint32_t m_u32LiteralPixels;
+} S_IMGENC_STATS;
+
+// Growing output buffer
+typedef struct
+{
+    uint8_t *m_pu8Buf;
+    uint32_t m_u32Len;
+    uint32_t m_u32Cap;
+} S_IMGENC_OUT;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static S_IMGENC_STATS s_sStats;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to append a byte to the output
+static void imgenc_put(S_IMGENC_OUT *psOut, uint8_t u8Val)
+{
+    if (psOut->m_u32Len == psOut->m_u32Cap)
+    {
+        psOut->m_u32Cap = psOut->m_u32Cap ? (psOut->m_u32Cap * 2) : 4096;
+        psOut->m_pu8Buf = realloc(psOut->m_pu8Buf, psOut->m_u32Cap);
+
+        if (!psOut->m_pu8Buf)
+        {
+            fprintf(stderr, "Out of memory.\n");
+            exit(1);
+        }
+    }
+
+    psOut->m_pu8Buf[psOut->m_u32Len++] = u8Val;
+}
+
+// Function to append a little-endian pixel to the output
+static void imgenc_put_px(S_IMGENC_OUT *psOut, uint16_t u16Px)
+{
+    imgenc_put(psOut, (uint8_t)u16Px);
+    imgenc_put(psOut, (uint8_t)(u16Px >> 8));
+}
+
+// Function to get the signed difference of one channel, wrapped to its width
+static int imgenc_delta(uint32_t u32Cur, uint32_t u32Prev, int i32Bits)
+{
+    int i32Delta = (int)((u32Cur - u32Prev) & ((1u << i32Bits) - 1));
+
+    return (i32Delta >= (1 << (i32Bits - 1))) ? (i32Delta - (1 << i32Bits)) : i32Delta;
+}
+
+// Function to emit the pending literal pixels as RAW or LITERAL
+static void imgenc_flush_literal(S_IMGENC_OUT *psOut, const uint16_t *pu16Px, int i32Num)
+{
+    int i;
+
+    if (!i32Num)
+        return;
+
+    if (i32Num == 1)
+    {
+        imgenc_put(psOut, DISP_IMAGE_OP_RAW);
+    }
+    else
+    {
+        imgenc_put(psOut, DISP_IMAGE_OP_LITERAL);
+        imgenc_put(psOut, (uint8_t)(i32Num - 1));
+    }
+
+    for (i = 0; i < i32Num; i++)
+        imgenc_put_px(psOut, pu16Px[i]);
+
+    s_sStats.m_u32Literal++;
+    s_sStats.m_u32LiteralPixels += i32Num;
+}
+
+// Function to encode one row, pu16Above is NULL on the first row of a group
+static void imgenc_row(S_IMGENC_OUT *psOut, const uint16_t *pu16Row, const uint16_t *pu16Above, int i32Width,
+                       uint16_t *pu16Prev, uint16_t *pu16Index)
+{
+    uint16_t u16Prev = *pu16Prev;
+    int x = 0, i32LitStart = 0, i32LitNum = 0;
+
+    while (x < i32Width)
+    {
+        uint16_t u16Px = pu16Row[x];
+        int i32Run = 0, i32Copy = 0;
+        int i32DR, i32DG, i32DB;
+
+        while (((x + i32Run) < i32Width) && (i32Run < DISP_IMAGE_RUN_MAX) && (pu16Row[x + i32Run] == u16Prev))
+            i32Run++;
+
+        if (pu16Above)
+        {
+            while (((x + i32Copy) < i32Width) && (i32Copy < DISP_IMAGE_SPAN_MAX) && (pu16Row[x + i32Copy] == pu16Above[x + i32Copy]))
+                i32Copy++;
+        }
+
+        /* A COPY costs two bytes, it must beat a RUN and the one byte codes. */
+        if ((i32Copy >= 2) && (i32Copy > i32Run))
+        {
+            imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+            i32LitNum = 0;
+            imgenc_put(psOut, DISP_IMAGE_OP_COPY);
+            imgenc_put(psOut, (uint8_t)(i32Copy - 1));
+            s_sStats.m_u32Copy++;
+            s_sStats.m_u32CopyPixels += i32Copy;
+            x += i32Copy;
+            u16Prev = pu16Row[x - 1];
+            continue;
+        }
+
+        if (i32Run)
+        {
+            imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+            i32LitNum = 0;
+            imgenc_put(psOut, (uint8_t)(DISP_IMAGE_OP_RUN | (i32Run - 1)));
+            s_sStats.m_u32Run++;
+            s_sStats.m_u32RunPixels += i32Run;
+            x += i32Run;
+            continue;
+        }
+
+        i32DR = imgenc_delta(u16Px >> 11, u16Prev >> 11, 5);
+        i32DG = imgenc_delta((u16Px >> 5) & 0x3F, (u16Prev >> 5) & 0x3F, 6);
+        i32DB = imgenc_delta(u16Px & 0x1F, u16Prev & 0x1F, 5);
+
+        if (pu16Index[DISP_IMAGE_HASH(u16Px)] == u16Px)
+        {
+            imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+            i32LitNum = 0;
+            imgenc_put(psOut, (uint8_t)(DISP_IMAGE_OP_INDEX | DISP_IMAGE_HASH(u16Px)));
+            s_sStats.m_u32Index++;
+        }
+        else if ((i32DR >= -2) && (i32DR <= 1) && (i32DG >= -2) && (i32DG <= 1) && (i32DB >= -2) && (i32DB <= 1))
+        {
+            imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+            i32LitNum = 0;
+            imgenc_put(psOut, (uint8_t)(DISP_IMAGE_OP_DIFF | ((i32DR + 2) << 4) | ((i32DG + 2) << 2) | (i32DB + 2)));
+            pu16Index[DISP_IMAGE_HASH(u16Px)] = u16Px;
+            s_sStats.m_u32Diff++;
+        }
+        else if ((i32DG >= -32) && (i32DG <= 31) &&
+                 ((i32DR - (i32DG >> 1)) >= -8) && ((i32DR - (i32DG >> 1)) <= 7) &&
+                 ((i32DB - (i32DG >> 1)) >= -8) && ((i32DB - (i32DG >> 1)) <= 7))
+        {
+            imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+            i32LitNum = 0;
+            imgenc_put(psOut, (uint8_t)(DISP_IMAGE_OP_LUMA | (i32DG + 32)));
+            imgenc_put(psOut, (uint8_t)(((i32DR - (i32DG >> 1) + 8) << 4) | (i32DB - (i32DG >> 1) + 8)));
+            pu16Index[DISP_IMAGE_HASH(u16Px)] = u16Px;
+            s_sStats.m_u32Luma++;
+        }
+        else
+        {
+            if (i32LitNum == DISP_IMAGE_SPAN_MAX)
+            {
+                imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+                i32LitNum = 0;
+            }
+
+            if (!i32LitNum)
+                i32LitStart = x;
+
+            i32LitNum++;
+            pu16Index[DISP_IMAGE_HASH(u16Px)] = u16Px;
+        }
+
+        u16Prev = u16Px;
+        x++;
+    }
+
+    imgenc_flush_literal(psOut, &pu16Row[i32LitStart], i32LitNum);
+    *pu16Prev = u16Prev;
+}
+
+// Function to encode an image into a container, returns its size
+static uint32_t imgenc_encode(uint8_t **ppu8Image, const uint16_t *pu16Px, int i32Width, int i32Height, int i32GroupRows)
+{
+    S_DISP_IMAGE_HDR sHdr;
+    S_IMGENC_OUT sData = { 0 };
+    int i32Groups = (i32Height + i32GroupRows - 1) / i32GroupRows;
+    uint32_t *pu32Offset = calloc(i32Groups, sizeof(uint32_t));
+    uint32_t u32Size;
+    int y;
+
+    for (y = 0; y < i32Height; y++)
+    {
+        static uint16_t u16Prev;
+        static uint16_t au16Index[DISP_IMAGE_INDEX_SIZE];
+        const uint16_t *pu16Row = &pu16Px[y * i32Width];
+
+        if (!(y % i32GroupRows))
+        {
+            pu32Offset[y / i32GroupRows] = sData.m_u32Len;
+            u16Prev = 0;
+            memset(au16Index, 0, sizeof(au16Index));
+        }
+
+        imgenc_row(&sData, pu16Row, (y % i32GroupRows) ? (pu16Row - i32Width) : NULL, i32Width, &u16Prev, au16Index);
+    }
+
+    memset(&sHdr, 0, sizeof(sHdr));
+    sHdr.m_u32Magic = DISP_IMAGE_MAGIC;
+    sHdr.m_u16Width = (uint16_t)i32Width;
+    sHdr.m_u16Height = (uint16_t)i32Height;
+    sHdr.m_u16GroupRows = (uint16_t)i32GroupRows;
+    sHdr.m_u16Groups = (uint16_t)i32Groups;
+    sHdr.m_u32DataSize = sData.m_u32Len;
+
+    u32Size = sizeof(sHdr) + i32Groups * sizeof(uint32_t) + sData.m_u32Len;
+    *ppu8Image = malloc(u32Size);
+    memcpy(*ppu8Image, &sHdr, sizeof(sHdr));
+    memcpy(*ppu8Image + sizeof(sHdr), pu32Offset, i32Groups * sizeof(uint32_t));
+    memcpy(*ppu8Image + sizeof(sHdr) + i32Groups * sizeof(uint32_t), sData.m_pu8Buf, sData.m_u32Len);
+
+    free(pu32Offset);
+    free(sData.m_pu8Buf);
+
+    return u32Size;
+}
+
+#if !defined(DISP_IMGENC_LIB)
+
+// Function to decode the container back with the target decoder and compare, returns the failed checks
+static int imgenc_verify(const uint8_t *pu8Image, uint32_t u32Size, const uint16_t *pu16Px, int i32Width, int i32Height)
+{
+    S_DISP_IMAGE_DEC sDec;
+    uint32_t u32FrameSize = i32Width * i32Height * sizeof(uint16_t);
+    uint16_t *pu16Out = malloc(u32FrameSize);
+    uint16_t *pu16Ring = malloc(2 * i32Width * sizeof(uint16_t));
+    int i32Fail = 0, i32Row, y;
+
+    /* Whole image. */
+    memset(pu16Out, 0xA5, u32FrameSize);
+
+    if ((disp_image_decode(pu8Image, u32Size, pu16Out, i32Width) < 0) || memcmp(pu16Out, pu16Px, u32FrameSize))
+    {
+        printf("Verify whole image: FAIL\n");
+        i32Fail++;
+    }
+
+    /* Restart at every group, last group first. */
+    memset(pu16Out, 0xA5, u32FrameSize);
+
+    if (disp_image_open(&sDec, pu8Image, u32Size) < 0)
+        return i32Fail + 1;
+
+    for (i32Row = ((i32Height - 1) / sDec.m_psHdr->m_u16GroupRows) * sDec.m_psHdr->m_u16GroupRows;
+            i32Row >= 0; i32Row -= sDec.m_psHdr->m_u16GroupRows)
+    {
+        if ((disp_image_seek(&sDec, i32Row) != i32Row) ||
+                (disp_image_decode_rows(&sDec, &pu16Out[i32Row * i32Width], i32Width, sDec.m_psHdr->m_u16GroupRows) <= 0))
+        {
+            i32Fail++;
+            break;
+        }
+    }
+
+    if (memcmp(pu16Out, pu16Px, u32FrameSize))
+    {
+        printf("Verify group restart: FAIL\n");
+        i32Fail++;
+    }
+
+    /* Row by row into two line buffers, as a scanout line ring would. */
+    disp_image_seek(&sDec, 0);
+
+    for (y = 0; y < i32Height; y++)
+    {
+        uint16_t *pu16Line = &pu16Ring[(y & 1) * i32Width];
+
+        if ((disp_image_decode_rows(&sDec, pu16Line, i32Width, 1) != 1) ||
+                memcmp(pu16Line, &pu16Px[y * i32Width], i32Width * sizeof(uint16_t)))
+        {
+            printf("Verify line ring: FAIL at row %d\n", y);
+            i32Fail++;
+            break;
+        }
+    }
+
+    if (!i32Fail)
+        printf("Verify: whole image, group restart and line ring OK\n");
+
+    free(pu16Ring);
+    free(pu16Out);
+
+    return i32Fail;
+}
+
+// Function to print the usage
+static void imgenc_usage(const char *szName)
+{
+    printf("Usage: %s [-w width] [-h height] [-g group_rows] [-v] in.bin out.q565\n", szName);
+    printf("  -w  width in pixels (default %d)\n", DEF_IMGENC_WIDTH);
+    printf("  -h  height in pixels (default %d)\n", DEF_IMGENC_HEIGHT);
+    printf("  -g  rows per restart group (default %d)\n", DEF_IMGENC_GROUP_ROWS);
+    printf("  -v  decode the output again and compare with the input\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int i32Width = DEF_IMGENC_WIDTH, i32Height = DEF_IMGENC_HEIGHT, i32GroupRows = DEF_IMGENC_GROUP_ROWS;
+    int bVerify = 0, i32Opt, i32Ret = 0;
+    uint32_t u32RawSize, u32Size;
+    uint16_t *pu16Px;
+    uint8_t *pu8Image;
+    FILE *fp;
+
+    while ((i32Opt = getopt(argc, argv, "w:h:g:v")) != -1)
+    {
+        switch (i32Opt)
+        {
+        case 'w':
+            i32Width = atoi(optarg);
+            break;
+
+        case 'h':
+            i32Height = atoi(optarg);
+            break;
+
+        case 'g':
+            i32GroupRows = atoi(optarg);
+            break;
+
+        case 'v':
+            bVerify = 1;
+            break;
+
+        default:
+            imgenc_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (((argc - optind) != 2) || (i32Width <= 0) || (i32Width > 0xFFFF) || (i32Height <= 0) || (i32Height > 0xFFFF) ||
+            (i32GroupRows <= 0) || (i32GroupRows > i32Height))
+    {
+        imgenc_usage(argv[0]);
+        return 1;
+    }
+
+    u32RawSize = i32Width * i32Height * sizeof(uint16_t);
+    pu16Px = malloc(u32RawSize);
+
+    if (!(fp = fopen(argv[optind], "rb")) || (fread(pu16Px, 1, u32RawSize, fp) != u32RawSize))
+    {
+        fprintf(stderr, "Cannot read %u bytes from %s.\n", u32RawSize, argv[optind]);
+        return 1;
+    }
+
+    fclose(fp);
+
+    u32Size = imgenc_encode(&pu8Image, pu16Px, i32Width, i32Height, i32GroupRows);
+
+    if (!(fp = fopen(argv[optind + 1], "wb")) || (fwrite(pu8Image, 1, u32Size, fp) != u32Size))
+    {
+        fprintf(stderr, "Cannot write %s.\n", argv[optind + 1]);
+        return 1;
+    }
+
+    fclose(fp);
+
+    printf("%s: %dx%d, %u -> %u bytes (%u.%02ux), %d rows per group\n",
+           argv[optind + 1], i32Width, i32Height, u32RawSize, u32Size,
+           u32RawSize / u32Size, (u32RawSize % u32Size) * 100 / u32Size, i32GroupRows);
+    printf("  INDEX %u, DIFF %u, LUMA %u, RUN %u (%u px), COPY %u (%u px), LITERAL %u (%u px)\n",
+           s_sStats.m_u32Index, s_sStats.m_u32Diff, s_sStats.m_u32Luma,
+           s_sStats.m_u32Run, s_sStats.m_u32RunPixels,
+           s_sStats.m_u32Copy, s_sStats.m_u32CopyPixels,
+           s_sStats.m_u32Literal, s_sStats.m_u32LiteralPixels);
+
+    if (bVerify && imgenc_verify(pu8Image, u32Size, pu16Px, i32Width, i32Height))
+        i32Ret = 1;
+
+    free(pu8Image);
+    free(pu16Px);
+
+    return i32Ret;
+}
+
+#endif /* !defined(DISP_IMGENC_LIB) */
@@ -0,0 +1,217 @@
+/**************************************************************************//**
+ * @file     disp_ringbench.c
+ * @brief    Linux host benchmark of the scanout descriptor ring.
+ *           Builds the ring with the real disp_pdma_dsc_init() or
+ *           disp_gdma_dsc_init() and times the build and the blank-time
+ *           buffer switch, then prints one row of the disp_ringbench.c report.
+ *           The panel comes from disp.h or CONFIG_DISP_PANEL_OVERRIDE,
+ *           host/disp_ringbench.sh builds and runs the whole panel matrix.
+ *
+ *           Build from the example folder with the disp_sim.c flags:
+ *
+ *           gcc -O1 -no-pie -ffunction-sections -fdata-sections -Wl,--gc-sections \
+ *               -include host/include/cmsis_host.h -DM55M1 \
+ *               -Ihost/include -I. -Igdma -Ipdma \
+ *               -I../../../Library/CMSIS/Core/Include \
+ *               -I../../../Library/Device/Nuvoton/M55M1/Include \
+ *               -I../../../Library/StdDriver/inc \
+ *               host/disp_ringbench.c pdma/pdma_lib.c -o disp_ringbench_pdma
+ *
+ *           gcc ...same flags... -DDISP_SIM_GDMA host/disp_ringbench.c \
+ *               gdma/dma350_lib.c gdma/dma350_ch_drv.c \
+ *               ../../../Library/StdDriver/src/gdma/dma350_address_remap_template.c \
+ *               -o disp_ringbench_gdma
+ *
+ *           Host times are in nanoseconds of the build machine, run the
+ *           target variant (CONFIG_DISP_RINGBENCH) for M55M1 cycles.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/* Pull in the backend as one translation unit to reach its static ring builder. */
+#if defined(DISP_SIM_GDMA)
+    #include "disp_sync_gdma.c"
+#else
+    #include "disp_sync_pdma.c"
+#endif
+
+/* The VRAM buffers and the blank callback live in the backend front end. */
+#include "disp_backend.c"
+
+/* Share the report with the target variant. */
+#define DISP_RINGBENCH_HOST
+#if !defined(CONFIG_DISP_RINGBENCH)
+    #define CONFIG_DISP_RINGBENCH
+#endif
+#include "../disp_ringbench.c"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_BENCH_SCS_BASE       0xE000E000UL     /*!< System control space, read by the DMA-350 MPU lookup */
+#define DEF_BENCH_SCS_SIZE       0x1000UL
+#define DEF_BENCH_GDMA_BASE      GDMA_BASE        /*!< DMA-350 registers, touched by GDMACH1_IRQHandler */
+#define DEF_BENCH_GDMA_SIZE      0x2000UL
+#define DEF_BENCH_ITERATIONS     200
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to map one fake peripheral page
+static int bench_map(uint32_t u32Base, uint32_t u32Size)
+{
+    void *pv = mmap((void *)(uintptr_t)u32Base, u32Size,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (pv != (void *)(uintptr_t)u32Base)
+    {
+        fprintf(stderr, "Failed to map fake page at %08X.\n", u32Base);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to map the fake peripheral pages touched by the ring builders and the blank handler
+static int bench_memmap_init(void)
+{
+    if ((bench_map(DEF_BENCH_SCS_BASE, DEF_BENCH_SCS_SIZE) < 0) ||
+            (bench_map(DEF_BENCH_GDMA_BASE, DEF_BENCH_GDMA_SIZE) < 0))
+        return -1;
+
+    if (((uintptr_t)&s_sDscLCD > 0xFFFFFFFFUL) || ((uintptr_t)&g_au8FrameBuf[sizeof(g_au8FrameBuf)] > 0xFFFFFFFFUL))
+    {
+        fprintf(stderr, "Ring objects are above 4 GB, build with -no-pie.\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to build the ring once
+static void bench_build(void)
+{
+#if defined(DISP_SIM_GDMA)
+    disp_gdma_dsc_init();
+#else
+    disp_pdma_dsc_init();
+#endif
+}
+
+// Function to run the blank handler once
+static void bench_blank(void)
+{
+#if defined(DISP_SIM_GDMA)
+    GDMA_CH_DEV_S[1]->cfg.ch_base->CH_STATUS = DMA350_CH_STAT_DONE;
+    GDMACH1_IRQHandler();
+#else
+    nu_pdma_memfun_cb(NULL, NU_PDMA_EVENT_TRANSFER_DONE);
+#endif
+}
+
+// Function to print the usage
+static void bench_usage(const char *szProg)
+{
+    fprintf(stderr, "Usage: %s [-n iterations] [-p ebi_write_hz] [-q]\n", szProg);
+    fprintf(stderr, "  -n  Builds and buffer switches to time, the best one is reported (default %d).\n", DEF_BENCH_ITERATIONS);
+    fprintf(stderr, "  -p  EBI write rate used to predict the frame rate (default %d).\n", CONFIG_DISP_RINGBENCH_PCLK_HZ);
+    fprintf(stderr, "  -q  Omit the report header.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int i, opt;
+    int bHeader = 1;
+    uint32_t u32Iterations = DEF_BENCH_ITERATIONS;
+    uint32_t u32PclkHz = CONFIG_DISP_RINGBENCH_PCLK_HZ;
+    uint32_t u32BestBuild = 0xFFFFFFFF;
+    uint32_t u32BestFlip = 0xFFFFFFFF;
+    S_DISP_RINGINFO sInfo;
+    S_RINGBENCH_ROW sRow;
+
+    while ((opt = getopt(argc, argv, "n:p:qh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                u32Iterations = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'p':
+                u32PclkHz = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'q':
+                bHeader = 0;
+                break;
+
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!u32Iterations || !u32PclkHz)
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    if (bench_memmap_init() < 0)
+        return 1;
+
+    s_pu16BufAddr = (uint16_t *)g_au8FrameBuf;
+
+    /* Time the ring build, the best run filters out scheduler noise. */
+    for (i = 0; i < u32Iterations; i++)
+    {
+        uint32_t u32Start = nu_cyccnt_get();
+
+        bench_build();
+        u32Start = nu_cyccnt_get() - u32Start;
+
+        if (u32Start < u32BestBuild)
+            u32BestBuild = u32Start;
+    }
+
+#if defined(DISP_SIM_GDMA)
+    s_sRingInfo.m_u32FetchSize = gdma_dsc_fetch_size();
+#endif
+
+    /* Alternate two VRAM buffers so every blank handler call switches the ring. */
+    for (i = 0; i < u32Iterations; i++)
+    {
+        s_pu16BufAddr = (uint16_t *)&g_au8FrameBuf[(i & 1) ? 0 : CONFIG_VRAM_BUF_SIZE];
+        bench_blank();
+
+        if (s_sRingInfo.m_u32FlipCycles < u32BestFlip)
+            u32BestFlip = s_sRingInfo.m_u32FlipCycles;
+    }
+
+    /* No backend is started, read the statistics of the ring directly. */
+    sInfo = s_sRingInfo;
+    sInfo.m_u32BuildCycles = u32BestBuild;
+    sInfo.m_u32FlipMaxCycles = u32BestFlip;
+
+    if (sInfo.m_u32BlankCount != u32Iterations)
+    {
+        fprintf(stderr, "Blank handler ran %u of %u times.\n", sInfo.m_u32BlankCount, u32Iterations);
+        return 2;
+    }
+
+    if (bHeader)
+        ringbench_print_header();
+
+    ringbench_current_row(&sRow, &sInfo);
+    ringbench_print_row(&sRow, u32PclkHz);
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#!/bin/sh
+#
+# Build and run host/disp_ringbench.c for the panel matrix:
+# 480x272, 800x480 and 1024x600, DE-only and full sync, PDMA and GDMA.
+#
+# Usage: host/disp_ringbench.sh [disp_ringbench options, e.g. -p 12000000]
+#
+# SPDX-License-Identifier: Apache-2.0
+# @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+#
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+CC=${CC:-gcc}
+LIB=../../../Library
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+CFLAGS="-O1 -no-pie -ffunction-sections -fdata-sections -Wl,--gc-sections \
+        -include host/include/cmsis_host.h -DM55M1 \
+        -Ihost/include -I. -Igdma -Ipdma \
+        -I$LIB/CMSIS/Core/Include \
+        -I$LIB/Device/Nuvoton/M55M1/Include \
+        -I$LIB/StdDriver/inc"
+
+PDMA_SRCS="host/disp_ringbench.c pdma/pdma_lib.c"
+GDMA_SRCS="-DDISP_SIM_GDMA host/disp_ringbench.c gdma/dma350_lib.c gdma/dma350_ch_drv.c \
+           $LIB/StdDriver/src/gdma/dma350_address_remap_template.c"
+
+# name HACT VACT HBP HFP HPW VBP VFP VPW, keep in step with disp_ringbench.c
+PANELS="480x272:480:272:30:5:41:2:27:10
+800x480:800:480:26:210:20:13:22:10
+1024x600:1024:600:140:160:20:20:12:3"
+
+HEADER=
+for PANEL in $PANELS; do
+    set -- $(echo "$PANEL" | tr ':' ' ') "$@"
+    TIMING="-DCONFIG_DISP_PANEL_OVERRIDE \
+            -DCONFIG_TIMING_HACT=$2 -DCONFIG_TIMING_VACT=$3 \
+            -DCONFIG_TIMING_HBP=$4 -DCONFIG_TIMING_HFP=$5 -DCONFIG_TIMING_HPW=$6 \
+            -DCONFIG_TIMING_VBP=$7 -DCONFIG_TIMING_VFP=$8 -DCONFIG_TIMING_VPW=$9"
+    shift 9
+
+    for BACKEND in PDMA GDMA; do
+        for MODE in DE SYNC; do
+            EXTRA=
+            [ "$MODE" = "DE" ] && EXTRA="-DCONFIG_LCD_PANEL_USE_DE_ONLY"
+            [ "$BACKEND" = "PDMA" ] && SRCS=$PDMA_SRCS || SRCS=$GDMA_SRCS
+
+            $CC $CFLAGS $TIMING $EXTRA $SRCS -o "$OUT/bench"
+            "$OUT/bench" $HEADER "$@"
+            HEADER=-q
+        done
+    done
+done
@@ -0,0 +1,463 @@
+/**************************************************************************//**
+ * @file     disp_ringgen.c
+ * @brief    Linux host generator of the GDMA scanout ring image.
+ *           Builds the ring with the real disp_gdma_dsc_init() and writes
+ *           it as the initialized s_sDscLCD of disp_ring_image.h, which
+ *           CONFIG_DISP_RING_IMAGE places in NonCacheable.Init. Links and
+ *           the blank source become address constants, the VRAM sources a
+ *           relocation list, so the target start up is the scatter-load
+ *           copy plus one store per active line.
+ *
+ *           The SRCTRANSCFG and DESTRANSCFG words depend on the MPU of the
+ *           target. They are computed for the -d and -v addresses and the
+ *           EBI on the default memory map unless -S, -V or -E give them; the target
+ *           prints its own values and builds the ring at run time when they
+ *           differ. host/disp_ringgen.sh regenerates or checks the header.
+ *
+ *           Build from the example folder with the disp_sim.c flags:
+ *
+ *           gcc -O1 -no-pie -ffunction-sections -fdata-sections -Wl,--gc-sections \
+ *               -include host/include/cmsis_host.h -DM55M1 \
+ *               -Ihost/include -I. -Igdma -Ipdma \
+ *               -I../../../Library/CMSIS/Core/Include \
+ *               -I../../../Library/Device/Nuvoton/M55M1/Include \
+ *               -I../../../Library/StdDriver/inc \
+ *               host/disp_ringgen.c gdma/dma350_lib.c gdma/dma350_ch_drv.c \
+ *               ../../../Library/StdDriver/src/gdma/dma350_address_remap_template.c \
+ *               -o disp_ringgen
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#if defined(CONFIG_DISP_RING_IMAGE)
+    #error "Generate the ring image without CONFIG_DISP_RING_IMAGE, the generator builds the ring at run time."
+#endif
+
+/* Pull in the backend as one translation unit to reach its static ring builder. */
+#include "disp_sync_gdma.c"
+
+/* The VRAM buffers live in the backend front end. */
+#include "disp_backend.c"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_RINGGEN_SCS_BASE     0xE000E000UL     /*!< System control space, read by the DMA-350 MPU lookup */
+#define DEF_RINGGEN_SCS_SIZE     0x1000UL
+#define DEF_RINGGEN_SRAM_ADDR    0x20100000UL     /*!< RW_RAM of KEIL/M55M1.scatter, holds the blank word and the VRAM */
+
+// Kind of a ring word in the image
+typedef enum
+{
+    evRingGenWordValue,        /*!< Written as is */
+    evRingGenWordLink,         /*!< Address of a ring descriptor */
+    evRingGenWordDummy,        /*!< Address of the blank word */
+    evRingGenWordVRAM,         /*!< VRAM address, relocated at start up */
+    evRingGenWordSrcCfgDummy,  /*!< SRCTRANSCFG of a blank source */
+    evRingGenWordSrcCfgVRAM,   /*!< SRCTRANSCFG of a VRAM source */
+    evRingGenWordDesCfgEBI,    /*!< DESTRANSCFG of the EBI */
+    evRingGenWordCNT
+} E_RINGGEN_WORD;
+
+// DMA attributes baked into the image
+typedef struct
+{
+    uint32_t m_u32SrcCfgDummy;
+    uint32_t m_u32SrcCfgVRAM;
+    uint32_t m_u32DesCfgEBI;
+} S_RINGGEN_ATTR;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+static const char *const s_aszHStage[evHStageCNT] = { "HFP+HSYNC+HBP", "HACT" };
+#else
+static const char *const s_aszHStage[evHStageCNT] = { "HFP", "HSYNC", "HBP", "HACT" };
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to map the fake system control space read by the ring builder
+static int ringgen_memmap_init(void)
+{
+    void *pv = mmap((void *)(uintptr_t)DEF_RINGGEN_SCS_BASE, DEF_RINGGEN_SCS_SIZE,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (pv != (void *)(uintptr_t)DEF_RINGGEN_SCS_BASE)
+    {
+        fprintf(stderr, "Failed to map fake page at %08lX.\n", DEF_RINGGEN_SCS_BASE);
+        return -1;
+    }
+
+    if (((uintptr_t)&s_sDscLCD > 0xFFFFFFFFUL) || ((uintptr_t)&g_au8FrameBuf[sizeof(g_au8FrameBuf)] > 0xFFFFFFFFUL))
+    {
+        fprintf(stderr, "Ring objects are above 4 GB, build with -no-pie.\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to compute the transfer attributes the target would put in a descriptor
+static void ringgen_attr(uint32_t u32AddrSrc, uint32_t u32AddrDst, uint32_t *pu32SrcCfg, uint32_t *pu32DesCfg)
+{
+    struct dma350_cmdlink_gencfg_t cmdlink_cfg;
+
+    disp_cmdlink_config(&cmdlink_cfg, u32AddrSrc, u32AddrDst, 1, 0, 0);
+
+    if (pu32SrcCfg)
+        *pu32SrcCfg = cmdlink_cfg.cfg.srctranscfg;
+
+    if (pu32DesCfg)
+        *pu32DesCfg = cmdlink_cfg.cfg.destranscfg;
+}
+
+// Function to classify one ring word, returns the class or evRingGenWordCNT if the word cannot be imaged
+static E_RINGGEN_WORD ringgen_classify(uint32_t u32FieldSet, uint32_t u32Value, int i32SrcIsDummy, uint32_t *pu32Arg)
+{
+    uint32_t u32Ring = (uint32_t)(uintptr_t)&s_sDscLCD;
+    uint32_t u32VRAM = (uint32_t)(uintptr_t)g_au8FrameBuf;
+
+    switch (u32FieldSet)
+    {
+        case DMA350_CMDLINK_SRC_ADDR_SET:
+            if (u32Value == (uint32_t)(uintptr_t)&s_u32DummyData)
+                return evRingGenWordDummy;
+
+            if ((u32Value < u32VRAM) || (u32Value >= (u32VRAM + CONFIG_VRAM_BUF_SIZE)))
+                return evRingGenWordCNT;
+
+            *pu32Arg = u32Value - u32VRAM;
+            return evRingGenWordVRAM;
+
+        case DMA350_CMDLINK_SRCTRANSCFG_SET:
+            return i32SrcIsDummy ? evRingGenWordSrcCfgDummy : evRingGenWordSrcCfgVRAM;
+
+        case DMA350_CMDLINK_DESTRANSCFG_SET:
+            return evRingGenWordDesCfgEBI;
+
+        case DMA350_CMDLINK_LINKADDR_SET:
+            u32Value &= DMA_CH_LINKADDR_LINKADDR_Msk;
+
+            if ((u32Value < u32Ring) || (u32Value > (uint32_t)(uintptr_t)s_end) || ((u32Value - u32Ring) % sizeof(S_CMDBUF)))
+                return evRingGenWordCNT;
+
+            *pu32Arg = (u32Value - u32Ring) / sizeof(S_CMDBUF);
+            return evRingGenWordLink;
+
+        default:
+            return evRingGenWordValue;
+    }
+}
+
+// Function to write the words of one descriptor, returns its relocations or -1 if it cannot be imaged
+static int ringgen_write_dsc(FILE *fp, const S_CMDBUF *psDsc, uint32_t u32Dsc, uint32_t *pu32Reloc)
+{
+    const uint32_t *pu32Word = psDsc->m_cmdbuf;
+    uint32_t u32HdrVal = pu32Word[0] & ~0x3; //Start bit2
+    uint32_t u32Idx = 1;
+    int i32SrcIsDummy = 1, i32Relocs = 0;
+
+    fprintf(fp, "{ { 0x%08X", pu32Word[0]);
+
+    while (u32HdrVal)
+    {
+        uint32_t u32FieldSet = 1UL << nu_ctz(u32HdrVal);
+        uint32_t u32Value = pu32Word[u32Idx], u32Arg = 0;
+        E_RINGGEN_WORD evWord = ringgen_classify(u32FieldSet, u32Value, i32SrcIsDummy, &u32Arg);
+
+        switch (evWord)
+        {
+            case evRingGenWordValue:
+                fprintf(fp, ", 0x%08X", u32Value);
+                break;
+
+            case evRingGenWordLink:
+                if (!(u32Value & DMA_CH_LINKADDR_LINKADDREN_Msk))
+                    return -1;
+
+                fprintf(fp, ", DISP_RING_LINK(%u)", u32Arg);
+                break;
+
+            case evRingGenWordDummy:
+                fprintf(fp, ", DISP_RING_DUMMY");
+                break;
+
+            case evRingGenWordVRAM:
+                /* Patched from s_asRingReloc, no address constant reaches the start buffer. */
+                fprintf(fp, ", 0");
+                pu32Reloc[0] = u32Dsc * DEF_CMDBUF_SIZE + u32Idx;
+                pu32Reloc[1] = u32Arg;
+                i32SrcIsDummy = 0;
+                i32Relocs++;
+                break;
+
+            case evRingGenWordSrcCfgDummy:
+                fprintf(fp, ", DISP_RING_SRCCFG_DUMMY");
+                break;
+
+            case evRingGenWordSrcCfgVRAM:
+                fprintf(fp, ", DISP_RING_SRCCFG_VRAM");
+                break;
+
+            case evRingGenWordDesCfgEBI:
+                fprintf(fp, ", DISP_RING_DESCFG_EBI");
+                break;
+
+            default:
+                fprintf(stderr, "Descriptor %u word %u (%08X) cannot be imaged.\n", u32Dsc, u32Idx, u32Value);
+                return -1;
+        }
+
+        u32Idx++;
+        u32HdrVal &= (u32HdrVal - 1);
+    }
+
+    fprintf(fp, " } }");
+
+    return i32Relocs;
+}
+
+// Function to check the attribute words the image shares between descriptors are the ones the ring builder wrote
+static int ringgen_check_attr(const S_RINGGEN_ATTR *psHost)
+{
+    S_CMDBUF *next;
+
+    for (next = s_head; next <= s_end; next++)
+    {
+        const uint32_t *pu32Word = next->m_cmdbuf;
+        uint32_t u32HdrVal = pu32Word[0] & ~0x3; //Start bit2
+        uint32_t u32Idx = 1;
+        int i32SrcIsDummy = 1;
+
+        while (u32HdrVal)
+        {
+            uint32_t u32FieldSet = 1UL << nu_ctz(u32HdrVal);
+            uint32_t u32Value = pu32Word[u32Idx];
+
+            if ((u32FieldSet == DMA350_CMDLINK_SRC_ADDR_SET) && (u32Value != (uint32_t)(uintptr_t)&s_u32DummyData))
+                i32SrcIsDummy = 0;
+
+            if (((u32FieldSet == DMA350_CMDLINK_SRCTRANSCFG_SET) &&
+                    (u32Value != (i32SrcIsDummy ? psHost->m_u32SrcCfgDummy : psHost->m_u32SrcCfgVRAM))) ||
+                    ((u32FieldSet == DMA350_CMDLINK_DESTRANSCFG_SET) && (u32Value != psHost->m_u32DesCfgEBI)))
+            {
+                fprintf(stderr, "Descriptor %u has its own transfer attributes (%08X).\n", (uint32_t)(next - s_head), u32Value);
+                return -1;
+            }
+
+            u32Idx++;
+            u32HdrVal &= (u32HdrVal - 1);
+        }
+    }
+
+    return 0;
+}
+
+// Function to write the comment naming the part of the frame a descriptor scans
+static void ringgen_write_where(FILE *fp, uint32_t u32Dsc)
+{
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    if (u32Dsc == 0)
+    {
+        fprintf(fp, "   /* %4u: blank lines */\n", u32Dsc);
+        return;
+    }
+
+    u32Dsc--;
+    fprintf(fp, "   /* %4u: line %u %s */\n", u32Dsc + 1, u32Dsc / evHStageCNT, s_aszHStage[u32Dsc % evHStageCNT]);
+#else
+    fprintf(fp, "   /* %4u: line %u %s */\n", u32Dsc, u32Dsc / evHStageCNT, s_aszHStage[u32Dsc % evHStageCNT]);
+#endif
+}
+
+// Function to write disp_ring_image.h
+static int ringgen_write(FILE *fp, const S_RINGGEN_ATTR *psAttr)
+{
+    static uint32_t s_au32Reloc[DEF_TOTAL_VLINES * evHStageCNT][2];
+    uint32_t u32Dsc = 0, u32Relocs = 0, u32Line, i;
+    E_HSTAGE evH;
+    int i32Ret;
+
+    fprintf(fp, "/* Generated by host/disp_ringgen.c for %dx%d %s, do not edit. */\n", CONFIG_TIMING_HACT, CONFIG_TIMING_VACT,
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+            "DE-only"
+#else
+            "DE/HSYNC/VSYNC"
+#endif
+           );
+    fprintf(fp, "#ifndef __DISP_RING_IMAGE_H__\n#define __DISP_RING_IMAGE_H__\n\n");
+    fprintf(fp, "#define DISP_RING_IMAGE_HACT          %d   /*!< Panel the image was generated for */\n", CONFIG_TIMING_HACT);
+    fprintf(fp, "#define DISP_RING_IMAGE_VACT          %d\n", CONFIG_TIMING_VACT);
+    fprintf(fp, "#define DISP_RING_IMAGE_HBP           %d\n", CONFIG_TIMING_HBP);
+    fprintf(fp, "#define DISP_RING_IMAGE_HFP           %d\n", CONFIG_TIMING_HFP);
+    fprintf(fp, "#define DISP_RING_IMAGE_HPW           %d\n", CONFIG_TIMING_HPW);
+    fprintf(fp, "#define DISP_RING_IMAGE_VBP           %d\n", CONFIG_TIMING_VBP);
+    fprintf(fp, "#define DISP_RING_IMAGE_VFP           %d\n", CONFIG_TIMING_VFP);
+    fprintf(fp, "#define DISP_RING_IMAGE_VPW           %d\n", CONFIG_TIMING_VPW);
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    fprintf(fp, "#define DISP_RING_IMAGE_DE_ONLY       1   /*!< CONFIG_LCD_PANEL_USE_DE_ONLY */\n");
+#else
+    fprintf(fp, "#define DISP_RING_IMAGE_DE_ONLY       0   /*!< CONFIG_LCD_PANEL_USE_DE_ONLY */\n");
+#endif
+    fprintf(fp, "#define DISP_RING_IMAGE_EBI_ADDR      0x%08XUL   /*!< CONFIG_DISP_EBI_ADDR */\n", (uint32_t)CONFIG_DISP_EBI_ADDR);
+    fprintf(fp, "#define DISP_RING_IMAGE_DSC_NUM       %u   /*!< Descriptors in the ring */\n", (uint32_t)(s_end - s_head + 1));
+    fprintf(fp, "#define DISP_RING_IMAGE_FETCH_SIZE    %u   /*!< Bytes the DMA fetches to walk the ring once */\n", gdma_dsc_fetch_size());
+    fprintf(fp, "#define DISP_RING_IMAGE_RELOC_NUM     %d   /*!< VRAM sources patched at start up */\n\n", CONFIG_TIMING_VACT);
+    fprintf(fp, "#define DISP_RING_SRCCFG_DUMMY        0x%08XUL   /*!< SRCTRANSCFG of the blank word */\n", psAttr->m_u32SrcCfgDummy);
+    fprintf(fp, "#define DISP_RING_SRCCFG_VRAM         0x%08XUL   /*!< SRCTRANSCFG of the VRAM */\n", psAttr->m_u32SrcCfgVRAM);
+    fprintf(fp, "#define DISP_RING_DESCFG_EBI          0x%08XUL   /*!< DESTRANSCFG of the EBI */\n\n", psAttr->m_u32DesCfgEBI);
+
+    fprintf(fp, "/* Header word, then one word per register set in the header. */\n");
+    fprintf(fp, "DISP_RING_IMAGE_SECTION static S_DSC_LCD s_sDscLCD =\n{\n");
+
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    fprintf(fp, "    ");
+
+    if ((i32Ret = ringgen_write_dsc(fp, &s_sDscLCD.m_dscDummy, u32Dsc, s_au32Reloc[u32Relocs])) < 0)
+        return -1;
+
+    u32Relocs += (uint32_t)i32Ret;
+    fprintf(fp, ",");
+    ringgen_write_where(fp, u32Dsc++);
+#endif
+    fprintf(fp, "    {\n");
+
+    for (u32Line = 0; u32Line < DEF_TOTAL_VLINES; u32Line++)
+    {
+        fprintf(fp, "        { {\n");
+
+        for (evH = 0; evH < evHStageCNT; evH++)
+        {
+            fprintf(fp, "            ");
+
+            if ((i32Ret = ringgen_write_dsc(fp, &s_sDscLCD.m_dscV[u32Line].m_dscH[evH], u32Dsc, s_au32Reloc[u32Relocs])) < 0)
+                return -1;
+
+            u32Relocs += (uint32_t)i32Ret;
+            fprintf(fp, ",");
+            ringgen_write_where(fp, u32Dsc++);
+        }
+
+        fprintf(fp, "        } },\n");
+    }
+
+    fprintf(fp, "    }\n};\n\n");
+
+    if (u32Relocs != CONFIG_TIMING_VACT)
+    {
+        fprintf(stderr, "%u VRAM sources in the ring, expected %d.\n", u32Relocs, CONFIG_TIMING_VACT);
+        return -1;
+    }
+
+    fprintf(fp, "/* Ring word and VRAM buffer byte offset of each active line source. */\n");
+    fprintf(fp, "static const S_RINGRELOC s_asRingReloc[DISP_RING_IMAGE_RELOC_NUM] =\n{\n");
+
+    for (i = 0; i < u32Relocs; i++)
+        fprintf(fp, "    { %5u, 0x%06X },\n", s_au32Reloc[i][0], s_au32Reloc[i][1]);
+
+    fprintf(fp, "};\n\n#endif /* __DISP_RING_IMAGE_H__ */\n");
+
+    return 0;
+}
+
+// Function to print the usage
+static void ringgen_usage(const char *szProg)
+{
+    fprintf(stderr, "Usage: %s [options] [out.h]\n", szProg);
+    fprintf(stderr, "  -d  target address of the blank word (default 0x%08lX)\n", DEF_RINGGEN_SRAM_ADDR);
+    fprintf(stderr, "  -v  target address of the VRAM (default 0x%08lX)\n", DEF_RINGGEN_SRAM_ADDR);
+    fprintf(stderr, "  -S  SRCTRANSCFG of the blank word, overrides -d\n");
+    fprintf(stderr, "  -V  SRCTRANSCFG of the VRAM, overrides -v\n");
+    fprintf(stderr, "  -E  DESTRANSCFG of the EBI\n");
+    fprintf(stderr, "  The header goes to stdout without out.h.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int opt, i32Ret;
+    uint32_t u32AddrDummy = DEF_RINGGEN_SRAM_ADDR;
+    uint32_t u32AddrVRAM = DEF_RINGGEN_SRAM_ADDR;
+    int bSrcCfgDummy = 0, bSrcCfgVRAM = 0, bDesCfgEBI = 0;
+    S_RINGGEN_ATTR sAttr, sHost;
+    FILE *fp = stdout;
+
+    while ((opt = getopt(argc, argv, "d:v:S:V:E:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'd':
+                u32AddrDummy = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'v':
+                u32AddrVRAM = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'S':
+                sAttr.m_u32SrcCfgDummy = (uint32_t)strtoul(optarg, NULL, 0);
+                bSrcCfgDummy = 1;
+                break;
+
+            case 'V':
+                sAttr.m_u32SrcCfgVRAM = (uint32_t)strtoul(optarg, NULL, 0);
+                bSrcCfgVRAM = 1;
+                break;
+
+            case 'E':
+                sAttr.m_u32DesCfgEBI = (uint32_t)strtoul(optarg, NULL, 0);
+                bDesCfgEBI = 1;
+                break;
+
+            default:
+                ringgen_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (ringgen_memmap_init() < 0)
+        return 1;
+
+    /* The target addresses only select the attributes, the MPU of the host run is off. */
+    if (!bSrcCfgDummy)
+        ringgen_attr(u32AddrDummy, CONFIG_DISP_EBI_ADDR, &sAttr.m_u32SrcCfgDummy, NULL);
+
+    if (!bSrcCfgVRAM)
+        ringgen_attr(u32AddrVRAM, CONFIG_DISP_EBI_ADDR, &sAttr.m_u32SrcCfgVRAM, NULL);
+
+    if (!bDesCfgEBI)
+        ringgen_attr(u32AddrDummy, CONFIG_DISP_EBI_ADDR, NULL, &sAttr.m_u32DesCfgEBI);
+
+    s_pu16BufAddr = (uint16_t *)g_au8FrameBuf;
+    disp_gdma_dsc_init();
+
+    /* Every descriptor must use the attributes of its class, the image names them once. */
+    ringgen_attr((uint32_t)(uintptr_t)&s_u32DummyData, CONFIG_DISP_EBI_ADDR, &sHost.m_u32SrcCfgDummy, &sHost.m_u32DesCfgEBI);
+    ringgen_attr((uint32_t)(uintptr_t)g_au8FrameBuf, CONFIG_DISP_EBI_ADDR, &sHost.m_u32SrcCfgVRAM, NULL);
+
+    if (ringgen_check_attr(&sHost) < 0)
+        return 2;
+
+    if ((optind < argc) && !(fp = fopen(argv[optind], "w")))
+    {
+        fprintf(stderr, "Cannot write %s.\n", argv[optind]);
+        return 1;
+    }
+
+    i32Ret = ringgen_write(fp, &sAttr);
+
+    if (fp != stdout)
+        fclose(fp);
+
+    return (i32Ret < 0) ? 2 : 0;
+}
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# Build host/disp_ringgen.c for the panel of disp.h and regenerate
+# disp_ring_image.h, the GDMA ring image CONFIG_DISP_RING_IMAGE starts from.
+# With -c the header is only compared with a fresh image, so a change of the
+# ring layout shows up without the target.
+#
+# Usage: host/disp_ringgen.sh [-c] [disp_ringgen options, e.g. -E 0x000F0000]
+#        DEFS="-DCONFIG_DISP_PANEL_OVERRIDE ..." host/disp_ringgen.sh for
+#        a panel given on the command line, as host/disp_ringbench.sh does
+#
+# SPDX-License-Identifier: Apache-2.0
+# @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+#
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+CC=${CC:-gcc}
+LIB=../../../Library
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+CHECK=
+if [ "$1" = "-c" ]; then
+    CHECK=1
+    shift
+fi
+
+$CC -O1 -no-pie -ffunction-sections -fdata-sections -Wl,--gc-sections \
+    -include host/include/cmsis_host.h -DM55M1 $DEFS \
+    -Ihost/include -I. -Igdma -Ipdma \
+    -I$LIB/CMSIS/Core/Include \
+    -I$LIB/Device/Nuvoton/M55M1/Include \
+    -I$LIB/StdDriver/inc \
+    host/disp_ringgen.c gdma/dma350_lib.c gdma/dma350_ch_drv.c \
+    $LIB/StdDriver/src/gdma/dma350_address_remap_template.c \
+    -o "$OUT/disp_ringgen"
+
+"$OUT/disp_ringgen" "$@" "$OUT/disp_ring_image.h"
+
+if [ -z "$CHECK" ]; then
+    cp "$OUT/disp_ring_image.h" disp_ring_image.h
+    echo "disp_ring_image.h regenerated."
+elif cmp -s "$OUT/disp_ring_image.h" disp_ring_image.h; then
+    echo "PASS: disp_ring_image.h matches the ring builder"
+else
+    diff -u disp_ring_image.h "$OUT/disp_ring_image.h" | head -40
+    echo "FAIL: disp_ring_image.h is stale, run host/disp_ringgen.sh"
+    exit 1
+fi
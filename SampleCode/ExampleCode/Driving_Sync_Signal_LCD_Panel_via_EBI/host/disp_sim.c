@@ -0,0 +1,771 @@
+/**************************************************************************//**
+ * @file     disp_sim.c
+ * @brief    Linux host waveform simulator for the scanout descriptor rings.
+ *           Builds the ring with the real disp_pdma_dsc_init() or
+ *           disp_gdma_dsc_init(), walks the PDMA DSCT_T chain or the DMA-350
+ *           cmdlink chain and replays every EBI write as one pixel clock.
+ *           The EBI address bits selected by CONFIG_DISP_*_BITIDX are decoded
+ *           back into DE/HSYNC/VSYNC pin levels and dumped as a VCD file plus
+ *           per-line timing counts and a waveform signature.
+ *
+ *           Build from the example folder. Use -DDISP_SIM_GDMA for the GDMA
+ *           backend, the default is PDMA:
+ *
+ *           gcc -O1 -no-pie -ffunction-sections -fdata-sections -Wl,--gc-sections \
+ *               -include host/include/cmsis_host.h -DM55M1 \
+ *               -Ihost/include -I. -Igdma -Ipdma \
+ *               -I../../../Library/CMSIS/Core/Include \
+ *               -I../../../Library/Device/Nuvoton/M55M1/Include \
+ *               -I../../../Library/StdDriver/inc \
+ *               host/disp_sim.c pdma/pdma_lib.c -o disp_sim_pdma
+ *
+ *           gcc ...same flags... -DDISP_SIM_GDMA host/disp_sim.c \
+ *               gdma/dma350_lib.c gdma/dma350_ch_drv.c \
+ *               ../../../Library/StdDriver/src/gdma/dma350_address_remap_template.c \
+ *               -o disp_sim_gdma
+ *
+ *           Add -DCONFIG_DISP_PROBE to time the ring build with the probes of
+ *           disp_probe.h, the host mock of the PMU reports no events.
+ *
+ *           -no-pie keeps every static object below 4 GB, so the 32-bit
+ *           addresses the ring builders store can be dereferenced as-is.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/* Pull in the backend as one translation unit to reach its static ring builder. */
+#if defined(DISP_SIM_GDMA)
+    #include "disp_sync_gdma.c"
+    #define DEF_SIM_BACKEND_NAME    "GDMA"
+#else
+    #include "disp_sync_pdma.c"
+    #define DEF_SIM_BACKEND_NAME    "PDMA"
+#endif
+
+/* The VRAM buffers live in the backend front end. */
+#include "disp_backend.c"
+
+#if defined(CONFIG_DISP_PROBE)
+    #include "disp_probe.c"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define DEF_SIM_EBI_BASE         (EBI_BANK0_BASE_ADDR + (CONFIG_DISP_EBI * EBI_MAX_SIZE))
+#define DEF_SIM_SCS_BASE         0xE000E000UL     /*!< System control space, read by the DMA-350 MPU lookup */
+#define DEF_SIM_SCS_SIZE         0x1000UL
+#define DEF_SIM_MAX_LINES        4096
+
+// Pin levels of one EBI write
+typedef struct
+{
+    uint8_t  m_u8DE;
+    uint8_t  m_u8HSYNC;
+    uint8_t  m_u8VSYNC;
+    uint8_t  m_u8IRQ;
+    uint16_t m_u16Data;
+} S_SIM_PINS;
+
+// Timing counts of one line, a line starts at the HSYNC (or DE in DE-only mode) active edge
+typedef struct
+{
+    uint64_t m_u64Start;
+    uint32_t m_u32Period;
+    uint32_t m_u32DE;
+    uint32_t m_u32HSYNC;
+    uint32_t m_u32VSYNC;
+    uint32_t m_u32DEOffset;
+} S_SIM_LINE;
+
+typedef struct
+{
+    FILE       *m_fpVCD;
+    uint32_t    m_u32ClkNs;
+    uint64_t    m_u64Clk;
+    uint64_t    m_u64FrameClk;
+    uint32_t    m_u32Crc;
+    uint32_t    m_u32DataErr;
+    uint32_t    m_u32NonEBI;
+    uint32_t    m_u32IRQ;
+    uint32_t    m_u32Dsc;
+    S_SIM_PINS  m_sLast;
+    int         m_bFirst;
+    int         m_bNewFrame;
+    uint32_t    m_u32Row;
+    uint32_t    m_u32Col;
+    int         m_bInLine;
+    S_SIM_LINE  m_sLine;
+    uint32_t    m_u32LineNum;
+    S_SIM_LINE *m_psLines;
+} S_SIM_CTX;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static S_SIM_CTX s_sSim;
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to map the fake peripheral pages touched by the ring builders
+static int sim_memmap_init(void)
+{
+    void *pvSCS = mmap((void *)DEF_SIM_SCS_BASE, DEF_SIM_SCS_SIZE,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (pvSCS != (void *)DEF_SIM_SCS_BASE)
+    {
+        fprintf(stderr, "Failed to map fake SCS page at %08lX.\n", DEF_SIM_SCS_BASE);
+        return -1;
+    }
+
+    /* MPU->CTRL reads zero, the DMA-350 library uses the default memory map. */
+    if (((uintptr_t)&s_sDscLCD > 0xFFFFFFFFUL) || ((uintptr_t)&g_au8FrameBuf[sizeof(g_au8FrameBuf)] > 0xFFFFFFFFUL))
+    {
+        fprintf(stderr, "Ring objects are above 4 GB, build with -no-pie.\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to translate a 32-bit bus address into a host pointer
+static inline const void *sim_addr(uint32_t u32Addr)
+{
+    return (const void *)(uintptr_t)u32Addr;
+}
+
+// Function to fill the VRAM with a pattern encoding the pixel position
+static void sim_vram_pattern(void)
+{
+    uint16_t *pu16Buf = (uint16_t *)g_au8FrameBuf;
+    uint32_t x, y;
+
+    for (y = 0; y < CONFIG_TIMING_VACT; y++)
+    {
+        for (x = 0; x < CONFIG_TIMING_HACT; x++)
+        {
+            pu16Buf[y * CONFIG_TIMING_HACT + x] = (uint16_t)((y << 10) ^ x);
+        }
+    }
+}
+
+// Function to load a raw RGB565 image into the VRAM
+static int sim_vram_load(const char *szPath)
+{
+    FILE *fp = fopen(szPath, "rb");
+    size_t sz;
+
+    if (!fp)
+    {
+        perror(szPath);
+        return -1;
+    }
+
+    sz = fread(g_au8FrameBuf, 1, CONFIG_VRAM_BUF_SIZE, fp);
+    fclose(fp);
+
+    if (sz != CONFIG_VRAM_BUF_SIZE)
+    {
+        fprintf(stderr, "%s: short image (%u of %u bytes).\n", szPath, (uint32_t)sz, (uint32_t)CONFIG_VRAM_BUF_SIZE);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Function to update CRC32 (reflected, 0xEDB88320) with one byte
+static uint32_t sim_crc32_byte(uint32_t u32Crc, uint8_t u8Data)
+{
+    int i;
+
+    u32Crc ^= u8Data;
+
+    for (i = 0; i < 8; i++)
+        u32Crc = (u32Crc >> 1) ^ (0xEDB88320UL & (0 - (u32Crc & 1)));
+
+    return u32Crc;
+}
+
+// Function to emit the VCD header
+static void sim_vcd_header(FILE *fp)
+{
+    fprintf(fp, "$comment EBI sync-panel scanout, backend %s $end\n", DEF_SIM_BACKEND_NAME);
+    fprintf(fp, "$timescale 1ns $end\n");
+    fprintf(fp, "$scope module disp $end\n");
+    fprintf(fp, "$var wire 1 d DE $end\n");
+    fprintf(fp, "$var wire 1 h HSYNC $end\n");
+    fprintf(fp, "$var wire 1 v VSYNC $end\n");
+    fprintf(fp, "$var wire 1 i IRQ $end\n");
+    fprintf(fp, "$var wire 16 p DATA $end\n");
+    fprintf(fp, "$upscope $end\n");
+    fprintf(fp, "$enddefinitions $end\n");
+}
+
+// Function to emit a 16-bit VCD vector
+static void sim_vcd_vector(FILE *fp, uint16_t u16Val)
+{
+    int i;
+
+    fputc('b', fp);
+
+    for (i = 15; i >= 0; i--)
+        fputc((u16Val & (1 << i)) ? '1' : '0', fp);
+
+    fputs(" p\n", fp);
+}
+
+// Function to convert a pin level into the logical active state
+static inline int sim_is_active(uint8_t u8Level, int bActiveLow)
+{
+    return bActiveLow ? !u8Level : u8Level;
+}
+
+// Function to close the line being measured
+static void sim_line_close(S_SIM_CTX *psCtx)
+{
+    if (!psCtx->m_bInLine)
+        return;
+
+    psCtx->m_sLine.m_u32Period = (uint32_t)(psCtx->m_u64Clk - psCtx->m_sLine.m_u64Start);
+
+    if (psCtx->m_u32LineNum < DEF_SIM_MAX_LINES)
+        psCtx->m_psLines[psCtx->m_u32LineNum] = psCtx->m_sLine;
+
+    psCtx->m_u32LineNum++;
+    psCtx->m_bInLine = 0;
+}
+
+// Function to account one pixel clock
+static void sim_clock(S_SIM_CTX *psCtx, const S_SIM_PINS *psPins)
+{
+    int bDE = sim_is_active(psPins->m_u8DE, CONFIG_DISP_DE_ACTIVE_LOW);
+    int bHS = sim_is_active(psPins->m_u8HSYNC, CONFIG_DISP_HPW_ACTIVE_LOW);
+    int bVS = sim_is_active(psPins->m_u8VSYNC, CONFIG_DISP_VPW_ACTIVE_LOW);
+    int bLastDE = sim_is_active(psCtx->m_sLast.m_u8DE, CONFIG_DISP_DE_ACTIVE_LOW);
+    int bLastHS = sim_is_active(psCtx->m_sLast.m_u8HSYNC, CONFIG_DISP_HPW_ACTIVE_LOW);
+    int bLineStart;
+
+    /* Value change dump. */
+    if (psCtx->m_fpVCD)
+    {
+        FILE *fp = psCtx->m_fpVCD;
+        int bTime = 0;
+
+#define SIM_VCD_TIME()  do { if (!bTime) { fprintf(fp, "#%llu\n", (unsigned long long)(psCtx->m_u64Clk * psCtx->m_u32ClkNs)); bTime = 1; } } while (0)
+
+        if (psCtx->m_bFirst || psPins->m_u8DE != psCtx->m_sLast.m_u8DE)
+        {
+            SIM_VCD_TIME();
+            fprintf(fp, "%ud\n", psPins->m_u8DE);
+        }
+
+        if (psCtx->m_bFirst || psPins->m_u8HSYNC != psCtx->m_sLast.m_u8HSYNC)
+        {
+            SIM_VCD_TIME();
+            fprintf(fp, "%uh\n", psPins->m_u8HSYNC);
+        }
+
+        if (psCtx->m_bFirst || psPins->m_u8VSYNC != psCtx->m_sLast.m_u8VSYNC)
+        {
+            SIM_VCD_TIME();
+            fprintf(fp, "%uv\n", psPins->m_u8VSYNC);
+        }
+
+        if (psCtx->m_bFirst || psPins->m_u8IRQ != psCtx->m_sLast.m_u8IRQ)
+        {
+            SIM_VCD_TIME();
+            fprintf(fp, "%ui\n", psPins->m_u8IRQ);
+        }
+
+        if (psCtx->m_bFirst || psPins->m_u16Data != psCtx->m_sLast.m_u16Data)
+        {
+            SIM_VCD_TIME();
+            sim_vcd_vector(fp, psPins->m_u16Data);
+        }
+
+#undef SIM_VCD_TIME
+    }
+
+    /* Line segmentation. */
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    bLineStart = bDE && (psCtx->m_bFirst || !bLastDE);
+#else
+    bLineStart = bHS && (psCtx->m_bFirst || !bLastHS);
+#endif
+
+    if (bLineStart)
+    {
+        sim_line_close(psCtx);
+        memset(&psCtx->m_sLine, 0, sizeof(psCtx->m_sLine));
+        psCtx->m_sLine.m_u64Start = psCtx->m_u64Clk;
+        psCtx->m_sLine.m_u32DEOffset = 0xFFFFFFFF;
+        psCtx->m_bInLine = 1;
+    }
+
+    if (psCtx->m_bInLine)
+    {
+        if (bDE)
+        {
+            if (psCtx->m_sLine.m_u32DEOffset == 0xFFFFFFFF)
+                psCtx->m_sLine.m_u32DEOffset = (uint32_t)(psCtx->m_u64Clk - psCtx->m_sLine.m_u64Start);
+
+            psCtx->m_sLine.m_u32DE++;
+        }
+
+        if (bHS)
+            psCtx->m_sLine.m_u32HSYNC++;
+
+        if (bVS)
+            psCtx->m_sLine.m_u32VSYNC++;
+    }
+
+    /* Check pixel order against the VRAM pattern. */
+    if (bDE)
+    {
+        if (psCtx->m_bFirst || !bLastDE)
+        {
+            /* A new active line, the first one after the ring head is row 0. */
+            psCtx->m_u32Row = psCtx->m_bNewFrame ? 0 : (psCtx->m_u32Row + 1);
+            psCtx->m_u32Col = 0;
+            psCtx->m_bNewFrame = 0;
+        }
+
+        if (psCtx->m_u32Row < CONFIG_TIMING_VACT && psCtx->m_u32Col < CONFIG_TIMING_HACT)
+        {
+            uint16_t u16Expect = ((const uint16_t *)disp_get_vrambufaddr())[psCtx->m_u32Row * CONFIG_TIMING_HACT + psCtx->m_u32Col];
+
+            if (u16Expect != psPins->m_u16Data)
+                psCtx->m_u32DataErr++;
+        }
+        else
+        {
+            psCtx->m_u32DataErr++;
+        }
+
+        psCtx->m_u32Col++;
+    }
+
+    (void)bLastHS;
+
+    /* Waveform signature over pin levels and data. */
+    psCtx->m_u32Crc = sim_crc32_byte(psCtx->m_u32Crc, (uint8_t)(psPins->m_u8DE | (psPins->m_u8HSYNC << 1) | (psPins->m_u8VSYNC << 2) | (psPins->m_u8IRQ << 3)));
+    psCtx->m_u32Crc = sim_crc32_byte(psCtx->m_u32Crc, (uint8_t)(psPins->m_u16Data & 0xFF));
+    psCtx->m_u32Crc = sim_crc32_byte(psCtx->m_u32Crc, (uint8_t)(psPins->m_u16Data >> 8));
+
+    psCtx->m_sLast = *psPins;
+    psCtx->m_bFirst = 0;
+    psCtx->m_u64Clk++;
+}
+
+// Function to replay a run of EBI writes
+static void sim_ebi_write(S_SIM_CTX *psCtx, uint32_t u32Src, int32_t i32SrcInc, uint32_t u32Dst, int32_t i32DstInc,
+                          uint32_t u32Width, uint32_t u32Count, int bFill, uint32_t u32FillVal, int bIRQ)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < u32Count; i++)
+    {
+        uint32_t u32Off = u32Dst - DEF_SIM_EBI_BASE;
+        uint32_t u32Val = 0;
+        S_SIM_PINS sPins;
+
+        if ((u32Dst < DEF_SIM_EBI_BASE) || (u32Off >= EBI_MAX_SIZE))
+        {
+            psCtx->m_u32NonEBI++;
+            continue;
+        }
+
+        if (bFill)
+            u32Val = u32FillVal;
+        else if (u32Width == 1)
+            u32Val = *(const uint8_t *)sim_addr(u32Src);
+        else if (u32Width == 2)
+            u32Val = *(const uint16_t *)sim_addr(u32Src);
+        else
+            u32Val = *(const uint32_t *)sim_addr(u32Src);
+
+        sPins.m_u8DE = (u32Off >> CONFIG_DISP_DE_BITIDX) & 1;
+        sPins.m_u8HSYNC = (u32Off >> CONFIG_DISP_HSYNC_BITIDX) & 1;
+        sPins.m_u8VSYNC = (u32Off >> CONFIG_DISP_VSYNC_BITIDX) & 1;
+
+        /* The 16-bit EBI splits wider beats into half-word cycles. */
+        for (j = 0; j < ((u32Width + 1) / 2); j++)
+        {
+            sPins.m_u16Data = (uint16_t)(u32Val >> (16 * j));
+            sPins.m_u8IRQ = (bIRQ && (i == u32Count - 1) && (j == ((u32Width + 1) / 2) - 1)) ? 1 : 0;
+            sim_clock(psCtx, &sPins);
+        }
+
+        u32Src += i32SrcInc * (int32_t)u32Width;
+        u32Dst += i32DstInc * (int32_t)u32Width;
+    }
+}
+
+#if defined(DISP_SIM_GDMA)
+
+// Function to replay one DMA-350 command, returns the next command address or 0.
+static uint32_t sim_run_dsc(S_SIM_CTX *psCtx, uint32_t u32Dsc, struct dma350_cmdlink_reg_t *psReg)
+{
+    const uint32_t *pu32Cmd = (const uint32_t *)sim_addr(u32Dsc);
+    uint32_t u32Hdr = *pu32Cmd++;
+    uint32_t *pu32Reg = (uint32_t *)psReg;
+    uint32_t u32Width, u32SrcX, u32DstX, u32XType;
+    int32_t i32SrcInc, i32DstInc;
+    int i;
+
+    if (u32Hdr & DMA350_CMDLINK_REGCLEAR_SET)
+    {
+        struct dma350_cmdlink_gencfg_t sDefault;
+
+        dma350_cmdlink_init(&sDefault);
+        *psReg = sDefault.cfg;
+    }
+
+    /* Load the registers flagged in the header, field order follows the header bits. */
+    for (i = 2; i < 32; i++)
+    {
+        if (u32Hdr & (1UL << i))
+            pu32Reg[i - 2] = *pu32Cmd++;
+    }
+
+    u32Width = 1UL << ((psReg->ctrl & DMA_CH_CTRL_TRANSIZE_Msk) >> DMA_CH_CTRL_TRANSIZE_Pos);
+    u32XType = psReg->ctrl & DMA_CH_CTRL_XTYPE_Msk;
+    u32SrcX = (psReg->xsize & DMA_CH_XSIZE_SRCXSIZE_Msk) | ((psReg->xsizehi & DMA_CH_XSIZEHI_SRCXSIZEHI_Msk) << 16);
+    u32DstX = ((psReg->xsize & DMA_CH_XSIZE_DESXSIZE_Msk) >> 16) | (psReg->xsizehi & DMA_CH_XSIZEHI_DESXSIZEHI_Msk);
+    i32SrcInc = (int16_t)(psReg->xaddrinc & DMA_CH_XADDRINC_SRCXADDRINC_Msk);
+    i32DstInc = (int16_t)(psReg->xaddrinc >> DMA_CH_XADDRINC_DESXADDRINC_Pos);
+
+    if ((psReg->ctrl & DMA_CH_CTRL_YTYPE_Msk) != DMA350_CH_YTYPE_DISABLE)
+        fprintf(stderr, "Command %08X: 2D commands are not simulated.\n", u32Dsc);
+
+    if (u32XType == DMA350_CH_XTYPE_FILL)
+    {
+        uint32_t u32Copy = (u32SrcX < u32DstX) ? u32SrcX : u32DstX;
+
+        sim_ebi_write(psCtx, psReg->srcaddr, i32SrcInc, psReg->desaddr, i32DstInc, u32Width, u32Copy, 0, 0,
+                      (u32Copy == u32DstX) && (psReg->intren & DMA350_CH_INTREN_DONE));
+        sim_ebi_write(psCtx, 0, 0, psReg->desaddr + u32Copy * i32DstInc * u32Width, i32DstInc, u32Width, u32DstX - u32Copy, 1, psReg->fillval,
+                      psReg->intren & DMA350_CH_INTREN_DONE);
+    }
+    else if (u32XType == DMA350_CH_XTYPE_WRAP)
+    {
+        uint32_t u32Done = 0;
+
+        while (u32Done < u32DstX)
+        {
+            uint32_t u32Run = ((u32DstX - u32Done) < u32SrcX) ? (u32DstX - u32Done) : u32SrcX;
+
+            sim_ebi_write(psCtx, psReg->srcaddr, i32SrcInc, psReg->desaddr + u32Done * i32DstInc * u32Width, i32DstInc, u32Width, u32Run, 0, 0,
+                          ((u32Done + u32Run) == u32DstX) && (psReg->intren & DMA350_CH_INTREN_DONE));
+            u32Done += u32Run;
+        }
+    }
+    else if (u32XType == DMA350_CH_XTYPE_CONTINUE)
+    {
+        if (u32SrcX != u32DstX)
+            fprintf(stderr, "Command %08X: SRCXSIZE %u != DESXSIZE %u.\n", u32Dsc, u32SrcX, u32DstX);
+
+        sim_ebi_write(psCtx, psReg->srcaddr, i32SrcInc, psReg->desaddr, i32DstInc, u32Width, u32DstX, 0, 0,
+                      psReg->intren & DMA350_CH_INTREN_DONE);
+    }
+
+    if (psReg->intren & DMA350_CH_INTREN_DONE)
+        psCtx->m_u32IRQ++;
+
+    return (psReg->linkaddr & DMA_CH_LINKADDR_LINKADDREN_Msk) ? (psReg->linkaddr & DMA_CH_LINKADDR_LINKADDR_Msk) : 0;
+}
+
+#else
+
+// Function to replay one PDMA descriptor, returns the next descriptor address or 0.
+static uint32_t sim_run_dsc(S_SIM_CTX *psCtx, uint32_t u32Dsc, void *pvUnused)
+{
+    const DSCT_T *psDsc = (const DSCT_T *)sim_addr(u32Dsc);
+    uint32_t u32Ctl = psDsc->CTL;
+    uint32_t u32Count = ((u32Ctl & PDMA_DSCT_CTL_TXCNT_Msk) >> PDMA_DSCT_CTL_TXCNT_Pos) + 1;
+    uint32_t u32Width = 1UL << ((u32Ctl & PDMA_DSCT_CTL_TXWIDTH_Msk) >> PDMA_DSCT_CTL_TXWIDTH_Pos);
+    int32_t i32SrcInc = ((u32Ctl & PDMA_DSCT_CTL_SAINC_Msk) == PDMA_SAR_FIX) ? 0 : 1;
+    int32_t i32DstInc = ((u32Ctl & PDMA_DSCT_CTL_DAINC_Msk) == PDMA_DAR_FIX) ? 0 : 1;
+    int bIRQ = !(u32Ctl & PDMA_DSCT_CTL_TBINTDIS_Msk);
+
+    (void)pvUnused;
+
+    if ((u32Ctl & PDMA_DSCT_CTL_OPMODE_Msk) == PDMA_OP_STOP)
+        return 0;
+
+    sim_ebi_write(psCtx, psDsc->SA, i32SrcInc, psDsc->DA, i32DstInc, u32Width, u32Count, 0, 0, bIRQ);
+
+    if (bIRQ)
+        psCtx->m_u32IRQ++;
+
+    return ((u32Ctl & PDMA_DSCT_CTL_OPMODE_Msk) == PDMA_OP_SCATTER) ? psDsc->NEXT : 0;
+}
+
+#endif
+
+// Function to print the timing report
+static void sim_report(S_SIM_CTX *psCtx, FILE *fpLines, uint32_t u32Frames, uint32_t u32PclkHz)
+{
+    uint32_t i, j, u32Shapes = 0;
+    uint32_t u32Num = (psCtx->m_u32LineNum < DEF_SIM_MAX_LINES) ? psCtx->m_u32LineNum : DEF_SIM_MAX_LINES;
+    S_SIM_LINE *psShape = calloc(u32Num + 1, sizeof(S_SIM_LINE));
+    uint32_t *pu32ShapeCnt = calloc(u32Num + 1, sizeof(uint32_t));
+
+    printf("Backend            : %s\n", DEF_SIM_BACKEND_NAME);
+#if defined(CONFIG_LCD_PANEL_USE_DE_ONLY)
+    printf("Mode               : DE-only\n");
+#else
+    printf("Mode               : DE+HSYNC+VSYNC\n");
+#endif
+    printf("Timing             : %ux%u HFP/HPW/HBP %u/%u/%u VFP/VPW/VBP %u/%u/%u\n",
+           CONFIG_TIMING_HACT, CONFIG_TIMING_VACT,
+           CONFIG_TIMING_HFP, CONFIG_TIMING_HPW, CONFIG_TIMING_HBP,
+           CONFIG_TIMING_VFP, CONFIG_TIMING_VPW, CONFIG_TIMING_VBP);
+    printf("Descriptors/frame  : %u\n", psCtx->m_u32Dsc / u32Frames);
+    printf("Clocks/frame       : %llu (expected %u)\n", (unsigned long long)psCtx->m_u64FrameClk, DEF_HACT_ALL * DEF_VACT_ALL);
+    printf("Lines              : %u\n", psCtx->m_u32LineNum);
+    printf("Blank IRQs         : %u\n", psCtx->m_u32IRQ);
+    printf("Data mismatches    : %u\n", psCtx->m_u32DataErr);
+    printf("Non-EBI writes     : %u\n", psCtx->m_u32NonEBI);
+
+    if (u32PclkHz)
+        printf("Refresh            : %.2f Hz at %u Hz write clock\n", (double)u32PclkHz / (double)psCtx->m_u64FrameClk, u32PclkHz);
+
+    printf("Signature          : %08X\n", ~psCtx->m_u32Crc);
+
+    /* Group identical lines so a timing change stands out. */
+    for (i = 0; i < u32Num; i++)
+    {
+        S_SIM_LINE *psL = &psCtx->m_psLines[i];
+
+        for (j = 0; j < u32Shapes; j++)
+        {
+            if (psShape[j].m_u32Period == psL->m_u32Period && psShape[j].m_u32DE == psL->m_u32DE &&
+                    psShape[j].m_u32HSYNC == psL->m_u32HSYNC && psShape[j].m_u32VSYNC == psL->m_u32VSYNC &&
+                    psShape[j].m_u32DEOffset == psL->m_u32DEOffset)
+                break;
+        }
+
+        if (j == u32Shapes)
+            psShape[u32Shapes++] = *psL;
+
+        pu32ShapeCnt[j]++;
+    }
+
+    printf("\n%8s %8s %8s %8s %8s %8s\n", "count", "period", "de", "de_off", "hsync", "vsync");
+
+    for (j = 0; j < u32Shapes; j++)
+    {
+        printf("%8u %8u %8u %8d %8u %8u\n", pu32ShapeCnt[j], psShape[j].m_u32Period, psShape[j].m_u32DE,
+               (psShape[j].m_u32DEOffset == 0xFFFFFFFF) ? -1 : (int)psShape[j].m_u32DEOffset,
+               psShape[j].m_u32HSYNC, psShape[j].m_u32VSYNC);
+    }
+
+    if (fpLines)
+    {
+        fprintf(fpLines, "%6s %12s %8s %8s %8s %8s %8s\n", "line", "start", "period", "de", "de_off", "hsync", "vsync");
+
+        for (i = 0; i < u32Num; i++)
+        {
+            S_SIM_LINE *psL = &psCtx->m_psLines[i];
+
+            fprintf(fpLines, "%6u %12llu %8u %8u %8d %8u %8u\n", i, (unsigned long long)psL->m_u64Start, psL->m_u32Period, psL->m_u32DE,
+                    (psL->m_u32DEOffset == 0xFFFFFFFF) ? -1 : (int)psL->m_u32DEOffset, psL->m_u32HSYNC, psL->m_u32VSYNC);
+        }
+    }
+
+    free(psShape);
+    free(pu32ShapeCnt);
+}
+
+static void sim_usage(const char *szProg)
+{
+    printf("Usage: %s [-o out.vcd] [-l lines.txt] [-f frames] [-t ns_per_clock] [-p write_clock_hz] [-i image.bin] [-d]\n", szProg);
+    printf("  -o  Write the DE/HSYNC/VSYNC/DATA waveform as VCD.\n");
+    printf("  -l  Write the per-line timing counts.\n");
+    printf("  -f  Number of frames to walk (default 1).\n");
+    printf("  -t  VCD time per EBI write in ns (default 1).\n");
+    printf("  -p  EBI write clock in Hz, used for the refresh estimate.\n");
+    printf("  -i  Load a raw RGB565 image as VRAM instead of the position pattern.\n");
+    printf("  -d  Dump the descriptor ring.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    S_SIM_CTX *psCtx = &s_sSim;
+    const char *szVCD = NULL, *szLines = NULL, *szImage = NULL;
+    uint32_t u32Frames = 1, u32ClkNs = 1, u32PclkHz = 0, u32Frame;
+    int bDump = 0, opt;
+    FILE *fpLines = NULL;
+#if defined(DISP_SIM_GDMA)
+    struct dma350_cmdlink_reg_t sReg = { 0 };
+    void *pvState = &sReg;
+#else
+    void *pvState = NULL;
+#endif
+
+    while ((opt = getopt(argc, argv, "o:l:f:t:p:i:dh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'o':
+                szVCD = optarg;
+                break;
+
+            case 'l':
+                szLines = optarg;
+                break;
+
+            case 'f':
+                u32Frames = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 't':
+                u32ClkNs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'p':
+                u32PclkHz = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'i':
+                szImage = optarg;
+                break;
+
+            case 'd':
+                bDump = 1;
+                break;
+
+            default:
+                sim_usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    if (!u32Frames || !u32ClkNs)
+    {
+        sim_usage(argv[0]);
+        return 1;
+    }
+
+    if (sim_memmap_init() < 0)
+        return 1;
+
+    if (szImage)
+    {
+        if (sim_vram_load(szImage) < 0)
+            return 1;
+    }
+    else
+    {
+        sim_vram_pattern();
+    }
+
+    /* Build the ring exactly as the component initialization does, no backend is started to flip to it. */
+    disp_set_vrambufaddr(g_au8FrameBuf);
+    s_pu16BufAddr = (volatile uint16_t *)g_au8FrameBuf;
+#if defined(CONFIG_DISP_PROBE)
+    disp_probe_start();
+#endif
+    disp_probe_begin(evDispProbeRingBuild);
+#if defined(DISP_SIM_GDMA)
+    disp_gdma_dsc_init();
+    disp_probe_end(evDispProbeRingBuild);
+
+    if (bDump)
+        disp_gdma_dsc_dump();
+
+#else
+    disp_pdma_dsc_init();
+    disp_probe_end(evDispProbeRingBuild);
+
+    if (bDump)
+        disp_pdma_dsc_dump();
+
+#endif
+
+    memset(psCtx, 0, sizeof(*psCtx));
+    psCtx->m_u32Crc = 0xFFFFFFFF;
+    psCtx->m_bFirst = 1;
+    psCtx->m_u32ClkNs = u32ClkNs;
+    psCtx->m_psLines = calloc(DEF_SIM_MAX_LINES, sizeof(S_SIM_LINE));
+
+    if (szVCD)
+    {
+        psCtx->m_fpVCD = fopen(szVCD, "w");
+
+        if (!psCtx->m_fpVCD)
+        {
+            perror(szVCD);
+            return 1;
+        }
+
+        sim_vcd_header(psCtx->m_fpVCD);
+    }
+
+    for (u32Frame = 0; u32Frame < u32Frames; u32Frame++)
+    {
+        uint32_t u32Dsc = (uint32_t)(uintptr_t)s_head;
+        uint64_t u64FrameStart = psCtx->m_u64Clk;
+
+        psCtx->m_bNewFrame = 1;
+
+        do
+        {
+            u32Dsc = sim_run_dsc(psCtx, u32Dsc, pvState);
+            psCtx->m_u32Dsc++;
+
+            if (psCtx->m_u32Dsc > (sizeof(s_sDscLCD) / sizeof(*s_head)) * u32Frames)
+            {
+                fprintf(stderr, "Ring does not close at head, stop walking.\n");
+                u32Dsc = 0;
+            }
+        } while (u32Dsc && (u32Dsc != (uint32_t)(uintptr_t)s_head));
+
+        psCtx->m_u64FrameClk = psCtx->m_u64Clk - u64FrameStart;
+
+        if (!u32Dsc)
+            break;
+    }
+
+    sim_line_close(psCtx);
+
+    if (psCtx->m_fpVCD)
+    {
+        fprintf(psCtx->m_fpVCD, "#%llu\n", (unsigned long long)(psCtx->m_u64Clk * u32ClkNs));
+        fclose(psCtx->m_fpVCD);
+    }
+
+    if (szLines)
+    {
+        fpLines = fopen(szLines, "w");
+
+        if (!fpLines)
+            perror(szLines);
+    }
+
+    sim_report(psCtx, fpLines, u32Frames, u32PclkHz);
+#if defined(CONFIG_DISP_PROBE)
+    disp_probe_dump();
+#endif
+
+    if (fpLines)
+        fclose(fpLines);
+
+    free(psCtx->m_psLines);
+
+    return (psCtx->m_u32DataErr || psCtx->m_u32NonEBI) ? 2 : 0;
+}
+
+/* Link-time stand-ins for the run-time paths that the simulator never calls. */
+uint32_t SystemCoreClock = __HSI;
@@ -0,0 +1,11 @@
+/**************************************************************************//**
+ * @file     arm_acle.h
+ * @brief    Empty ACLE header for Linux host builds.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __ARM_ACLE_HOST_H__
+#define __ARM_ACLE_HOST_H__
+
+#endif /* __ARM_ACLE_HOST_H__ */
@@ -0,0 +1,82 @@
+/**************************************************************************//**
+ * @file     arm_cmse.h
+ * @brief    CMSE intrinsics for Linux host builds. Every address is reported
+ *           as secure, privileged read/write and outside any MPU region, so
+ *           the DMA-350 library falls back to the default memory map.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __ARM_CMSE_HOST_H__
+#define __ARM_CMSE_HOST_H__
+
+#include <stddef.h>
+
+#define CMSE_MPU_READWRITE      1
+#define CMSE_AU_NONSECURE       2
+#define CMSE_MPU_NONSECURE      4
+#define CMSE_MPU_READ           8
+#define CMSE_MPU_UNPRIV         16
+
+typedef union
+{
+    struct cmse_address_info
+    {
+        unsigned mpu_region: 8;
+        unsigned sau_region: 8;
+        unsigned mpu_region_valid: 1;
+        unsigned sau_region_valid: 1;
+        unsigned read_ok: 1;
+        unsigned readwrite_ok: 1;
+        unsigned nonsecure_read_ok: 1;
+        unsigned nonsecure_readwrite_ok: 1;
+        unsigned secure: 1;
+        unsigned idau_region_valid: 1;
+        unsigned idau_region: 8;
+    } flags;
+    unsigned value;
+} cmse_address_info_t;
+
+static inline cmse_address_info_t cmse_TT(void *p)
+{
+    cmse_address_info_t sInfo;
+
+    (void)p;
+    sInfo.value = 0;
+    sInfo.flags.read_ok = 1;
+    sInfo.flags.readwrite_ok = 1;
+    sInfo.flags.secure = 1;
+
+    return sInfo;
+}
+
+static inline cmse_address_info_t cmse_TTT(void *p)
+{
+    return cmse_TT(p);
+}
+
+static inline cmse_address_info_t cmse_TTA(void *p)
+{
+    cmse_address_info_t sInfo = cmse_TT(p);
+
+    /* Nothing is reachable from the non-secure side. */
+    sInfo.flags.nonsecure_read_ok = 0;
+    sInfo.flags.nonsecure_readwrite_ok = 0;
+
+    return sInfo;
+}
+
+static inline cmse_address_info_t cmse_TTAT(void *p)
+{
+    return cmse_TTA(p);
+}
+
+static inline void *cmse_check_address_range(void *p, size_t s, int flags)
+{
+    (void)s;
+    (void)flags;
+
+    return p;
+}
+
+#endif /* __ARM_CMSE_HOST_H__ */
@@ -0,0 +1,78 @@
+/**************************************************************************//**
+ * @file     cmsis_host.h
+ * @brief    CMSIS compiler shim for building the display sources on a Linux
+ *           host. Force-include it (gcc -include) before any CMSIS header.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __CMSIS_HOST_H__
+#define __CMSIS_HOST_H__
+
+#include <stdint.h>
+
+/* The device sources keep bus addresses in uint32_t, see -no-pie in the host tools. */
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
+#pragma GCC diagnostic ignored "-Wint-to-pointer-cast"
+#pragma GCC diagnostic ignored "-Woverflow"
+
+/* Pretend to be an Armv8.1-M Mainline target so the device headers resolve. */
+#define __ARM_ARCH_PROFILE          'M'
+#define __ARM_ARCH                  8
+#define __ARM_ARCH_8_1M_MAIN__      1
+
+/* Take the place of cmsis_gcc.h, its inline assembly is Arm-only. */
+#define __CMSIS_GCC_H
+
+#define __ASM                       __asm
+#define __INLINE                    inline
+#define __STATIC_INLINE             static inline
+#define __STATIC_FORCEINLINE        __attribute__((always_inline)) static inline
+#define __NO_RETURN                 __attribute__((__noreturn__))
+#define CMSIS_DEPRECATED            __attribute__((deprecated))
+#define __USED                      __attribute__((used))
+#define __WEAK                      __attribute__((weak))
+#define __PACKED                    __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT             struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION              union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                __attribute__((aligned(x)))
+#define __RESTRICT                  __restrict
+#define __COMPILER_BARRIER()        __ASM volatile("":::"memory")
+#define __NO_INIT
+#define __ALIAS(x)                  __attribute__((alias(x)))
+
+/* Core instructions have no meaning on the host. */
+#define __NOP()                     do { } while (0)
+#define __WFI()                     do { } while (0)
+#define __WFE()                     do { } while (0)
+#define __SEV()                     do { } while (0)
+#define __ISB()                     __COMPILER_BARRIER()
+#define __DSB()                     __COMPILER_BARRIER()
+#define __DMB()                     __COMPILER_BARRIER()
+#define __REV(x)                    __builtin_bswap32(x)
+#define __REV16(x)                  ((uint32_t)((((x) & 0xFF00FF00UL) >> 8) | (((x) & 0x00FF00FFUL) << 8)))
+#define __CLZ(x)                    ((uint8_t)((x) ? __builtin_clz(x) : 32U))
+#define __enable_irq()              do { } while (0)
+#define __disable_irq()             do { } while (0)
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)
+{
+    return 0;
+}
+
+__STATIC_INLINE void __set_PRIMASK(uint32_t u32PriMask)
+{
+    (void)u32PriMask;
+}
+
+__STATIC_INLINE uint32_t __get_CONTROL(void)
+{
+    return 0;
+}
+
+__STATIC_INLINE uint32_t __get_IPSR(void)
+{
+    return 0;
+}
+
+#endif /* __CMSIS_HOST_H__ */
@@ -9,6 +9,38 @@
 #include "NuMicro.h"
 #include "component.h"
 #include "board.h"
+#include "disp_probe.h"
+#include "nu_cyccnt.h"
+
+/*---------------------------------------------------------------------------*/
+/* Define                                                                    */
+/*---------------------------------------------------------------------------*/
+#define CONFIG_COMPONENT_MAX    16    /*!< Components with boot timestamps, more are initialized but not timed */
+
+typedef enum
+{
+    evComponentIdle,       /*!< Not initialized yet */
+    evComponentPending,    /*!< Initialize returned COMPONENT_PENDING */
+    evComponentReady,      /*!< Initialized */
+    evComponentFailed      /*!< Initialize or poll failed */
+} E_COMPONENT_STATE;
+
+// Boot record of one component
+typedef struct
+{
+    E_COMPONENT_STATE m_evState;
+    uint32_t          m_u32Start;     /*!< Cycle count when initialize was called */
+    uint32_t          m_u32Return;    /*!< Cycle count when initialize returned */
+    uint32_t          m_u32Ready;     /*!< Cycle count when the component became ready or failed */
+} S_COMPONENT_BOOT;
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+static S_COMPONENT_BOOT s_asCompBoot[CONFIG_COMPONENT_MAX];
+static uint32_t s_u32BootStart;
+static int s_bDeferredStarted = 0;
+static int s_bBootReported = 0;
 
 /*---------------------------------------------------------------------------*/
 /* Functions                                                                 */
@@ -39,11 +71,46 @@ void Reset_Handler_PreInit(void)
 }
 
 /**
-  * @brief Initializes these components.
-  * @param[in]  None
+  * @brief      Records the state change of a component.
+  * @param[in]  i            Index in the component initialization table
+  * @param[in]  psComp       Component
+  * @param[in]  i32Ret       Return value of initialize or poll
   * @return     None
   */
-static void components_initialize(void)
+static void component_update(int i, component_export_t psComp, int i32Ret)
+{
+    E_COMPONENT_STATE evState;
+
+    if (i32Ret < 0)
+    {
+        // Print message if return of initialize function is small than zero.
+        printf("Initialize %s failure.\n", psComp->name);
+        evState = evComponentFailed;
+    }
+    else if ((i32Ret == COMPONENT_PENDING) && psComp->poll)
+    {
+        evState = evComponentPending;
+    }
+    else
+    {
+        evState = evComponentReady;
+    }
+
+    if (i < CONFIG_COMPONENT_MAX)
+    {
+        s_asCompBoot[i].m_evState = evState;
+
+        if (evState != evComponentPending)
+            s_asCompBoot[i].m_u32Ready = nu_cyccnt_get();
+    }
+}
+
+/**
+  * @brief      Initializes the components of one pass.
+  * @param[in]  bDeferred    0: regular components, 1: COMPONENT_FLAG_DEFERRED components
+  * @return     None
+  */
+static void components_initialize_pass(int bDeferred)
 {
     int i;
 
@@ -56,22 +123,121 @@ static void components_initialize(void)
     // Iterate over all components and call their initialize function if defined
     for (i = 0; i < u32CompInitNum; i++)
     {
+        int i32Ret;
+
+        if (((asCompInitTbl[i].flags & COMPONENT_FLAG_DEFERRED) != 0) != (bDeferred != 0))
+            continue;
+
         // Check if the component has an initialize method
         if (asCompInitTbl[i].initialize)
         {
             // Print the component name being initialized
             printf("Initialize %s\n", asCompInitTbl[i].name);
 
+            if (i < CONFIG_COMPONENT_MAX)
+                s_asCompBoot[i].m_u32Start = nu_cyccnt_get();
+
             // Call the initialize method for component setup
-            if (asCompInitTbl[i].initialize() < 0)
-            {
-                // Print message if return of initialize function is small than zero.
-                printf("Initialize %s failure.\n", asCompInitTbl[i].name);
-            }
+            i32Ret = asCompInitTbl[i].initialize();
+
+            // Components without a boot record cannot be polled later, wait for them here.
+            while ((i >= CONFIG_COMPONENT_MAX) && (i32Ret == COMPONENT_PENDING) && asCompInitTbl[i].poll)
+                i32Ret = asCompInitTbl[i].poll();
+
+            if (i < CONFIG_COMPONENT_MAX)
+                s_asCompBoot[i].m_u32Return = nu_cyccnt_get();
+
+            component_update(i, &asCompInitTbl[i], i32Ret);
+        }
+        else if (i < CONFIG_COMPONENT_MAX)
+        {
+            s_asCompBoot[i].m_evState = evComponentReady;
         }
     }
 }
 
+/**
+  * @brief Initializes these components.
+  * @param[in]  None
+  * @return     None
+  * @details    Deferred components start from components_poll() once the others are ready.
+  */
+static void components_initialize(void)
+{
+    components_initialize_pass(0);
+}
+
+/**
+  * @brief      Polls the pending components and starts the deferred ones once nothing else is pending.
+  * @param[in]  None
+  * @return     Number of components still pending
+  */
+static int components_poll(void)
+{
+    uint32_t i;
+    int i32Pending = 0;
+
+    // Get the starting address of the component initialization table
+    component_export_t asCompInitTbl = (component_export_t)&CompInitTab$$Base;
+
+    // Calculate the number of components in the initialization table
+    uint32_t u32CompInitNum = (component_export_t)&CompInitTab$$Limit - asCompInitTbl;
+
+    for (i = 0; (i < u32CompInitNum) && (i < CONFIG_COMPONENT_MAX); i++)
+    {
+        if (s_asCompBoot[i].m_evState != evComponentPending)
+            continue;
+
+        component_update(i, &asCompInitTbl[i], asCompInitTbl[i].poll());
+
+        if (s_asCompBoot[i].m_evState == evComponentPending)
+            i32Pending++;
+    }
+
+    if (!i32Pending && !s_bDeferredStarted)
+    {
+        s_bDeferredStarted = 1;
+        components_initialize_pass(1);
+
+        return components_poll();
+    }
+
+    return i32Pending;
+}
+
+/**
+  * @brief      Prints the boot timestamps of the components.
+  * @param[in]  None
+  * @return     None
+  */
+static void components_report(void)
+{
+    uint32_t i;
+
+    // Get the starting address of the component initialization table
+    component_export_t asCompInitTbl = (component_export_t)&CompInitTab$$Base;
+
+    // Calculate the number of components in the initialization table
+    uint32_t u32CompInitNum = (component_export_t)&CompInitTab$$Limit - asCompInitTbl;
+
+    printf("%-20s %10s %10s %10s %s\n", "Component", "Start(us)", "Return(us)", "Ready(us)", "State");
+
+    for (i = 0; (i < u32CompInitNum) && (i < CONFIG_COMPONENT_MAX); i++)
+    {
+        const S_COMPONENT_BOOT *psBoot = &s_asCompBoot[i];
+        uint32_t u32Freq = nu_cyccnt_freq() / 1000000;
+
+        if (!asCompInitTbl[i].initialize)
+            continue;
+
+        printf("%-20s %10u %10u %10u %s\n", asCompInitTbl[i].name,
+               (psBoot->m_u32Start - s_u32BootStart) / u32Freq,
+               (psBoot->m_u32Return - s_u32BootStart) / u32Freq,
+               (psBoot->m_u32Ready - s_u32BootStart) / u32Freq,
+               (psBoot->m_evState == evComponentReady) ? "ready" : "failed");
+    }
+}
+
 /**
   * @brief      Finalizes these components.
   * @param[in]  None
@@ -108,6 +274,13 @@ static void components_finalize(void)
 
 int main(void)
 {
+    /* Boot timestamps count from here. */
+    nu_cyccnt_init();
+#if defined(CONFIG_DISP_PROBE)
+    disp_probe_start();
+#endif
+    s_u32BootStart = nu_cyccnt_get();
+
     // Module clocks and function pin setting initialization.
     board_init();
 
@@ -117,6 +290,24 @@ int main(void)
     /* Placeholder for your code */
     while (1)
     {
+        /* Keep pending components moving, some poll DMA without an interrupt. */
+        if (components_poll() > 0)
+            continue;
+
+        if (!s_bBootReported)
+        {
+            s_bBootReported = 1;
+            components_report();
+        }
+
+#if defined(CONFIG_DISP_PROBE)
+
+        /* The blank interrupts wake the loop often enough to see a key. */
+        if (!UART_GET_RX_EMPTY(DEBUG_PORT) && (UART_READ(DEBUG_PORT) == 'p'))
+            disp_probe_dump();
+
+#endif
+
         __WFI();  // Wait For Interrupt.
     }
 
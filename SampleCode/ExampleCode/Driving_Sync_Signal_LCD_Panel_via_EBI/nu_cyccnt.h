@@ -0,0 +1,65 @@
+/**************************************************************************//**
+ * @file     nu_cyccnt.h
+ * @brief
+ *           cycle counter helper functions
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __NU_CYCCNT_H__
+#define __NU_CYCCNT_H__
+
+#include "NuMicro.h"
+
+#if !defined(__STATIC_INLINE)
+    #define __STATIC_INLINE static inline
+#endif
+
+#if defined(__CMSIS_HOST_H__)
+    #include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Start the free-running cycle counter.
+   On target it is the DWT CYCCNT, running at SystemCoreClock.
+   On the Linux host build it is the monotonic clock in nanoseconds. */
+__STATIC_INLINE void nu_cyccnt_init(void)
+{
+#if !defined(__CMSIS_HOST_H__)
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/* Read the cycle counter, use unsigned subtraction for elapsed cycles. */
+__STATIC_INLINE uint32_t nu_cyccnt_get(void)
+{
+#if defined(__CMSIS_HOST_H__)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/* Get the counting frequency of the cycle counter in Hz. */
+__STATIC_INLINE uint32_t nu_cyccnt_freq(void)
+{
+#if defined(__CMSIS_HOST_H__)
+    return 1000000000UL;
+#else
+    return SystemCoreClock;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NU_CYCCNT_H__ */
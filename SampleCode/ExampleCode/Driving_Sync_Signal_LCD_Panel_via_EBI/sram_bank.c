@@ -0,0 +1,101 @@
+/**************************************************************************//**
+ * @file     sram_bank.c
+ * @brief    SRAM bank pool allocator. The pool of a bank is the space the
+ *           SRAM_BANKn execution region of M55M1.scatter leaves free. Memory
+ *           is never given back, allocate render targets once at init.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include "disp.h"
+#include "sram_bank.h"
+
+#if defined(CONFIG_DISP_VRAM_BANKED)
+
+/*---------------------------------------------------------------------------*/
+/* Global variables                                                          */
+/*---------------------------------------------------------------------------*/
+/* Exist only with SRAM_BANK_PLACEMENT enabled in M55M1.scatter. */
+extern uint32_t Image$$SRAM_BANK0$$ZI$$Limit;
+extern uint32_t Image$$SRAM_BANK1$$ZI$$Limit;
+
+static uint32_t s_au32PoolCur[evSRAMBankCNT];
+static int s_bPoolInit = 0;
+
+static const uint32_t s_au32PoolEnd[evSRAMBankCNT] =
+{
+    SRAM_BANK0_BASE + SRAM_BANK01_SIZE,
+    SRAM_BANK1_BASE + SRAM_BANK01_SIZE,
+    0
+};
+
+/*---------------------------------------------------------------------------*/
+/* Functions                                                                 */
+/*---------------------------------------------------------------------------*/
+// Function to start each bank pool at the end of its execution region
+static void sram_bank_pool_init(void)
+{
+    if (s_bPoolInit)
+        return;
+
+    s_au32PoolCur[evSRAMBank0] = (uint32_t) &Image$$SRAM_BANK0$$ZI$$Limit;
+    s_au32PoolCur[evSRAMBank1] = (uint32_t) &Image$$SRAM_BANK1$$ZI$$Limit;
+    s_au32PoolCur[evSRAMBank2] = 0;
+    s_bPoolInit = 1;
+}
+
+// Function to get the SRAM bank of an address, -1 if it is not in SRAM0/1/2
+int sram_bank_of(const void *pvAddr)
+{
+    uint32_t u32Addr = (uint32_t)pvAddr;
+
+    if ((u32Addr >= SRAM_BANK0_BASE) && (u32Addr < SRAM_BANK1_BASE))
+        return evSRAMBank0;
+    else if ((u32Addr >= SRAM_BANK1_BASE) && (u32Addr < SRAM_BANK2_BASE))
+        return evSRAMBank1;
+    else if ((u32Addr >= SRAM_BANK2_BASE) && (u32Addr < (SRAM_BANK2_BASE + SRAM_BANK2_SIZE)))
+        return evSRAMBank2;
+
+    return -1;
+}
+
+// Function to allocate from the free tail of a bank, NULL if the bank has no pool or not enough room
+void *sram_bank_alloc(E_SRAM_BANK evBank, uint32_t u32Size, uint32_t u32Align)
+{
+    uint32_t u32Addr;
+
+    sram_bank_pool_init();
+
+    if ((evBank >= evSRAMBankCNT) || !s_au32PoolCur[evBank])
+        return NULL;
+
+    /* Keep every allocation on its own D-cache lines. */
+    if (u32Align < DCACHE_LINE_SIZE)
+        u32Align = DCACHE_LINE_SIZE;
+
+    u32Addr = NVT_ALIGN(s_au32PoolCur[evBank], u32Align);
+
+    if ((u32Addr >= s_au32PoolEnd[evBank]) || (u32Size > (s_au32PoolEnd[evBank] - u32Addr)))
+        return NULL;
+
+    s_au32PoolCur[evBank] = NVT_ALIGN(u32Addr + u32Size, DCACHE_LINE_SIZE);
+
+    return (void *)u32Addr;
+}
+
+// Function to get the free bytes left in the pool of a bank
+uint32_t sram_bank_get_free(E_SRAM_BANK evBank)
+{
+    uint32_t u32Addr;
+
+    sram_bank_pool_init();
+
+    if ((evBank >= evSRAMBankCNT) || !s_au32PoolCur[evBank])
+        return 0;
+
+    u32Addr = NVT_ALIGN(s_au32PoolCur[evBank], DCACHE_LINE_SIZE);
+
+    return (u32Addr < s_au32PoolEnd[evBank]) ? (s_au32PoolEnd[evBank] - u32Addr) : 0;
+}
+
+#endif /* defined(CONFIG_DISP_VRAM_BANKED) */
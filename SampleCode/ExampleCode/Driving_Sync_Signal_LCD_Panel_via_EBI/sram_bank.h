@@ -0,0 +1,51 @@
+/**************************************************************************//**
+ * @file     sram_bank.h
+ * @brief    SRAM bank placement and allocation helper functions.
+ *           SRAM0 and SRAM1 are separate 512 KB bank ports, so a DMA reading
+ *           one bank does not stall CPU writes to the other. Enable
+ *           SRAM_BANK_PLACEMENT in M55M1.scatter and CONFIG_DISP_VRAM_BANKED
+ *           in disp.h together.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __SRAM_BANK_H__
+#define __SRAM_BANK_H__
+
+#include "NuMicro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SRAM_BANK0_BASE       0x20100000UL   /*!< SRAM0 bank base address */
+#define SRAM_BANK1_BASE       0x20180000UL   /*!< SRAM1 bank base address */
+#define SRAM_BANK2_BASE       0x20200000UL   /*!< SRAM2 bank base address */
+#define SRAM_BANK01_SIZE      0x00080000UL   /*!< Size of SRAM0 and SRAM1 bank */
+#define SRAM_BANK2_SIZE       0x00050000UL   /*!< Size of SRAM2 bank */
+
+#define NVT_SRAM_BANK0        __attribute__((section(".bss.SRAM0.NoInit")))   /*!< Placed variables in SRAM0, not zeroed */
+#define NVT_SRAM_BANK1        __attribute__((section(".bss.SRAM1.NoInit")))   /*!< Placed variables in SRAM1, not zeroed */
+
+typedef enum
+{
+    evSRAMBank0,     /*!< SRAM0, .bss.SRAM0.NoInit and the bank 0 pool */
+    evSRAMBank1,     /*!< SRAM1, .bss.SRAM1.NoInit and the bank 1 pool */
+    evSRAMBank2,     /*!< SRAM2, RW data, heap and the non-cacheable region */
+    evSRAMBankCNT    /*!< Number of SRAM banks */
+} E_SRAM_BANK;
+
+// Function to get the SRAM bank of an address, -1 if it is not in SRAM0/1/2
+int sram_bank_of(const void *pvAddr);
+
+// Function to allocate from the free tail of a bank, NULL if the bank has no pool or not enough room
+void *sram_bank_alloc(E_SRAM_BANK evBank, uint32_t u32Size, uint32_t u32Align);
+
+// Function to get the free bytes left in the pool of a bank
+uint32_t sram_bank_get_free(E_SRAM_BANK evBank);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SRAM_BANK_H__ */